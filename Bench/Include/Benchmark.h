@@ -0,0 +1,105 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Minimal benchmark harness with JSON report
+ * */
+
+#pragma once
+
+#ifndef VISCORE_BENCH_BENCHMARK_H
+#define VISCORE_BENCH_BENCHMARK_H
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace VisCore::Bench {
+	/**
+	 * \brief Benchmark run options, parsed from command line
+	 */
+	struct BenchOptions {
+		size_t      MinSize     = 16;
+		size_t      MaxSize     = size_t(1) << 30;
+		size_t      MaxThreads  = 1;
+		size_t      MemoryLimit = size_t(4) << 30;
+		double      MinTimeMs   = 100;
+		std::string Filter;
+		std::string Output;
+	};
+
+	/**
+	 * \brief One measured case
+	 */
+	struct BenchResult {
+		std::string Name;
+		std::string Variant;
+		size_t      Size;
+		size_t      Threads;
+		uint64_t    Iterations;
+		double      NsPerOp;
+		double      BytesPerSecond;
+	};
+
+	/**
+	 * \brief Per thread case body, prepare once then run iteration count times
+	 */
+	struct BenchCase {
+		std::string Name;
+		std::string Variant;
+
+		/**
+		 * \brief Bytes touched by each iteration per thread, 0 means size
+		 */
+		std::function<size_t(size_t size)> Bytes;
+
+		/**
+		 * \brief Memory needed per thread, used to skip cases over memory limit
+		 */
+		std::function<size_t(size_t size)> Memory;
+
+		/**
+		 * \brief Create per thread state for given size, return body called with iteration count
+		 */
+		std::function<std::function<void(uint64_t iterations)>(size_t size)> Prepare;
+	};
+
+	/**
+	 * \brief Parse command line options
+	 * \return false if arguments invalid, usage was printed
+	 */
+	bool ParseOptions(int argc, char** argv, BenchOptions& options);
+
+	/**
+	 * \brief Run case for every size and thread count in options
+	 */
+	void RunCase(const BenchCase& benchCase, const BenchOptions& options, std::vector<BenchResult>& results);
+
+	/**
+	 * \brief Write results as JSON
+	 */
+	void WriteJson(std::ostream& stream, const BenchOptions& options, const std::vector<BenchResult>& results);
+
+	/**
+	 * \brief Register all buffer cases
+	 */
+	void AddBufferCases(std::vector<BenchCase>& cases);
+
+	/**
+	 * \brief Register all file cases
+	 */
+	void AddFileCases(std::vector<BenchCase>& cases);
+
+	/**
+	 * \brief Register all text cases
+	 */
+	void AddTextCases(std::vector<BenchCase>& cases);
+
+	/**
+	 * \brief Prevent compiler from optimizing value away
+	 */
+	void DoNotOptimize(const void* value);
+}
+
+#endif //VISCORE_BENCH_BENCHMARK_H
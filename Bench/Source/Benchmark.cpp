@@ -0,0 +1,202 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Benchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+using namespace std;
+using namespace VisCore;
+
+namespace {
+	size_t ParseSize(const char* text) {
+		char*  end   = nullptr;
+		size_t value = strtoull(text, &end, 10);
+		switch (end ? *end : '\0') {
+			case 'k':
+			case 'K':
+				value <<= 10;
+				break;
+			case 'm':
+			case 'M':
+				value <<= 20;
+				break;
+			case 'g':
+			case 'G':
+				value <<= 30;
+				break;
+			default:
+				break;
+		}
+		return value;
+	}
+
+	void PrintUsage() {
+		std::cerr << "Usage: VisCore.Bench [options]" << std::endl
+			<< "  --min-size <n>      smallest buffer size, accept K/M/G suffix (default 16)" << std::endl
+			<< "  --max-size <n>      largest buffer size, accept K/M/G suffix (default 1G)" << std::endl
+			<< "  --threads <n>       max thread count, run 1, 2, 4 ... n (default 1)" << std::endl
+			<< "  --memory-limit <n>  skip cases need more memory than this (default 4G)" << std::endl
+			<< "  --min-time <ms>     min measure time of each case (default 100)" << std::endl
+			<< "  --filter <text>     only run case whose name contains text" << std::endl
+			<< "  --output <file>     write JSON to file instead of stdout" << std::endl;
+	}
+
+	void EscapeJson(std::ostream& stream, const std::string& text) {
+		stream << '"';
+		for (const auto value : text) {
+			if (value == '"' || value == '\\')
+				stream << '\\';
+			stream << value;
+		}
+		stream << '"';
+	}
+
+	/**
+	 * \brief Run body on threads concurrently, return wall time in nanoseconds
+	 */
+	double Measure(const std::vector<std::function<void(uint64_t)>>& bodies, const uint64_t iterations) {
+		std::atomic<size_t> ready{0};
+		std::atomic<bool>   start{false};
+
+		std::vector<std::thread> workers;
+		for (size_t index = 1; index < bodies.size(); ++index) {
+			workers.emplace_back([&, index] {
+				ready.fetch_add(1);
+				while (!start.load()) {
+					std::this_thread::yield();
+				}
+				bodies[index](iterations);
+			});
+		}
+
+		while (ready.load() != workers.size()) {
+			std::this_thread::yield();
+		}
+
+		const auto begin = std::chrono::steady_clock::now();
+		start.store(true);
+		bodies[0](iterations);
+		for (auto& worker : workers) {
+			worker.join();
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+	}
+}
+
+bool Bench::ParseOptions(const int argc, char** argv, BenchOptions& options) {
+	for (int index = 1; index < argc; ++index) {
+		const char* name  = argv[index];
+		const char* value = index + 1 < argc ? argv[index + 1] : nullptr;
+		if (!value) {
+			PrintUsage();
+			return false;
+		}
+
+		if (strcmp(name, "--min-size") == 0)
+			options.MinSize = ParseSize(value);
+		else if (strcmp(name, "--max-size") == 0)
+			options.MaxSize = ParseSize(value);
+		else if (strcmp(name, "--threads") == 0)
+			options.MaxThreads = ParseSize(value);
+		else if (strcmp(name, "--memory-limit") == 0)
+			options.MemoryLimit = ParseSize(value);
+		else if (strcmp(name, "--min-time") == 0)
+			options.MinTimeMs = strtod(value, nullptr);
+		else if (strcmp(name, "--filter") == 0)
+			options.Filter = value;
+		else if (strcmp(name, "--output") == 0)
+			options.Output = value;
+		else {
+			PrintUsage();
+			return false;
+		}
+		++index;
+	}
+
+	if (options.MinSize == 0 || options.MaxSize < options.MinSize || options.MaxThreads == 0) {
+		PrintUsage();
+		return false;
+	}
+
+	return true;
+}
+
+void Bench::RunCase(const BenchCase& benchCase, const BenchOptions& options, std::vector<BenchResult>& results) {
+	if (!options.Filter.empty() && (benchCase.Name + "/" + benchCase.Variant).find(options.Filter) == std::string::npos)
+		return;
+
+	for (size_t size = options.MinSize; size <= options.MaxSize; size *= 4) {
+		for (size_t threads = 1; threads <= options.MaxThreads;
+		     threads = threads < options.MaxThreads && threads * 2 > options.MaxThreads ? options.MaxThreads : threads * 2) {
+			const auto memory = benchCase.Memory ? benchCase.Memory(size) : size;
+			if (memory * threads > options.MemoryLimit)
+				break;
+
+			std::vector<std::function<void(uint64_t)>> bodies;
+			for (size_t index = 0; index < threads; ++index) {
+				bodies.push_back(benchCase.Prepare(size));
+			}
+
+			// warm up, then grow iteration count until run is long enough
+			uint64_t iterations = 1;
+			auto     elapsed    = Measure(bodies, iterations);
+			while (elapsed < options.MinTimeMs * 1e6 && iterations < (uint64_t(1) << 40)) {
+				const auto scale = elapsed > 0 ? options.MinTimeMs * 1e6 / elapsed * 1.2 : 10.0;
+				iterations       = static_cast<uint64_t>(static_cast<double>(iterations) * (scale < 10 ? scale : 10)) + 1;
+				elapsed          = Measure(bodies, iterations);
+			}
+
+			const auto bytes = benchCase.Bytes ? benchCase.Bytes(size) : size;
+
+			BenchResult result;
+			result.Name           = benchCase.Name;
+			result.Variant        = benchCase.Variant;
+			result.Size           = size;
+			result.Threads        = threads;
+			result.Iterations     = iterations;
+			result.NsPerOp        = elapsed / static_cast<double>(iterations);
+			result.BytesPerSecond = static_cast<double>(bytes) * static_cast<double>(threads) * static_cast<double>(iterations) /
+			                        (elapsed / 1e9);
+			results.push_back(result);
+
+			std::cerr << result.Name << "/" << result.Variant << " size=" << size << " threads=" << threads
+				<< " ns/op=" << result.NsPerOp << " MB/s=" << result.BytesPerSecond / 1e6 << std::endl;
+		}
+
+		// next size overflow
+		if (size > options.MaxSize / 4)
+			break;
+	}
+}
+
+void Bench::WriteJson(std::ostream& stream, const BenchOptions& options, const std::vector<BenchResult>& results) {
+	stream << "{" << std::endl;
+	stream << "  \"options\": {\"min_size\": " << options.MinSize << ", \"max_size\": " << options.MaxSize
+		<< ", \"max_threads\": " << options.MaxThreads << ", \"min_time_ms\": " << options.MinTimeMs << "}," << std::endl;
+	stream << "  \"results\": [";
+	for (size_t index = 0; index < results.size(); ++index) {
+		const auto& result = results[index];
+		stream << (index ? "," : "") << std::endl << "    {\"name\": ";
+		EscapeJson(stream, result.Name);
+		stream << ", \"variant\": ";
+		EscapeJson(stream, result.Variant);
+		stream << ", \"size\": " << result.Size << ", \"threads\": " << result.Threads
+			<< ", \"iterations\": " << result.Iterations << ", \"ns_per_op\": " << result.NsPerOp
+			<< ", \"bytes_per_second\": " << result.BytesPerSecond << "}";
+	}
+	stream << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+void Bench::DoNotOptimize(const void* value) {
+	static std::atomic<const void*> sink;
+	sink.store(value, std::memory_order_relaxed);
+}
@@ -0,0 +1,574 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Buffer/Buffer.h"
+#include "Buffer/ByteSwap.h"
+#include "Buffer/Compression.h"
+#include "Buffer/NumericConvert.h"
+#include "Buffer/PitchedBuffer.h"
+#include "Buffer/SpillOptions.h"
+#include "Buffer/VertexData.h"
+#include "Streaming/BinaryReader.h"
+#include "Streaming/Streaming.h"
+#include "Streaming/Varint.h"
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+
+namespace {
+	/**
+	 * \brief Chunk size used by streaming and append cases
+	 */
+	constexpr size_t ChunkSize = 64 * 1024;
+
+	const BufferType BufferTypes[] = {BufferType::Constraint, BufferType::Dynamic, BufferType::Streaming};
+
+	std::shared_ptr<std::vector<char>> MakeSource(const size_t size) {
+		auto source = std::make_shared<std::vector<char>>(size);
+		for (size_t index = 0; index < size; ++index) {
+			(*source)[index] = static_cast<char>(index * 131 + 7);
+		}
+		return source;
+	}
+
+	size_t Twice(const size_t size) {
+		return size * 2;
+	}
+
+	size_t Triple(const size_t size) {
+		return size * 3;
+	}
+
+	void AddCreateCases(std::vector<Bench::BenchCase>& cases) {
+		for (const auto type : BufferTypes) {
+			cases.push_back({"CreateBuffer", ToString(type), nullptr, nullptr, [type](const size_t size) {
+				return [type, size](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						const auto buffer = CreateBuffer(type, size, 'v');
+						Bench::DoNotOptimize(buffer->GetData());
+					}
+				};
+			}});
+
+			cases.push_back({"InitBuffer", ToString(type), nullptr, Twice, [type](const size_t size) {
+				auto source = MakeSource(size);
+				auto buffer = CreateBuffer(type, size_t(0), 0);
+				return [source, buffer, size](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						buffer->InitBuffer(source->data(), size);
+						Bench::DoNotOptimize(buffer->GetData());
+					}
+				};
+			}});
+
+			cases.push_back({"Update", ToString(type), nullptr, Twice, [type](const size_t size) {
+				auto source = MakeSource(size);
+				auto buffer = CreateBuffer(type, size, 0);
+				return [source, buffer, size](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						buffer->Update(0, size, source->data());
+						Bench::DoNotOptimize(buffer->GetData());
+					}
+				};
+			}});
+
+			cases.push_back({"CopyTo", ToString(type), nullptr, Twice, [type](const size_t size) {
+				auto source      = CreateBuffer(type, size, 'v');
+				auto destination = CreateBuffer(BufferType::Constraint, size, 0);
+				return [source, destination](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						source->CopyTo(destination);
+						Bench::DoNotOptimize(destination->GetData());
+					}
+				};
+			}});
+
+			cases.push_back({"CreateBufferCopy", ToString(type), nullptr, Twice, [type](const size_t size) {
+				auto source = CreateBuffer(type, size, 'v');
+				return [source, type](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						const auto copy = source->CreateBufferCopy(type);
+						Bench::DoNotOptimize(copy->GetData());
+					}
+				};
+			}});
+		}
+	}
+
+	void AddDynamicCases(std::vector<Bench::BenchCase>& cases) {
+		cases.push_back({"Append", "Dynamic", nullptr, Twice, [](const size_t size) {
+			auto source = MakeSource(size < ChunkSize ? size : ChunkSize);
+			return [source, size](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					const auto buffer = CreateBuffer(BufferType::Dynamic, size_t(0), 0);
+					for (size_t offset = 0; offset < size; offset += source->size()) {
+						const auto length = size - offset < source->size() ? size - offset : source->size();
+						buffer->Append(source->data(), static_cast<int>(length));
+					}
+					Bench::DoNotOptimize(buffer->GetData());
+				}
+			};
+		}});
+
+		cases.push_back({"Append", "Spill", nullptr, Twice, [](const size_t size) {
+			auto source = MakeSource(size < ChunkSize ? size : ChunkSize);
+			return [source, size](const uint64_t iterations) {
+				// quarter of data stays resident, rest goes through temporary file
+				SpillOptions options;
+				options.MemoryLimit = size / 4;
+				options.SegmentSize = 64 * 1024;
+				for (uint64_t index = 0; index < iterations; ++index) {
+					const auto buffer = CreateSpillBuffer(options);
+					for (size_t offset = 0; offset < size; offset += source->size()) {
+						const auto length = size - offset < source->size() ? size - offset : source->size();
+						buffer->Append(source->data(), static_cast<int>(length));
+					}
+					Bench::DoNotOptimize(buffer.get());
+				}
+			};
+		}});
+
+		cases.push_back({"Append", "std::vector<char>", nullptr, Twice, [](const size_t size) {
+			auto source = MakeSource(size < ChunkSize ? size : ChunkSize);
+			return [source, size](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					std::vector<char> buffer;
+					for (size_t offset = 0; offset < size; offset += source->size()) {
+						const auto length = size - offset < source->size() ? size - offset : source->size();
+						buffer.insert(buffer.end(), source->data(), source->data() + length);
+					}
+					Bench::DoNotOptimize(buffer.data());
+				}
+			};
+		}});
+
+		cases.push_back({"Append", "std::string", nullptr, Twice, [](const size_t size) {
+			auto source = MakeSource(size < ChunkSize ? size : ChunkSize);
+			return [source, size](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					std::string buffer;
+					for (size_t offset = 0; offset < size; offset += source->size()) {
+						const auto length = size - offset < source->size() ? size - offset : source->size();
+						buffer.append(source->data(), length);
+					}
+					Bench::DoNotOptimize(buffer.data());
+				}
+			};
+		}});
+
+		// insert a small block in the middle, cost is dominated by moving the tail
+		cases.push_back({"Insert", "Dynamic", nullptr, Triple, [](const size_t size) {
+			auto buffer = CreateBuffer(BufferType::Dynamic, size, 'v');
+			return [buffer, size](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					buffer->InitBuffer(size, 'v');
+					buffer->Insert(static_cast<int>(size / 2), "0123456789abcdef", 16);
+					Bench::DoNotOptimize(buffer->GetData());
+				}
+			};
+		}});
+
+		cases.push_back({"Insert", "std::vector<char>", nullptr, Triple, [](const size_t size) {
+			return [size](const uint64_t iterations) {
+				const char* block = "0123456789abcdef";
+				for (uint64_t index = 0; index < iterations; ++index) {
+					std::vector<char> buffer(size, 'v');
+					buffer.insert(buffer.begin() + static_cast<ptrdiff_t>(size / 2), block, block + 16);
+					Bench::DoNotOptimize(buffer.data());
+				}
+			};
+		}});
+	}
+
+	void AddBaselineCases(std::vector<Bench::BenchCase>& cases) {
+		cases.push_back({"CreateBuffer", "std::vector<char>", nullptr, nullptr, [](const size_t size) {
+			return [size](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					std::vector<char> buffer(size, 'v');
+					Bench::DoNotOptimize(buffer.data());
+				}
+			};
+		}});
+
+		cases.push_back({"CreateBuffer", "std::string", nullptr, nullptr, [](const size_t size) {
+			return [size](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					std::string buffer(size, 'v');
+					Bench::DoNotOptimize(buffer.data());
+				}
+			};
+		}});
+
+		cases.push_back({"InitBuffer", "std::vector<char>", nullptr, Twice, [](const size_t size) {
+			auto source = MakeSource(size);
+			return [source](const uint64_t iterations) {
+				std::vector<char> buffer;
+				for (uint64_t index = 0; index < iterations; ++index) {
+					buffer.assign(source->begin(), source->end());
+					Bench::DoNotOptimize(buffer.data());
+				}
+			};
+		}});
+
+		cases.push_back({"Update", "memcpy", nullptr, Twice, [](const size_t size) {
+			auto source      = MakeSource(size);
+			auto destination = std::make_shared<std::vector<char>>(size);
+			return [source, destination, size](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					memcpy(destination->data(), source->data(), size);
+					Bench::DoNotOptimize(destination->data());
+				}
+			};
+		}});
+
+		cases.push_back({"CreateBufferCopy", "std::vector<char>", nullptr, Twice, [](const size_t size) {
+			auto source = MakeSource(size);
+			return [source](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					std::vector<char> copy(*source);
+					Bench::DoNotOptimize(copy.data());
+				}
+			};
+		}});
+	}
+
+	void AddStreamingCases(std::vector<Bench::BenchCase>& cases) {
+		cases.push_back({"Read", "Streaming", nullptr, nullptr, [](const size_t size) {
+			auto buffer = CreateBuffer(BufferType::Streaming, size, 'v');
+			auto chunk  = CreateBuffer(BufferType::Constraint, size < ChunkSize ? size : ChunkSize, 0);
+			return [buffer, chunk, size](const uint64_t iterations) {
+				auto* streaming = buffer->GetStreaming();
+				for (uint64_t index = 0; index < iterations; ++index) {
+					streaming->Seek(0);
+					while (!streaming->IsEof()) {
+						streaming->Read(chunk.get(), chunk->GetLength());
+					}
+					Bench::DoNotOptimize(chunk->GetData());
+				}
+			};
+		}});
+
+		// one byte per op, throughput column reports seeks per second
+		cases.push_back({"Seek", "Streaming", [](size_t) { return size_t(1); }, nullptr, [](const size_t size) {
+			auto buffer = CreateBuffer(BufferType::Streaming, size, 'v');
+			return [buffer, size](const uint64_t iterations) {
+				auto*    streaming = buffer->GetStreaming();
+				uint64_t position  = 0;
+				for (uint64_t index = 0; index < iterations; ++index) {
+					position = (position * 6364136223846793005ull + 1442695040888963407ull) % (size + 1);
+					streaming->Seek(static_cast<int64_t>(position));
+				}
+				Bench::DoNotOptimize(streaming);
+			};
+		}});
+
+		// decode stream as 4 byte fields
+		cases.push_back({"ReadFields", "BinaryReader", nullptr, nullptr, [](const size_t size) {
+			auto buffer = CreateBuffer(BufferType::Streaming, size, 'v');
+			return [buffer, size](const uint64_t iterations) {
+				auto* streaming = buffer->GetStreaming();
+				for (uint64_t index = 0; index < iterations; ++index) {
+					streaming->Seek(0);
+					Streaming::BinaryReader reader(streaming);
+					uint32_t                sum = 0;
+					for (size_t offset = 0; offset + 4 <= size; offset += 4) {
+						sum += reader.Read<uint32_t>();
+					}
+					Bench::DoNotOptimize(&sum);
+				}
+			};
+		}});
+
+		cases.push_back({"ReadFields", "Read", nullptr, nullptr, [](const size_t size) {
+			auto buffer = CreateBuffer(BufferType::Streaming, size, 'v');
+			auto field  = CreateBuffer(BufferType::Constraint, sizeof(uint32_t), 0);
+			return [buffer, field, size](const uint64_t iterations) {
+				auto* streaming = buffer->GetStreaming();
+				for (uint64_t index = 0; index < iterations; ++index) {
+					streaming->Seek(0);
+					uint32_t sum = 0;
+					for (size_t offset = 0; offset + 4 <= size; offset += 4) {
+						uint32_t value;
+						streaming->Read(field.get(), sizeof(value));
+						memcpy(&value, field->GetData(), sizeof(value));
+						sum += value;
+					}
+					Bench::DoNotOptimize(&sum);
+				}
+			};
+		}});
+
+		cases.push_back({"ByteSwap32", "VisCore", nullptr, nullptr, [](const size_t size) {
+			auto buffer = CreateBuffer(BufferType::Constraint, size, 'v');
+			return [buffer](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					ByteSwapRegion(*buffer, 0, buffer->GetLength() / 4, 4);
+					Bench::DoNotOptimize(buffer->GetData());
+				}
+			};
+		}});
+
+		cases.push_back({"ByteSwap32", "Scalar", nullptr, nullptr, [](const size_t size) {
+			auto buffer = CreateBuffer(BufferType::Constraint, size, 'v');
+			return [buffer](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					auto* data = **buffer;
+					for (size_t offset = 0; offset + 4 <= buffer->GetLength(); offset += 4) {
+						std::reverse(data + offset, data + offset + 4);
+					}
+					Bench::DoNotOptimize(buffer->GetData());
+				}
+			};
+		}});
+
+		// index like values, mostly 1 and 2 byte encodings
+		for (const auto group : {false, true}) {
+			cases.push_back({"DecodeVarints", group ? "GroupVarint" : "Leb128", nullptr, nullptr, [group](const size_t size) {
+				auto values = std::make_shared<std::vector<uint32_t>>(size / 4);
+				for (size_t index = 0; index < values->size(); ++index) {
+					(*values)[index] = static_cast<uint32_t>(index * 2654435761u >> (index % 3 ? 25 : 18));
+				}
+
+				auto encoded = std::make_shared<std::vector<char>>(Streaming::GetGroupVarintMaxSize(values->size()) + 5 * values->size());
+				const auto encodedSize = group ? Streaming::EncodeGroupVarint(values->data(), values->size(), encoded->data())
+				                               : Streaming::EncodeVarints(values->data(), values->size(), encoded->data());
+				encoded->resize(encodedSize);
+				return [group, values, encoded](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						size_t     consumed = 0;
+						const auto decoded  = group
+							                      ? Streaming::DecodeGroupVarint(encoded->data(), encoded->size(), values->data(), values->size(), consumed)
+							                      : Streaming::DecodeVarints(encoded->data(), encoded->size(), values->data(), values->size(), consumed);
+						Bench::DoNotOptimize(&decoded);
+					}
+				};
+			}});
+		}
+
+		// build output from 16 pieces by repeated operator+ then stream it out once
+		for (const auto type : {BufferType::Constraint, BufferType::Concat}) {
+			cases.push_back({"ConcatRead", ToString(type), nullptr, Triple, [type](const size_t size) {
+				const auto piece = CreateBuffer(BufferType::Constraint, size / 16 + 1, 'v');
+				auto       chunk = CreateBuffer(BufferType::Constraint, size < ChunkSize ? size : ChunkSize, 0);
+				return [type, piece, chunk](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						auto output = CreateBuffer(type, piece->GetData(), piece->GetLength());
+						for (size_t count = 1; count < 16; ++count) {
+							auto operand = piece;
+							output       = *output + operand;
+						}
+
+						// Constraint has no stream, walk its contiguous data in same chunks
+						if (auto* streaming = output->GetStreaming()) {
+							while (!streaming->IsEof()) {
+								streaming->Read(chunk.get(), chunk->GetLength());
+							}
+						} else {
+							for (size_t offset = 0; offset < output->GetLength(); offset += chunk->GetLength()) {
+								const auto bytes = std::min(chunk->GetLength(), output->GetLength() - offset);
+								chunk->Update(0, bytes, output->GetData() + offset);
+							}
+						}
+						Bench::DoNotOptimize(chunk->GetData());
+					}
+				};
+			}});
+		}
+	}
+
+	void AddVertexCases(std::vector<Bench::BenchCase>& cases) {
+		// float xyz positions split to x/y/z arrays
+		cases.push_back({"DeinterleaveXyz", "VisCore", nullptr, nullptr, [](const size_t size) {
+			auto records = CreateBuffer(BufferType::Constraint, size / 12 * 12, 'v');
+			auto streams = std::make_shared<std::vector<float>>(records->GetLength() / 4);
+			return [records, streams](const uint64_t iterations) {
+				const auto count = records->GetLength() / 12;
+				auto*      data  = reinterpret_cast<char*>(streams->data());
+				const AttributeStream split[] = {{0, 4, data}, {4, 4, data + count * 4}, {8, 4, data + count * 8}};
+				for (uint64_t index = 0; index < iterations; ++index) {
+					DeinterleaveRegion(*records, 0, count, 12, split, 3);
+					Bench::DoNotOptimize(streams->data());
+				}
+			};
+		}});
+
+		cases.push_back({"DeinterleaveXyz", "Scalar", nullptr, nullptr, [](const size_t size) {
+			auto records = CreateBuffer(BufferType::Constraint, size / 12 * 12, 'v');
+			auto streams = std::make_shared<std::vector<float>>(records->GetLength() / 4);
+			return [records, streams](const uint64_t iterations) {
+				const auto  count  = records->GetLength() / 12;
+				const auto* source = reinterpret_cast<const float*>(records->GetData());
+				auto*       x      = streams->data();
+				for (uint64_t index = 0; index < iterations; ++index) {
+					for (size_t record = 0; record < count; ++record) {
+						x[record]             = source[record * 3];
+						x[count + record]     = source[record * 3 + 1];
+						x[count * 2 + record] = source[record * 3 + 2];
+					}
+					Bench::DoNotOptimize(streams->data());
+				}
+			};
+		}});
+
+		for (const auto format : {NumericFormat::Float16, NumericFormat::BFloat16, NumericFormat::Unorm8, NumericFormat::Snorm16}) {
+			cases.push_back({"QuantizeFloats", ToString(format), nullptr, nullptr, [format](const size_t size) {
+				auto source = std::make_shared<std::vector<float>>(size / 4);
+				for (size_t index = 0; index < source->size(); ++index) {
+					(*source)[index] = static_cast<float>(index % 1000) / 999.0f;
+				}
+				auto destination = std::make_shared<std::vector<char>>(size);
+				return [format, source, destination](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						ConvertNumeric(reinterpret_cast<const char*>(source->data()), NumericFormat::Float32, destination->data(),
+						               format, source->size());
+						Bench::DoNotOptimize(destination->data());
+					}
+				};
+			}});
+		}
+
+		cases.push_back({"QuantizeFloats", "Scalar", nullptr, nullptr, [](const size_t size) {
+			auto source = std::make_shared<std::vector<float>>(size / 4);
+			for (size_t index = 0; index < source->size(); ++index) {
+				(*source)[index] = static_cast<float>(index % 1000) / 999.0f;
+			}
+			auto destination = std::make_shared<std::vector<uint16_t>>(size / 4);
+			return [source, destination](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					for (size_t value = 0; value < source->size(); ++value) {
+						(*destination)[value] = FloatToHalf((*source)[value]);
+					}
+					Bench::DoNotOptimize(destination->data());
+				}
+			};
+		}});
+
+		cases.push_back({"ComputeBounds", "VisCore", nullptr, nullptr, [](const size_t size) {
+			auto records = CreateBuffer(BufferType::Constraint, size / 12 * 12, 'v');
+			return [records](const uint64_t iterations) {
+				float min[3];
+				float max[3];
+				for (uint64_t index = 0; index < iterations; ++index) {
+					ComputeBounds(records->GetData(), records->GetLength() / 12, 12, 3, min, max);
+					Bench::DoNotOptimize(min);
+				}
+			};
+		}});
+
+		cases.push_back({"ComputeBounds", "Scalar", nullptr, nullptr, [](const size_t size) {
+			auto records = CreateBuffer(BufferType::Constraint, size / 12 * 12, 'v');
+			return [records](const uint64_t iterations) {
+				const auto* values = reinterpret_cast<const float*>(records->GetData());
+				const auto  count  = records->GetLength() / 12;
+				for (uint64_t index = 0; index < iterations; ++index) {
+					float min[3]{values[0], values[1], values[2]};
+					float max[3]{values[0], values[1], values[2]};
+					for (size_t record = 0; record < count; ++record) {
+						for (size_t component = 0; component < 3; ++component) {
+							min[component] = std::min(min[component], values[record * 3 + component]);
+							max[component] = std::max(max[component], values[record * 3 + component]);
+						}
+					}
+					Bench::DoNotOptimize(min);
+				}
+			};
+		}});
+	}
+
+	void AddPitchedCases(std::vector<Bench::BenchCase>& cases) {
+		// square grid of 4 byte elements
+		const auto side = [](const size_t size) {
+			size_t edge = 1;
+			while ((edge + 1) * (edge + 1) * 4 <= size) {
+				++edge;
+			}
+			return edge;
+		};
+
+		for (const auto layout : {PitchedLayout::Linear, PitchedLayout::Tiled}) {
+			cases.push_back({"Transpose", ToString(layout), nullptr, nullptr, [layout, side](const size_t size) {
+				const auto edge        = side(size);
+				auto       source      = std::make_shared<PitchedBuffer>(edge, edge, 4, layout);
+				auto       destination = std::make_shared<PitchedBuffer>(edge, edge, 4, layout);
+				return [source, destination](const uint64_t iterations) {
+					for (uint64_t index = 0; index < iterations; ++index) {
+						source->Transpose(*destination);
+						Bench::DoNotOptimize(destination->GetBuffer()->GetData());
+					}
+				};
+			}});
+		}
+
+		cases.push_back({"Transpose", "Scalar", nullptr, nullptr, [side](const size_t size) {
+			const auto edge        = side(size);
+			auto       source      = std::make_shared<std::vector<uint32_t>>(edge * edge);
+			auto       destination = std::make_shared<std::vector<uint32_t>>(edge * edge);
+			return [edge, source, destination](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					for (size_t row = 0; row < edge; ++row) {
+						for (size_t column = 0; column < edge; ++column) {
+							(*destination)[column * edge + row] = (*source)[row * edge + column];
+						}
+					}
+					Bench::DoNotOptimize(destination->data());
+				}
+			};
+		}});
+	}
+
+	void AddCompressionCases(std::vector<Bench::BenchCase>& cases) {
+		// 16 byte records with counter and few distinct values, like cold mesh or table data
+		const auto fill = [](const size_t size) {
+			auto data = std::make_shared<std::vector<char>>(size);
+			for (size_t index = 0; index + 16 <= size; index += 16) {
+				const uint32_t record[4] = {static_cast<uint32_t>(index / 16), 7, static_cast<uint32_t>(index % 48), 0};
+				memcpy(data->data() + index, record, 16);
+			}
+			return data;
+		};
+
+		cases.push_back({"Compress", "Lz", nullptr, nullptr, [fill](const size_t size) {
+			auto source      = fill(size);
+			auto destination = std::make_shared<std::vector<char>>(GetCompressBound(size));
+			return [source, destination](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					Compress(source->data(), source->size(), destination->data(), destination->size());
+					Bench::DoNotOptimize(destination->data());
+				}
+			};
+		}});
+
+		cases.push_back({"Decompress", "Lz", nullptr, nullptr, [fill](const size_t size) {
+			const auto source = fill(size);
+			auto packed       = std::make_shared<std::vector<char>>(GetCompressBound(size));
+			packed->resize(Compress(source->data(), size, packed->data(), packed->size()));
+			auto destination = std::make_shared<std::vector<char>>(size);
+			return [packed, destination](const uint64_t iterations) {
+				for (uint64_t index = 0; index < iterations; ++index) {
+					Decompress(packed->data(), packed->size(), destination->data(), destination->size());
+					Bench::DoNotOptimize(destination->data());
+				}
+			};
+		}});
+	}
+}
+
+void Bench::AddBufferCases(std::vector<BenchCase>& cases) {
+	AddCreateCases(cases);
+	AddBaselineCases(cases);
+	AddDynamicCases(cases);
+	AddStreamingCases(cases);
+	AddVertexCases(cases);
+	AddPitchedCases(cases);
+	AddCompressionCases(cases);
+}
@@ -0,0 +1,111 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Buffer/Buffer.h"
+#include "File/File.h"
+
+using namespace std;
+using namespace VisCore;
+
+namespace {
+	/**
+	 * \brief Temp file removed when last user is gone
+	 */
+	std::shared_ptr<std::string> MakeFile(const size_t size) {
+		static std::atomic<size_t> counter{0};
+
+		auto path = (std::filesystem::temp_directory_path() /
+		             ("VisCore.Bench." + std::to_string(counter.fetch_add(1)) + ".bin")).string();
+
+		std::vector<char> data(size);
+		for (size_t index = 0; index < size; ++index) {
+			data[index] = static_cast<char>(index * 131 + 7);
+		}
+
+		if (const auto file = OpenFile(path.c_str(), File::FileMode::Create, File::FileAccess::Write))
+			file->Write(data.data(), data.size());
+
+		return std::shared_ptr<std::string>(new std::string(std::move(path)), [](const std::string* value) {
+			std::remove(value->c_str());
+			delete value;
+		});
+	}
+
+	size_t Twice(const size_t size) {
+		return size * 2;
+	}
+
+	void AddLoadCase(std::vector<Bench::BenchCase>& cases, const char* variant, const size_t readers, const bool direct) {
+		cases.push_back({"LoadFile", variant, nullptr, Twice, [readers, direct](const size_t size) {
+			auto path = MakeFile(size);
+			return [path, readers, direct](const uint64_t iterations) {
+				File::FileOptions options;
+				options.Direct = direct;
+				for (uint64_t index = 0; index < iterations; ++index) {
+					const auto buffer = File::LoadFile(path->c_str(), Buffer::BufferType::Constraint, readers, options);
+					Bench::DoNotOptimize(buffer ? buffer->GetData() : nullptr);
+				}
+			};
+		}});
+	}
+}
+
+void Bench::AddFileCases(std::vector<BenchCase>& cases) {
+	AddLoadCase(cases, "1 reader", 1, false);
+	AddLoadCase(cases, "default readers", 0, false);
+	AddLoadCase(cases, "default readers direct", 0, true);
+
+	// old path, read into temporary memory then copy into buffer
+	cases.push_back({"LoadFile", "Read+InitBuffer", nullptr, [](const size_t size) { return size * 3; }, [](const size_t size) {
+		auto path = MakeFile(size);
+		return [path, size](const uint64_t iterations) {
+			std::vector<char> data(size);
+			for (uint64_t index = 0; index < iterations; ++index) {
+				const auto file = OpenFile(path->c_str(), File::FileMode::Open, File::FileAccess::Read);
+				file->ReadAt(0, data.data(), size);
+				const auto buffer = CreateBuffer(Buffer::BufferType::Constraint, data.data(), size);
+				Bench::DoNotOptimize(buffer->GetData());
+			}
+		};
+	}});
+
+	cases.push_back({"Transfer", "Transfer", nullptr, Twice, [](const size_t size) {
+		auto source = MakeFile(size);
+		auto sink   = MakeFile(0);
+		return [source, sink, size](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				const auto input  = OpenFile(source->c_str(), File::FileMode::Open, File::FileAccess::Read);
+				const auto output = OpenFile(sink->c_str(), File::FileMode::Create, File::FileAccess::Write);
+				const auto copied = File::Transfer(*input, *output, size);
+				Bench::DoNotOptimize(&copied);
+			}
+		};
+	}});
+
+	// old path, read chunks into buffer and write them out
+	cases.push_back({"Transfer", "Read+Write", nullptr, Twice, [](const size_t size) {
+		auto source = MakeFile(size);
+		auto sink   = MakeFile(0);
+		return [source, sink](const uint64_t iterations) {
+			const auto buffer = CreateBuffer(Buffer::BufferType::Constraint, size_t(1024 * 1024), 0);
+			for (uint64_t index = 0; index < iterations; ++index) {
+				const auto input  = OpenFile(source->c_str(), File::FileMode::Open, File::FileAccess::Read);
+				const auto output = OpenFile(sink->c_str(), File::FileMode::Create, File::FileAccess::Write);
+				for (size_t read; (read = input->Read(buffer.get(), buffer->GetLength())) != 0 && read != size_t(-1);) {
+					output->Write(buffer->GetData(), read);
+				}
+				Bench::DoNotOptimize(buffer->GetData());
+			}
+		};
+	}});
+}
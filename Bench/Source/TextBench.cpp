@@ -0,0 +1,171 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "Buffer/Buffer.h"
+#include "Text/BinaryText.h"
+#include "Text/LineReader.h"
+#include "Text/Unicode.h"
+
+using namespace std;
+using namespace VisCore;
+
+namespace {
+	/**
+	 * \brief Log like text, line length varies from 1 to 120 bytes
+	 */
+	std::shared_ptr<std::string> MakeText(const size_t size) {
+		auto     text  = std::make_shared<std::string>();
+		uint64_t state = 7;
+		text->reserve(size);
+		while (text->size() < size) {
+			state          = state * 6364136223846793005ull + 1442695040888963407ull;
+			const auto end = std::min(size, text->size() + static_cast<size_t>(state >> 33) % 120 + 1);
+			text->append(end - text->size() - 1, 'v');
+			text->push_back('\n');
+		}
+		return text;
+	}
+
+	/**
+	 * \brief Pseudo random bytes
+	 */
+	std::shared_ptr<std::string> MakeBinary(const size_t size) {
+		auto     data  = std::make_shared<std::string>(size, '\0');
+		uint64_t state = 13;
+		for (auto& value : *data) {
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			value = static_cast<char>(state >> 56);
+		}
+		return data;
+	}
+
+	/**
+	 * \brief Mixed ASCII and CJK text
+	 */
+	std::shared_ptr<std::string> MakeUnicodeText(const size_t size) {
+		auto     text  = std::make_shared<std::string>();
+		uint64_t state = 11;
+		text->reserve(size + 4);
+		while (text->size() < size) {
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			if ((state >> 60) < 10)
+				text->append("VisCore ");
+			else
+				text->append("\xE6\xB5\x8B\xE8\xAF\x95");
+		}
+		return text;
+	}
+}
+
+void Bench::AddTextCases(std::vector<BenchCase>& cases) {
+	cases.push_back({"ReadLines", "LineReader", nullptr, nullptr, [](const size_t size) {
+		auto text   = MakeText(size);
+		auto source = Buffer::CreateBuffer(Buffer::BufferType::Streaming, text->data(), text->size());
+		return [source](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				auto* streaming = source->GetStreaming();
+				streaming->Seek(0);
+
+				Text::LineReader reader(streaming);
+				std::string_view line;
+				size_t           total = 0;
+				while (reader.Next(line)) {
+					total += line.size();
+				}
+				Bench::DoNotOptimize(&total);
+			}
+		};
+	}});
+
+	cases.push_back({"ReadLines", "std::getline", nullptr, nullptr, [](const size_t size) {
+		auto text = MakeText(size);
+		return [text](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				std::istringstream stream(*text);
+				std::string        line;
+				size_t             total = 0;
+				while (std::getline(stream, line)) {
+					total += line.size();
+				}
+				Bench::DoNotOptimize(&total);
+			}
+		};
+	}});
+
+	cases.push_back({"ValidateUtf8", "VisCore", nullptr, nullptr, [](const size_t size) {
+		auto text = MakeUnicodeText(size);
+		return [text](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				auto valid = Text::ValidateUtf8(text->data(), text->size());
+				Bench::DoNotOptimize(&valid);
+			}
+		};
+	}});
+
+	cases.push_back({"Utf8ToUtf16", "VisCore", nullptr, nullptr, [](const size_t size) {
+		auto text   = MakeUnicodeText(size);
+		auto output = std::make_shared<std::string>(text->size() * 2, '\0');
+		return [text, output](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				auto written = Text::Transcode(text->data(), text->size(), Text::Encoding::Utf8, output->data(),
+				                               Text::Encoding::Utf16);
+				Bench::DoNotOptimize(&written);
+			}
+		};
+	}});
+
+	cases.push_back({"EncodeBase64", "VisCore", nullptr, nullptr, [](const size_t size) {
+		auto data   = MakeBinary(size);
+		auto output = std::make_shared<std::string>(Text::GetBase64EncodedSize(size), '\0');
+		return [data, output](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				auto written = Text::EncodeBase64(data->data(), data->size(), output->data());
+				Bench::DoNotOptimize(&written);
+			}
+		};
+	}});
+
+	cases.push_back({"DecodeBase64", "VisCore", nullptr, nullptr, [](const size_t size) {
+		auto data = MakeBinary(size / 4 * 3);
+		auto text = std::make_shared<std::string>(Text::GetBase64EncodedSize(data->size()), '\0');
+		Text::EncodeBase64(data->data(), data->size(), text->data());
+		return [data, text](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				auto written = Text::DecodeBase64(text->data(), text->size(), data->data());
+				Bench::DoNotOptimize(&written);
+			}
+		};
+	}});
+
+	cases.push_back({"EncodeHex", "VisCore", nullptr, nullptr, [](const size_t size) {
+		auto data   = MakeBinary(size);
+		auto output = std::make_shared<std::string>(Text::GetHexEncodedSize(size), '\0');
+		return [data, output](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				auto written = Text::EncodeHex(data->data(), data->size(), output->data());
+				Bench::DoNotOptimize(&written);
+			}
+		};
+	}});
+
+	cases.push_back({"DecodeHex", "VisCore", nullptr, nullptr, [](const size_t size) {
+		auto data = MakeBinary(size / 2);
+		auto text = std::make_shared<std::string>(Text::GetHexEncodedSize(data->size()), '\0');
+		Text::EncodeHex(data->data(), data->size(), text->data());
+		return [data, text](const uint64_t iterations) {
+			for (uint64_t index = 0; index < iterations; ++index) {
+				auto written = Text::DecodeHex(text->data(), text->size(), data->data());
+				Bench::DoNotOptimize(&written);
+			}
+		};
+	}});
+}
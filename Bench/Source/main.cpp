@@ -0,0 +1,38 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Benchmark.h"
+
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char** argv) {
+	VisCore::Bench::BenchOptions options;
+	if (!VisCore::Bench::ParseOptions(argc, argv, options))
+		return 1;
+
+	std::vector<VisCore::Bench::BenchCase> cases;
+	VisCore::Bench::AddBufferCases(cases);
+	VisCore::Bench::AddFileCases(cases);
+	VisCore::Bench::AddTextCases(cases);
+
+	std::vector<VisCore::Bench::BenchResult> results;
+	for (const auto& benchCase : cases) {
+		VisCore::Bench::RunCase(benchCase, options, results);
+	}
+
+	if (options.Output.empty()) {
+		VisCore::Bench::WriteJson(std::cout, options, results);
+		return 0;
+	}
+
+	std::ofstream stream(options.Output);
+	if (!stream) {
+		std::cerr << "Can not open output file " << options.Output << std::endl;
+		return 1;
+	}
+
+	VisCore::Bench::WriteJson(stream, options, results);
+	return 0;
+}
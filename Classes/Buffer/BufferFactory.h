@@ -0,0 +1,51 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Internal buffer factory for other modules of VisCore
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_FACTORY_H
+#define VISCORE_BUFFER_FACTORY_H
+
+#include "Buffer/Buffer.h"
+
+#include <memory>
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Create buffer without initialize content, used by loaders that fill whole buffer in place
+	 * \param type buffer type
+	 * \param size buffer size
+	 * \param allocation alignment and huge page options
+	 * \return IBufferPtr, nullptr if type is unknown
+	 */
+	IBufferPtr CreateUninitializedBuffer(BufferType type, size_t size, const BufferAllocation& allocation);
+
+	/**
+	 * \brief Get memory CopyTo()/Read() may write straight into, only plain contiguous types
+	 *		  (Constraint, Dynamic, Streaming) have no pin, load or merge behind raw access
+	 * \param buffer destination buffer
+	 * \return data ptr, nullptr if destination must be written through Update()
+	 */
+	char* GetDirectWriteData(IBuffer& buffer);
+
+	/**
+	 * \brief Fill whole buffer from CreateUninitializedBuffer() with raw writer. Plain contiguous types are
+	 *		  written in place, other types are filled in staging block that goes in through Update()
+	 * \param buffer destination buffer
+	 * \param fill callable writing GetLength() bytes to char*, returns false if failed
+	 * \return false if fill or Update() failed
+	 */
+	template<typename Fill>
+	bool FillBuffer(IBuffer& buffer, Fill&& fill) {
+		if (auto* data = GetDirectWriteData(buffer))
+			return fill(data);
+
+		const auto                    size = buffer.GetLength();
+		const std::unique_ptr<char[]> staging(new char[size]);
+		return fill(staging.get()) && buffer.Update(0, size, staging.get());
+	}
+}
+
+#endif //VISCORE_BUFFER_FACTORY_H
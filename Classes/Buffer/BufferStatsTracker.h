@@ -0,0 +1,74 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Per buffer hook for process wide memory accounting
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_STATS_TRACKER_H
+#define VISCORE_BUFFER_STATS_TRACKER_H
+
+#include <cstdint>
+
+#if defined(VIS_CORE_TRACK_ALLOCATION_SITES) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "Buffer/BufferType.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Member of every IBuffer implementation, report memory held by owner to BufferStats.
+	 *		  Copy starts empty, move takes the accounting from other
+	 */
+	class BufferStatsTracker {
+	public:
+		explicit BufferStatsTracker(BufferType type) noexcept;
+		~BufferStatsTracker();
+
+		BufferStatsTracker(BufferStatsTracker&& other) noexcept;
+		BufferStatsTracker(const BufferStatsTracker& other) noexcept;
+
+		BufferStatsTracker& operator=(BufferStatsTracker&& other) noexcept;
+		BufferStatsTracker& operator=(const BufferStatsTracker& other) noexcept;
+
+		/**
+		 * \brief Report bytes currently held by owner, 0 means released
+		 * \param bytes allocated bytes
+		 */
+		void Track(size_t bytes) noexcept;
+
+	private:
+		/**
+		 * \brief Owner buffer type
+		 */
+		BufferType Type;
+
+		/**
+		 * \brief Last reported bytes
+		 */
+		size_t Bytes;
+
+		/**
+		 * \brief Time when owner acquired memory, in nanoseconds
+		 */
+		int64_t AllocTime;
+	};
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	/**
+	 * \brief Record one CreateBuffer() call site for DumpBufferAllocationSites()
+	 * \param site caller return address
+	 * \param bytes requested size
+	 */
+	void RecordAllocationSite(const void* site, size_t bytes);
+
+	#if defined(_MSC_VER)
+	#define VIS_CORE_RETURN_ADDRESS() _ReturnAddress()
+	#else
+	#define VIS_CORE_RETURN_ADDRESS() __builtin_return_address(0)
+	#endif
+	#endif
+}
+
+#endif //VISCORE_BUFFER_STATS_TRACKER_H
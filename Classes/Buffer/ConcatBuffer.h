@@ -0,0 +1,344 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Concat buffer implementation
+ * */
+
+#pragma once
+
+#include "Buffer/BasicBuffer.h"
+#include "Buffer/Buffer.h"
+#include "Buffer/BufferStatsTracker.h"
+
+#include <vector>
+
+#include "Streaming/Streaming.h"
+
+#ifndef VISCORE_BUFFER_CONCAT_H
+#define VISCORE_BUFFER_CONCAT_H
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief ConcatBuffer, reference operands instead of copy them. GetLength(), CopyTo(), CreateBufferCopy()
+	 *		  and Read() walk operands in place, operator*()/GetData() and writes flatten operands into
+	 *		  one private block once. Operands must not be resized while referenced
+	 */
+	class ConcatBuffer : public IBuffer, public Streaming::IStreaming {
+	public:
+		ConcatBuffer();
+		~ConcatBuffer() override;
+
+		ConcatBuffer(ConcatBuffer&& other) noexcept;      // Move construct
+		ConcatBuffer(const ConcatBuffer& other) noexcept; // Copy construct
+
+		//--------------- operator -----------------
+
+		const ConcatBuffer& operator=(ConcatBuffer&& other) noexcept;      // Move assignment
+		const ConcatBuffer& operator=(const ConcatBuffer& other) noexcept; // Copy assignment
+
+		/**
+		 * \brief Get char data, flatten operands into private block first
+		 * \return char data ptr
+		 */
+		char* operator*() override;
+
+		/**
+		 * \brief Get char data, flatten operands unless there is only one
+		 * \return char data ptr
+		 */
+		const char* operator*() const override;
+
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length
+		 * \param position position
+		 * \return char value
+		 */
+		char& operator[](size_t position) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return new concat node, operands are referenced
+		 */
+		IBuffer* operator+(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new concat node, operands are referenced
+		 */
+		IBuffer* operator+(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new concat node, operands are referenced
+		 */
+		IBufferPtr operator+(IBufferPtr& buffer) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return current buffer, operand is appended as reference
+		 */
+		IBuffer* operator+=(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return current buffer, operand is appended as reference
+		 */
+		IBuffer* operator+=(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return current buffer, operand is appended as reference
+		 */
+		IBufferPtr operator+=(IBufferPtr& buffer) override;
+
+		//--------------- function -----------------
+
+		/**
+		 * \brief Get current IBuffer type
+		 * \return Buffer type enum
+		 */
+		[[nodiscard]]
+		BufferType GetType() override;
+
+		/**
+		 * \brief init buffer by given data and size
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 */
+		void InitBuffer(size_t size, char initData) override;
+
+		/**
+		 * \brief init buffer by given data ptr and size
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 */
+		void InitBuffer(const char* ptr, size_t size) override;
+
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Allocate private block without initialize content, caller fills whole buffer
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void Allocate(size_t size, const BufferAllocation& allocation);
+
+		/**
+		 * \brief Release all buffer Data
+		 */
+		void Release() override;
+
+		/**
+		 * \brief Update buffer region
+		 * \param offset start position
+		 * \param size update size
+		 * \param ptr data ptr
+		 */
+		[[maybe_unused]]
+		bool Update(size_t offset, size_t size, const char* ptr) override;
+
+		/**
+		 * \brief Copy buffer with special size to another buffer
+		 * \param buffer destination buffer
+		 * \param length special size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 */
+		void CopyTo(IBufferPtr buffer, int length = -1) const override;
+
+		/**
+		 * \brief Append char to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 */
+		[[maybe_unused]]
+		bool Append(const char& data) override;
+
+		/**
+		 * \brief Append data to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Append(const char* data, int length) override;
+
+		/**
+		 * \brief Insert data to buffer, Only dynamic buffer support this operator
+		 * \param index start index
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Insert(int index, const char* data, int length) override;
+
+		/**
+		 * \brief Clear buffer data, not release, default -1 means all
+		 */
+		void Clear(int length = -1) override;
+
+		/**
+		 * \brief Get buffer length
+		 * \return Current buffer length
+		 */
+		[[nodiscard]]
+		size_t GetLength() const override;
+
+		/**
+		 * \brief Get buffer Memory size, referenced operands are counted by themselves
+		 * \return Current buffer Memory used
+		 */
+		[[nodiscard]]
+		size_t GetMemSize() const override;
+
+		/**
+		 * \brief Get buffer raw data ptr, flatten operands unless there is only one
+		 * \return Raw buffer data ptr
+		 */
+		[[nodiscard]]
+		const char* GetData() const override;
+
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		BufferAllocation GetAllocation() const override;
+
+		/**
+		 * \brief Copy buffer with special size
+		 * \param type buffer type
+		 * \param length Copy size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 * \return IBufferPtr
+		 */
+		IBufferPtr CreateBufferCopy(BufferType type, int length = -1) const override;
+
+		/**
+		 * \brief Get buffer Streaming Interface(Constraint/Dynamic will return nullptr)
+		 * \return IStreaming class
+		 */
+		IStreaming* GetStreaming() override;
+
+		/**
+		 * \brief Get current position
+		 * \return Current position
+		 */
+		[[nodiscard]]
+		size_t Tell() const override;
+
+		/**
+		 * \brief Read streaming
+		 * \param buffer Read to buffer cache
+		 * \param length Read length, default -1 means read to all buffer 
+		 * \return Size successfully read
+		 */
+		[[maybe_unused]]
+		size_t Read(IBuffer* buffer, size_t length) override;
+
+		/**
+		 * \brief Seek to position
+		 * \param offset position offset
+		 * \param seekMode seek mode
+		 * \return new absolute position, if seek failed return -1
+		 */
+		[[maybe_unused]]
+		size_t Seek(int64_t offset, Streaming::SeekMode seekMode = Streaming::SeekMode::SeekSet) override;
+
+		/**
+		 * \brief Get if stream read to end
+		 * \return Is reach EOF
+		 */
+		[[nodiscard]]
+		bool IsEof() const override;
+
+		/**
+		 * \brief Close current streaming
+		 */
+		void Close() override;
+
+		/**
+		 * \brief Append operand as reference, concat operand contributes its parts
+		 * \param buffer operand
+		 */
+		void AppendPart(IBuffer& buffer);
+
+		/**
+		 * \brief Append operand as reference
+		 * \param buffer operand
+		 */
+		void AppendPart(const IBufferPtr& buffer);
+
+	private:
+		/**
+		 * \brief Copy [offset, offset + size) of operands to destination
+		 */
+		void CopyRange(size_t offset, size_t size, char* destination) const;
+
+		/**
+		 * \brief Write [offset, offset + size) of operands to start of destination through Update()
+		 */
+		void UpdateRange(size_t offset, size_t size, IBuffer& destination) const;
+
+		/**
+		 * \brief Merge parts into one private block
+		 * \param writable caller will write, single shared operand is copied as well
+		 * \return flattened data
+		 */
+		char* Flatten(bool writable) const;
+
+		/**
+		 * \brief Report bookkeeping memory to Stats
+		 */
+		void TrackParts();
+
+		/**
+		 * \brief Operands in order, mutable since const GetData() flattens them
+		 */
+		mutable std::vector<IBufferPtr> Parts;
+
+		/**
+		 * \brief End offset of each part
+		 */
+		mutable std::vector<size_t> Ends;
+
+		/**
+		 * \brief Parts is one block private to this buffer, safe to write
+		 */
+		mutable bool Owned;
+
+		/**
+		 * \brief Sum of part lengths
+		 */
+		size_t Length;
+
+		/**
+		 * \brief Memory accounting
+		 */
+		BufferStatsTracker Stats;
+
+		/**
+		 * \brief Current position
+		 */
+		size_t Position;
+	};
+}
+
+#endif //VISCORE_BUFFER_CONCAT_H
@@ -5,7 +5,9 @@
  * */
 #pragma once
 
+#include "Buffer/BasicBuffer.h"
 #include "Buffer/Buffer.h"
+#include "Buffer/BufferStatsTracker.h"
 
 #ifndef VISCORE_BUFFER_CONSTRAINT_H
 #define VISCORE_BUFFER_CONSTRAINT_H
@@ -40,7 +42,7 @@ namespace VisCore::Buffer {
 		const char* operator*() const override;
 
 		/**
-		 * \brief Get char by position
+		 * \brief Get char by position, throw std::out_of_range if position >= length
 		 * \param position position
 		 * \return char value
 		 */
@@ -111,6 +113,29 @@ namespace VisCore::Buffer {
 		 */
 		void InitBuffer(const char* ptr, size_t size) override;
 
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Allocate buffer without initialize content, caller fills whole buffer
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void Allocate(size_t size, const BufferAllocation& allocation);
+
 		/**
 		 * \brief Release all buffer Data
 		 */
@@ -183,6 +208,13 @@ namespace VisCore::Buffer {
 		[[nodiscard]]
 		const char* GetData() const override;
 
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		BufferAllocation GetAllocation() const override;
+
 		/**
 		 * \brief Copy buffer with special size
 		 * \param type buffer type
@@ -200,13 +232,14 @@ namespace VisCore::Buffer {
 
 	private:
 		/**
-		 * \brief Data ptr
+		 * \brief Buffer core
 		 */
-		char* Data;
+		BasicConstraintBuffer Core;
+
 		/**
-		 * \brief Buffer size
+		 * \brief Memory accounting
 		 */
-		size_t Size;
+		BufferStatsTracker Stats;
 	};
 }
 
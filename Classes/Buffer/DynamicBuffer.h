@@ -5,9 +5,9 @@
  * */
 #pragma once
 
-#include <vector>
-
+#include "Buffer/BasicBuffer.h"
 #include "Buffer/Buffer.h"
+#include "Buffer/BufferStatsTracker.h"
 
 #ifndef VISCORE_BUFFER_DYNAMIC_H
 #define VISCORE_BUFFER_DYNAMIC_H
@@ -42,7 +42,7 @@ namespace VisCore::Buffer {
 		const char* operator*() const override;
 
 		/**
-		 * \brief Get char by position
+		 * \brief Get char by position, throw std::out_of_range if position >= length
 		 * \param position position
 		 * \return char value
 		 */
@@ -113,6 +113,29 @@ namespace VisCore::Buffer {
 		 */
 		void InitBuffer(const char* ptr, size_t size) override;
 
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Allocate buffer without initialize content, caller fills whole buffer
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void Allocate(size_t size, const BufferAllocation& allocation);
+
 		/**
 		 * \brief Release all buffer Data
 		 */
@@ -127,6 +150,16 @@ namespace VisCore::Buffer {
 		[[maybe_unused]]
 		bool Update(size_t offset, size_t size, const char* ptr) override;
 
+		/**
+		 * \brief Update several buffer regions in one pass, buffer grows once to cover all regions
+		 * \param regions region array
+		 * \param count region count
+		 * \param threads max worker count when total payload is large, 0 means hardware concurrency
+		 * \return false if any region has no data ptr
+		 */
+		[[maybe_unused]]
+		bool UpdateMany(const UpdateRegion* regions, size_t count, size_t threads = 1) override;
+
 		/**
 		 * \brief Copy buffer with special size to another buffer
 		 * \param buffer destination buffer
@@ -185,6 +218,13 @@ namespace VisCore::Buffer {
 		[[nodiscard]]
 		const char* GetData() const override;
 
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		BufferAllocation GetAllocation() const override;
+
 		/**
 		 * \brief Copy buffer with special size
 		 * \param type buffer type
@@ -202,13 +242,14 @@ namespace VisCore::Buffer {
 
 	private:
 		/**
-		 * \brief Data ptr
+		 * \brief Buffer core
 		 */
-		std::vector<char> Data;
+		BasicDynamicBuffer Core;
+
 		/**
-		 * \brief Buffer size
+		 * \brief Memory accounting
 		 */
-		size_t Size;
+		BufferStatsTracker Stats;
 	};
 }
 
@@ -0,0 +1,418 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Managed buffer implementation, compressed in memory when cold
+ * */
+#pragma once
+
+#include "Buffer/BasicBuffer.h"
+#include "Buffer/Buffer.h"
+#include "Buffer/BufferStatsTracker.h"
+#include "Buffer/MemoryBudget.h"
+
+#include "Streaming/Streaming.h"
+
+#include <atomic>
+#include <mutex>
+
+#ifndef VISCORE_BUFFER_MANAGED_H
+#define VISCORE_BUFFER_MANAGED_H
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Managed buffer, Alloc only once, Disallow Append()/Insert(), Allow Update().
+	 *		  Registered to process wide memory budget, when budget is exceeded idle buffers are
+	 *		  compressed and data is restored on next access through any data accessor or Read()
+	 */
+	class ManagedBuffer : public IBuffer, public Streaming::IStreaming {
+	public:
+		ManagedBuffer();
+		~ManagedBuffer() override;
+
+		// budget registry keeps buffer address
+		ManagedBuffer(ManagedBuffer&& other)                 = delete;
+		ManagedBuffer(const ManagedBuffer& other)            = delete;
+		ManagedBuffer& operator=(ManagedBuffer&& other)      = delete;
+		ManagedBuffer& operator=(const ManagedBuffer& other) = delete;
+
+		//--------------- operator -----------------
+
+		/**
+		 * \brief Get char data
+		 * \return char data ptr
+		 */
+		char* operator*() override;
+
+		/**
+		 * \brief Get char data
+		 * \return char data ptr
+		 */
+		const char* operator*() const override;
+
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length
+		 * \param position position
+		 * \return char value
+		 */
+		char& operator[](size_t position) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBufferPtr operator+(IBufferPtr& buffer) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+=(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+=(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBufferPtr operator+=(IBufferPtr& buffer) override;
+
+		//--------------- function -----------------
+
+		/**
+		 * \brief Get current IBuffer type
+		 * \return Buffer type enum
+		 */
+		[[nodiscard]]
+		BufferType GetType() override;
+
+		/**
+		 * \brief init buffer by given data and size
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 */
+		void InitBuffer(size_t size, char initData) override;
+
+		/**
+		 * \brief init buffer by given data ptr and size
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 */
+		void InitBuffer(const char* ptr, size_t size) override;
+
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Allocate buffer without initialize content, caller fills whole buffer
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void Allocate(size_t size, const BufferAllocation& allocation);
+
+		/**
+		 * \brief Add one pin and make buffer resident, pinned buffer is never compressed
+		 */
+		void Pin();
+
+		/**
+		 * \brief Remove one pin
+		 * \return false if buffer is not pinned
+		 */
+		bool Unpin();
+
+		/**
+		 * \brief Get if data is currently compressed
+		 */
+		[[nodiscard]]
+		bool IsCompressed() const;
+
+		/**
+		 * \brief Compress data if buffer is idle, called by budget sweep with registry locked.
+		 *		  Buffer accessed since last sweep gets a second chance instead
+		 * \param now sweep time in nanoseconds
+		 * \param config budget settings
+		 * \return bytes saved, 0 if buffer is kept resident
+		 */
+		size_t TryCompress(int64_t now, const MemoryBudgetConfig& config);
+
+		/**
+		 * \brief Release all buffer Data
+		 */
+		void Release() override;
+
+		/**
+		 * \brief Update buffer region
+		 * \param offset start position
+		 * \param size update size
+		 * \param ptr data ptr
+		 */
+		[[maybe_unused]]
+		bool Update(size_t offset, size_t size, const char* ptr) override;
+
+		/**
+		 * \brief Update several buffer regions, see IBuffer::UpdateMany(). Buffer stays pinned for whole batch
+		 * \param regions region array
+		 * \param count region count
+		 * \param threads max worker count when total payload is large, 0 means hardware concurrency
+		 * \return false if any region out of range
+		 */
+		[[maybe_unused]]
+		bool UpdateMany(const UpdateRegion* regions, size_t count, size_t threads = 1) override;
+
+		/**
+		 * \brief Copy buffer with special size to another buffer
+		 * \param buffer destination buffer
+		 * \param length special size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 */
+		void CopyTo(IBufferPtr buffer, int length = -1) const override;
+
+		/**
+		 * \brief Append char to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 */
+		[[maybe_unused]]
+		bool Append(const char& data) override;
+
+		/**
+		 * \brief Append data to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Append(const char* data, int length) override;
+
+		/**
+		 * \brief Insert data to buffer, Only dynamic buffer support this operator
+		 * \param index start index
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Insert(int index, const char* data, int length) override;
+
+		/**
+		 * \brief Clear buffer data, not release, default -1 means all
+		 */
+		void Clear(int length = -1) override;
+
+		/**
+		 * \brief Get buffer length
+		 * \return Current buffer length
+		 */
+		[[nodiscard]]
+		size_t GetLength() const override;
+
+		/**
+		 * \brief Get buffer Memory size
+		 * \return Current buffer Memory used
+		 */
+		[[nodiscard]]
+		size_t GetMemSize() const override;
+
+		/**
+		 * \brief Get buffer raw data ptr
+		 * \return Raw buffer data ptr
+		 */
+		[[nodiscard]]
+		const char* GetData() const override;
+
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		BufferAllocation GetAllocation() const override;
+
+		/**
+		 * \brief Copy buffer with special size
+		 * \param type buffer type
+		 * \param length Copy size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 * \return IBufferPtr
+		 */
+		IBufferPtr CreateBufferCopy(BufferType type, int length = -1) const override;
+
+		/**
+		 * \brief Get buffer Streaming Interface
+		 * \return IStreaming class
+		 */
+		Streaming::IStreaming* GetStreaming() override;
+
+		/**
+		 * \brief Get current position
+		 * \return Current position
+		 */
+		[[nodiscard]]
+		size_t Tell() const override;
+
+		/**
+		 * \brief Read streaming
+		 * \param buffer Read to buffer cache
+		 * \param length Read length, default -1 means read to all buffer 
+		 * \return Size successfully read
+		 */
+		[[maybe_unused]]
+		size_t Read(IBuffer* buffer, size_t length) override;
+
+		/**
+		 * \brief Seek to position
+		 * \param offset position offset
+		 * \param seekMode seek mode
+		 * \return new absolute position, if seek failed return -1
+		 */
+		[[maybe_unused]]
+		size_t Seek(int64_t offset, Streaming::SeekMode seekMode = Streaming::SeekMode::SeekSet) override;
+
+		/**
+		 * \brief Get if stream read to end
+		 * \return Is reach EOF
+		 */
+		[[nodiscard]]
+		bool IsEof() const override;
+
+		/**
+		 * \brief Close current streaming
+		 */
+		void Close() override;
+
+	private:
+		/**
+		 * \brief Data state, Compressing only while sweep holds Mutex
+		 */
+		enum class State : uint8_t {
+			Resident,
+			Compressing,
+			Compressed
+		};
+
+		/**
+		 * \brief Pin data for one internal operation, so sweep cannot compress it midway
+		 */
+		class AccessScope {
+		public:
+			AccessScope(const ManagedBuffer& buffer, bool write);
+			~AccessScope();
+
+			AccessScope(const AccessScope&)            = delete;
+			AccessScope& operator=(const AccessScope&) = delete;
+
+			char* Data;
+
+		private:
+			const ManagedBuffer& Owner;
+		};
+
+		/**
+		 * \brief Mark buffer accessed and restore data if compressed
+		 * \param write access may modify data, clears incompressible mark
+		 * \return resident data
+		 */
+		char* Acquire(bool write) const;
+
+		/**
+		 * \brief Decompress data, then enforce budget
+		 */
+		void Restore() const;
+
+		/**
+		 * \brief Register allocated data to budget
+		 */
+		void Register();
+
+		/**
+		 * \brief Buffer core, released while compressed
+		 */
+		mutable BasicConstraintBuffer Core;
+
+		/**
+		 * \brief Compressed data, nullptr while resident
+		 */
+		mutable char* Packed;
+
+		mutable size_t PackedSize;
+
+		/**
+		 * \brief Data length, kept while compressed
+		 */
+		size_t Length;
+
+		/**
+		 * \brief Memory accounting, compressed size while compressed
+		 */
+		mutable BufferStatsTracker Stats;
+
+		/**
+		 * \brief Current position
+		 */
+		size_t Position;
+
+		/**
+		 * \brief Serialize restore with budget sweep
+		 */
+		mutable std::mutex Mutex;
+
+		mutable std::atomic<State> DataState;
+
+		/**
+		 * \brief Set by every access, cleared by budget sweep
+		 */
+		mutable std::atomic<bool> Accessed;
+
+		/**
+		 * \brief Last compression saved too little, skip until next write access
+		 */
+		mutable std::atomic<bool> Incompressible;
+
+		mutable std::atomic<uint32_t> Pins;
+
+		/**
+		 * \brief Time of last access seen by budget sweep, in nanoseconds
+		 */
+		mutable int64_t LastAccess;
+
+		/**
+		 * \brief Position in budget registry, -1 if not registered
+		 */
+		size_t RegistryIndex;
+
+		friend class ManagedRegistry;
+	};
+}
+
+#endif //VISCORE_BUFFER_MANAGED_H
@@ -0,0 +1,348 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Shared buffer implementation, fixed size memory mapped by several processes
+ * */
+#pragma once
+
+#include "Buffer/Buffer.h"
+#include "Buffer/BufferStatsTracker.h"
+#include "Buffer/SharedMemory.h"
+
+#include "Streaming/Streaming.h"
+
+#ifndef VISCORE_BUFFER_SHARED_H
+#define VISCORE_BUFFER_SHARED_H
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief SharedBuffer, disallow resize/append/insert. Data lives in shared memory object that
+	 *		  other processes map by name or handle, writes are seen by all of them at once
+	 */
+	class SharedBuffer : public IBuffer, public Streaming::IStreaming {
+	public:
+		SharedBuffer();
+		~SharedBuffer() override;
+
+		SharedBuffer(SharedBuffer&& other)                 = delete;
+		SharedBuffer(const SharedBuffer& other)            = delete;
+		SharedBuffer& operator=(SharedBuffer&& other)      = delete;
+		SharedBuffer& operator=(const SharedBuffer& other) = delete;
+
+		/**
+		 * \brief Create shared memory, see CreateSharedBuffer()
+		 * \return false if create failed, buffer is empty
+		 */
+		bool Create(const char* name, size_t size);
+
+		/**
+		 * \brief Map named shared memory, see OpenSharedBuffer()
+		 * \return false if open failed, buffer is empty
+		 */
+		bool Open(const char* name, bool readOnly);
+
+		/**
+		 * \brief Map duplicate of shared memory handle, see OpenSharedBuffer()
+		 * \return false if open failed, buffer is empty
+		 */
+		bool Open(SharedMemoryHandle handle, bool readOnly);
+
+		/**
+		 * \brief Seal content and remap read only, see SealSharedBuffer()
+		 */
+		bool Seal();
+
+		[[nodiscard]]
+		bool IsReadOnly() const {
+			return ReadOnly;
+		}
+
+		[[nodiscard]]
+		SharedMemoryHandle GetHandle() const {
+			return Handle;
+		}
+
+		//--------------- operator -----------------
+
+		/**
+		 * \brief Get writable char data, mapping is shared with other processes
+		 * \return char data ptr, nullptr when read only
+		 */
+		char* operator*() override;
+
+		/**
+		 * \brief Get char data
+		 * \return char data ptr
+		 */
+		const char* operator*() const override;
+
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length or read only
+		 * \param position position
+		 * \return char value
+		 */
+		char& operator[](size_t position) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return new anonymous shared buffer
+		 */
+		IBuffer* operator+(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new anonymous shared buffer
+		 */
+		IBuffer* operator+(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new anonymous shared buffer
+		 */
+		IBufferPtr operator+(IBufferPtr& buffer) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return new anonymous shared buffer
+		 */
+		IBuffer* operator+=(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new anonymous shared buffer
+		 */
+		IBuffer* operator+=(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new anonymous shared buffer
+		 */
+		IBufferPtr operator+=(IBufferPtr& buffer) override;
+
+		//--------------- function -----------------
+
+		/**
+		 * \brief Get current IBuffer type
+		 * \return Buffer type enum
+		 */
+		[[nodiscard]]
+		BufferType GetType() override;
+
+		/**
+		 * \brief init buffer by given data and size
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 */
+		void InitBuffer(size_t size, char initData) override;
+
+		/**
+		 * \brief init buffer by given data ptr and size
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 */
+		void InitBuffer(const char* ptr, size_t size) override;
+
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Create anonymous shared memory, content is zero
+		 * \param size Buffer size
+		 * \param allocation ignored, mapping is page aligned
+		 */
+		void Allocate(size_t size, const BufferAllocation& allocation);
+
+		/**
+		 * \brief Release all buffer Data
+		 */
+		void Release() override;
+
+		/**
+		 * \brief Update buffer region
+		 * \param offset start position
+		 * \param size update size
+		 * \param ptr data ptr
+		 * \return false if buffer is read only or region out of range
+		 */
+		[[maybe_unused]]
+		bool Update(size_t offset, size_t size, const char* ptr) override;
+
+		/**
+		 * \brief Update several buffer regions, see IBuffer::UpdateMany()
+		 * \param regions region array
+		 * \param count region count
+		 * \param threads max worker count when total payload is large, 0 means hardware concurrency
+		 * \return false if buffer is read only or any region out of range
+		 */
+		[[maybe_unused]]
+		bool UpdateMany(const UpdateRegion* regions, size_t count, size_t threads = 1) override;
+
+		/**
+		 * \brief Copy buffer with special size to another buffer
+		 * \param buffer destination buffer
+		 * \param length special size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 */
+		void CopyTo(IBufferPtr buffer, int length = -1) const override;
+
+		/**
+		 * \brief Append char to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 */
+		[[maybe_unused]]
+		bool Append(const char& data) override;
+
+		/**
+		 * \brief Append data to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Append(const char* data, int length) override;
+
+		/**
+		 * \brief Insert data to buffer, Only dynamic buffer support this operator
+		 * \param index start index
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Insert(int index, const char* data, int length) override;
+
+		/**
+		 * \brief Clear buffer data, not release, default -1 means all
+		 */
+		void Clear(int length = -1) override;
+
+		/**
+		 * \brief Get buffer length
+		 * \return Current buffer length
+		 */
+		[[nodiscard]]
+		size_t GetLength() const override;
+
+		/**
+		 * \brief Get buffer Memory size
+		 * \return Current buffer Memory used
+		 */
+		[[nodiscard]]
+		size_t GetMemSize() const override;
+
+		/**
+		 * \brief Get buffer raw data ptr
+		 * \return Raw buffer data ptr
+		 */
+		[[nodiscard]]
+		const char* GetData() const override;
+
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		BufferAllocation GetAllocation() const override;
+
+		/**
+		 * \brief Copy buffer with special size
+		 * \param type buffer type
+		 * \param length Copy size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 * \return IBufferPtr
+		 */
+		IBufferPtr CreateBufferCopy(BufferType type, int length = -1) const override;
+
+		/**
+		 * \brief Get buffer Streaming Interface
+		 * \return IStreaming class
+		 */
+		Streaming::IStreaming* GetStreaming() override;
+
+		/**
+		 * \brief Get current position
+		 * \return Current position
+		 */
+		[[nodiscard]]
+		size_t Tell() const override;
+
+		/**
+		 * \brief Read streaming
+		 * \param buffer Read to buffer cache
+		 * \param length Read length
+		 * \return Size successfully read
+		 */
+		[[maybe_unused]]
+		size_t Read(IBuffer* buffer, size_t length) override;
+
+		/**
+		 * \brief Seek to position
+		 * \param offset position offset
+		 * \param seekMode seek mode
+		 * \return new absolute position, if seek failed return -1
+		 */
+		[[maybe_unused]]
+		size_t Seek(int64_t offset, Streaming::SeekMode seekMode = Streaming::SeekMode::SeekSet) override;
+
+		/**
+		 * \brief Get if stream read to end
+		 * \return Is reach EOF
+		 */
+		[[nodiscard]]
+		bool IsEof() const override;
+
+		/**
+		 * \brief Close current streaming
+		 */
+		void Close() override;
+
+	private:
+		/**
+		 * \brief Take handle and map size bytes, handle is closed on failure
+		 */
+		bool Map(SharedMemoryHandle handle, size_t size, bool readOnly);
+
+		/**
+		 * \brief Unmap view, handle is kept
+		 */
+		void Unmap() noexcept;
+
+		char*              Data   = nullptr;
+		size_t             Length = 0;
+		SharedMemoryHandle Handle = InvalidSharedMemoryHandle;
+
+		/**
+		 * \brief Mapped without write access
+		 */
+		bool ReadOnly = false;
+
+		/**
+		 * \brief Memory accounting, mapped bytes of this process
+		 */
+		BufferStatsTracker Stats;
+
+		/**
+		 * \brief Current position
+		 */
+		size_t Position = 0;
+	};
+}
+
+#endif //VISCORE_BUFFER_SHARED_H
@@ -0,0 +1,441 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Spill buffer implementation, growable buffer backed by temporary file
+ * */
+#pragma once
+
+#include "Buffer/Buffer.h"
+#include "Buffer/BufferStatsTracker.h"
+#include "Buffer/SpillOptions.h"
+#include "File/NativeFile.h"
+
+#include "Streaming/Streaming.h"
+
+#include <memory>
+#include <vector>
+
+#ifndef VISCORE_BUFFER_SPILL_H
+#define VISCORE_BUFFER_SPILL_H
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief SpillBuffer, Allow Append()/Insert()/Update(). Data is kept in segments, when
+	 *		  resident segments exceed memory limit the least recently used ones are written to
+	 *		  unnamed temporary file and loaded back on access. Pointers and references are
+	 *		  valid until next call on buffer
+	 */
+	class SpillBuffer : public IBuffer, public Streaming::IStreaming {
+	public:
+		SpillBuffer();
+		explicit SpillBuffer(const SpillOptions& options);
+		~SpillBuffer() override;
+
+		SpillBuffer(SpillBuffer&& other)                 = delete;
+		SpillBuffer(const SpillBuffer& other)            = delete;
+		SpillBuffer& operator=(SpillBuffer&& other)      = delete;
+		SpillBuffer& operator=(const SpillBuffer& other) = delete;
+
+		//--------------- operator -----------------
+
+		/**
+		 * \brief Get char data, spilled segments are loaded and merged into one memory block
+		 *		  that stays resident until next write, costly for large buffer
+		 * \return char data ptr
+		 */
+		char* operator*() override;
+
+		/**
+		 * \brief Get char data
+		 * \return char data ptr
+		 */
+		const char* operator*() const override;
+
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length
+		 * \param position position
+		 * \return char value
+		 */
+		char& operator[](size_t position) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBufferPtr operator+(IBufferPtr& buffer) override;
+
+		/**
+		 * \brief Append buffer with char value
+		 * \param value char data
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+=(char& value) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBuffer* operator+=(IBuffer& buffer) override;
+
+		/**
+		 * \brief Append two buffer
+		 * \param buffer another buffer
+		 * \return new buffer copy(constraint buffer)/current buffer(dynamic buffer)
+		 */
+		IBufferPtr operator+=(IBufferPtr& buffer) override;
+
+		//--------------- function -----------------
+
+		/**
+		 * \brief Get current IBuffer type
+		 * \return Buffer type enum
+		 */
+		[[nodiscard]]
+		BufferType GetType() override;
+
+		/**
+		 * \brief init buffer by given data and size
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 */
+		void InitBuffer(size_t size, char initData) override;
+
+		/**
+		 * \brief init buffer by given data ptr and size
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 */
+		void InitBuffer(const char* ptr, size_t size) override;
+
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Allocate buffer without initialize content, caller fills whole buffer through Update().
+		 *		  Built segment by segment, segments past memory limit are spilled
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void Allocate(size_t size, const BufferAllocation& allocation);
+
+		/**
+		 * \brief Release all buffer Data
+		 */
+		void Release() override;
+
+		/**
+		 * \brief Update buffer region
+		 * \param offset start position
+		 * \param size update size
+		 * \param ptr data ptr
+		 */
+		[[maybe_unused]]
+		bool Update(size_t offset, size_t size, const char* ptr) override;
+
+		/**
+		 * \brief Update several buffer regions in order, buffer grows to cover all regions
+		 * \param regions region array
+		 * \param count region count
+		 * \param threads ignored, regions are written by caller thread
+		 * \return false if any region has no data ptr
+		 */
+		[[maybe_unused]]
+		bool UpdateMany(const UpdateRegion* regions, size_t count, size_t threads = 1) override;
+
+		/**
+		 * \brief Copy buffer with special size to another buffer
+		 * \param buffer destination buffer
+		 * \param length special size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 */
+		void CopyTo(IBufferPtr buffer, int length = -1) const override;
+
+		/**
+		 * \brief Append char to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 */
+		[[maybe_unused]]
+		bool Append(const char& data) override;
+
+		/**
+		 * \brief Append data to buffer, Only dynamic buffer support this operator
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Append(const char* data, int length) override;
+
+		/**
+		 * \brief Insert data to buffer, Only dynamic buffer support this operator
+		 * \param index start index
+		 * \param data char data
+		 * \param length data length
+		 */
+		[[maybe_unused]]
+		bool Insert(int index, const char* data, int length) override;
+
+		/**
+		 * \brief Clear buffer data, not release, default -1 means all
+		 */
+		void Clear(int length = -1) override;
+
+		/**
+		 * \brief Get buffer length
+		 * \return Current buffer length
+		 */
+		[[nodiscard]]
+		size_t GetLength() const override;
+
+		/**
+		 * \brief Get buffer Memory size
+		 * \return Current buffer Memory used
+		 */
+		[[nodiscard]]
+		size_t GetMemSize() const override;
+
+		/**
+		 * \brief Get buffer raw data ptr
+		 * \return Raw buffer data ptr
+		 */
+		[[nodiscard]]
+		const char* GetData() const override;
+
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		BufferAllocation GetAllocation() const override;
+
+		/**
+		 * \brief Copy buffer with special size
+		 * \param type buffer type
+		 * \param length Copy size, default -1 means all,
+		 *				 if length large than buffer size, will use buffer size as length
+		 * \return IBufferPtr
+		 */
+		IBufferPtr CreateBufferCopy(BufferType type, int length = -1) const override;
+
+		/**
+		 * \brief Get buffer Streaming Interface, reads spilled segments without loading them
+		 * \return IStreaming class
+		 */
+		Streaming::IStreaming* GetStreaming() override;
+
+		/**
+		 * \brief Get bytes currently held in temporary file
+		 */
+		[[nodiscard]]
+		size_t GetSpilledSize() const;
+
+		/**
+		 * \brief Get current position
+		 * \return Current position
+		 */
+		[[nodiscard]]
+		size_t Tell() const override;
+
+		/**
+		 * \brief Read streaming, spilled segments are read from file straight into buffer
+		 * \param buffer Read to buffer cache
+		 * \param length Read length
+		 * \return Size successfully read
+		 */
+		[[maybe_unused]]
+		size_t Read(IBuffer* buffer, size_t length) override;
+
+		/**
+		 * \brief Seek to position
+		 * \param offset position offset
+		 * \param seekMode seek mode
+		 * \return new absolute position, if seek failed return -1
+		 */
+		[[maybe_unused]]
+		size_t Seek(int64_t offset, Streaming::SeekMode seekMode = Streaming::SeekMode::SeekSet) override;
+
+		/**
+		 * \brief Get if stream read to end
+		 * \return Is reach EOF
+		 */
+		[[nodiscard]]
+		bool IsEof() const override;
+
+		/**
+		 * \brief Close current streaming
+		 */
+		void Close() override;
+
+	private:
+		/**
+		 * \brief Continuous part of buffer, resident, spilled or both
+		 */
+		struct Segment {
+			/**
+			 * \brief Resident data, nullptr if spilled
+			 */
+			char* Data = nullptr;
+
+			size_t Length   = 0;
+			size_t Capacity = 0;
+
+			/**
+			 * \brief Position of first byte in buffer
+			 */
+			size_t Offset = 0;
+
+			/**
+			 * \brief Slot index in temporary file, -1 if never spilled
+			 */
+			size_t Slot = -1;
+
+			/**
+			 * \brief Access tick, smallest is spilled first
+			 */
+			uint64_t LastUse = 0;
+
+			/**
+			 * \brief Resident data differs from slot
+			 */
+			bool Dirty = false;
+		};
+
+		/**
+		 * \brief Get index of segment holding position, position must be less than length
+		 */
+		size_t Find(size_t position) const;
+
+		/**
+		 * \brief Make segment resident
+		 * \param segment segment to load
+		 * \param read false if caller overwrites whole segment
+		 * \throw std::runtime_error if temporary file read failed
+		 */
+		char* Load(Segment& segment, bool read = true) const;
+
+		/**
+		 * \brief Grow resident segment capacity, doubling up to segment size
+		 */
+		void Reserve(Segment& segment, size_t capacity) const;
+
+		/**
+		 * \brief Write segment to its slot and free memory, larger than segment size is split
+		 * \return false if temporary file can not be created or written
+		 */
+		bool Spill(Segment& segment) const;
+
+		/**
+		 * \brief Free resident memory of segment
+		 */
+		void Unload(Segment& segment) const;
+
+		/**
+		 * \brief Get free slot of temporary file, slot is segment size bytes
+		 */
+		size_t AllocateSlot() const;
+
+		/**
+		 * \brief Spill least recently used segments until under memory limit
+		 * \param keep segment caller still uses
+		 */
+		void Balance(const Segment* keep) const;
+
+		/**
+		 * \brief Copy range into memory without changing what is resident
+		 */
+		void ReadRange(size_t position, char* data, size_t size) const;
+
+		/**
+		 * \brief Copy range to start of other buffer, through Update() unless it is plain contiguous memory
+		 */
+		void CopyRange(size_t position, IBuffer& buffer, size_t size) const;
+
+		/**
+		 * \brief Write range inside current length
+		 */
+		void WriteRange(size_t position, const char* data, size_t size);
+
+		/**
+		 * \brief Append data, nullptr appends fill bytes
+		 */
+		void Grow(const char* data, size_t size, char fill);
+
+		/**
+		 * \brief Merge all segments into one resident segment
+		 */
+		char* Flatten() const;
+
+		/**
+		 * \brief Drop segments, slots and temporary file
+		 */
+		void Reset() const;
+
+		SpillOptions     Options;
+		BufferAllocation Allocation;
+
+		mutable std::vector<std::unique_ptr<Segment>> Segments;
+
+		/**
+		 * \brief Resident segments, order is not kept
+		 */
+		mutable std::vector<Segment*> Resident;
+
+		mutable size_t   ResidentBytes;
+		mutable uint64_t Tick;
+
+		/**
+		 * \brief Last segment found, sequential access skips search
+		 */
+		mutable size_t Cursor;
+
+		/**
+		 * \brief Temporary file, created at first spill
+		 */
+		mutable File::NativeFile SpillFile;
+
+		mutable std::vector<size_t> FreeSlots;
+		mutable size_t              SlotCount;
+
+		size_t Length;
+
+		/**
+		 * \brief Memory accounting, resident bytes only
+		 */
+		mutable BufferStatsTracker Stats;
+
+		/**
+		 * \brief Current position
+		 */
+		size_t Position;
+	};
+}
+
+#endif //VISCORE_BUFFER_SPILL_H
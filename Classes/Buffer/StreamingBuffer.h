@@ -6,10 +6,14 @@
 
 #pragma once
 
+#include "Buffer/BasicBuffer.h"
 #include "Buffer/Buffer.h"
+#include "Buffer/BufferStatsTracker.h"
 
 #include "Streaming/Streaming.h"
 
+#include <memory>
+
 #ifndef VISCORE_BUFFER_STREAMING_H
 #define VISCORE_BUFFER_STREAMING_H
 
@@ -43,7 +47,7 @@ namespace VisCore::Buffer {
 		const char* operator*() const override;
 
 		/**
-		 * \brief Get char by position
+		 * \brief Get char by position, throw std::out_of_range if position >= length
 		 * \param position position
 		 * \return char value
 		 */
@@ -114,6 +118,29 @@ namespace VisCore::Buffer {
 		 */
 		void InitBuffer(const char* ptr, size_t size) override;
 
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) override;
+
+		/**
+		 * \brief Allocate buffer without initialize content, caller fills whole buffer
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void Allocate(size_t size, const BufferAllocation& allocation);
+
 		/**
 		 * \brief Release all buffer Data
 		 */
@@ -186,6 +213,13 @@ namespace VisCore::Buffer {
 		[[nodiscard]]
 		const char* GetData() const override;
 
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		BufferAllocation GetAllocation() const override;
+
 		/**
 		 * \brief Copy buffer with special size
 		 * \param type buffer type
@@ -240,14 +274,20 @@ namespace VisCore::Buffer {
 
 	private:
 		/**
-		 * \brief Data ptr
+		 * \brief Report bytes of new storage, storage still shared with copies keeps their tracker
+		 * \param bytes allocated bytes, 0 means released
+		 */
+		void Track(size_t bytes);
+
+		/**
+		 * \brief Buffer core, copies share same memory
 		 */
-		std::shared_ptr<char[]> Data;
+		BasicStreamingBuffer Core;
 
 		/**
-		 * \brief Buffer size
+		 * \brief Memory accounting, shared by copies so shared storage is counted once
 		 */
-		size_t Size;
+		std::shared_ptr<BufferStatsTracker> Stats;
 
 		/**
 		 * \brief Current position
@@ -0,0 +1,148 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * File stream implementation
+ * */
+
+#pragma once
+
+#include "Buffer/BasicBuffer.h"
+#include "File/File.h"
+#include "File/NativeFile.h"
+
+#ifndef VISCORE_FILE_STREAM_H
+#define VISCORE_FILE_STREAM_H
+
+namespace VisCore::File {
+	/**
+	 * \brief Unbuffered file stream, every call maps to positional OS I/O.
+	 *		  Direct mode keeps offset, size and memory aligned to NativeFile::DirectAlignment,
+	 *		  unaligned head and tail are staged in an aligned block
+	 */
+	class FileStream : public IFile {
+	public:
+		FileStream(NativeFile&& file, FileMode mode, FileAccess access, FileType type);
+		~FileStream() override;
+
+		FileStream(FileStream&& other) = delete;
+		FileStream(const FileStream& other) = delete;
+
+		FileStream& operator=(FileStream&& other) = delete;
+		FileStream& operator=(const FileStream& other) = delete;
+
+		//--------------- IStreaming -----------------
+
+		/**
+		 * \brief Get current position
+		 * \return Current position
+		 */
+		[[nodiscard]]
+		size_t Tell() const override;
+
+		/**
+		 * \brief Read streaming
+		 * \param buffer Read to buffer cache
+		 * \param length Read length, if length large than buffer size, will use buffer size as length
+		 * \return Size successfully read, -1 if failed
+		 */
+		size_t Read(Buffer::IBuffer* buffer, size_t length) override;
+
+		/**
+		 * \brief Seek to position, position after end of file is allowed
+		 * \param offset position offset
+		 * \param seekMode seek mode
+		 * \return new absolute position, if seek failed return -1
+		 */
+		size_t Seek(int64_t offset, Streaming::SeekMode seekMode) override;
+
+		/**
+		 * \brief Get if stream read to end
+		 * \return Is reach EOF
+		 */
+		[[nodiscard]]
+		bool IsEof() const override;
+
+		/**
+		 * \brief Close file
+		 */
+		void Close() override;
+
+		//--------------- IFile -----------------
+
+		size_t Write(const char* data, size_t length) override;
+
+		size_t Write(const Buffer::IBuffer* buffer, size_t length) override;
+
+		size_t ReadAt(uint64_t offset, char* data, size_t length) override;
+
+		size_t WriteAt(uint64_t offset, const char* data, size_t length) override;
+
+		[[nodiscard]]
+		size_t GetSize() const override;
+
+		bool Flush() override;
+
+		bool Sync() override;
+
+		[[nodiscard]]
+		bool IsDirect() const override;
+
+		[[nodiscard]]
+		FileMode GetMode() const override;
+
+		[[nodiscard]]
+		FileAccess GetAccess() const override;
+
+		[[nodiscard]]
+		FileType GetType() const override;
+
+		//--------------- FileStream -----------------
+
+		/**
+		 * \brief Get OS handle for kernel side copy, all I/O of this class is positional so
+		 *		  file position of handle is free to use
+		 */
+		[[nodiscard]]
+		NativeFile::NativeHandle GetHandle() const noexcept {
+			return Native.GetHandle();
+		}
+
+	private:
+		/**
+		 * \brief Read through aligned blocks
+		 */
+		size_t DirectRead(uint64_t offset, char* data, size_t length);
+
+		/**
+		 * \brief Write through aligned blocks, partial blocks are merged with file content
+		 */
+		size_t DirectWrite(uint64_t offset, const char* data, size_t length);
+
+		/**
+		 * \brief Get aligned staging block, allocated on first use
+		 */
+		char* GetStaging();
+
+		[[nodiscard]]
+		bool CanRead() const noexcept;
+
+		[[nodiscard]]
+		bool CanWrite() const noexcept;
+
+		NativeFile                    Native;
+		Buffer::BasicConstraintBuffer Staging;
+		size_t                        Position = 0;
+		FileMode                      Mode;
+		FileAccess                    Access;
+		FileType                      Type;
+	};
+
+	/**
+	 * \brief Read file range into start of buffer for IFile::Read(). Types other than plain
+	 *		  contiguous buffers are written through Update() from an aligned bounce block
+	 * \return bytes read, -1 if failed
+	 */
+	size_t ReadToBuffer(IFile& file, uint64_t offset, Buffer::IBuffer& buffer, size_t length);
+}
+
+#endif //VISCORE_FILE_STREAM_H
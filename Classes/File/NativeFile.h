@@ -0,0 +1,128 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Platform file handle with positional I/O
+ * */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "File/FileAccess.h"
+#include "File/FileMode.h"
+
+#ifndef VISCORE_FILE_NATIVE_H
+#define VISCORE_FILE_NATIVE_H
+
+namespace VisCore::File {
+	/**
+	 * \brief Thin wrapper of OS file handle, all I/O is positional so ReadAt()/WriteAt() can be called by threads
+	 */
+	class NativeFile {
+	public:
+		#if defined(_WIN32)
+		typedef void* NativeHandle;
+		#else
+		typedef int NativeHandle;
+		#endif
+
+		/**
+		 * \brief Offset, size and memory alignment required by direct I/O
+		 */
+		static constexpr size_t DirectAlignment = 4096;
+
+		NativeFile() noexcept = default;
+		~NativeFile();
+
+		NativeFile(NativeFile&& other) noexcept;
+		NativeFile(const NativeFile& other) = delete;
+
+		NativeFile& operator=(NativeFile&& other) noexcept;
+		NativeFile& operator=(const NativeFile& other) = delete;
+
+		/**
+		 * \brief Open file, direct open falls back to cached open if not supported
+		 * \param path file path
+		 * \param mode open mode, Append only creates file, caller handles position
+		 * \param access file access, direct write opens read/write for head and tail merge
+		 * \param direct bypass OS page cache
+		 * \return false if open failed
+		 */
+		bool Open(const char* path, FileMode mode, FileAccess access, bool direct);
+
+		/**
+		 * \brief Create read/write scratch file that has no name and is deleted when closed,
+		 *		  unnamed O_TMPFILE on Linux, unlinked right after create on other POSIX systems
+		 * \param directory parent directory, nullptr or empty uses TMPDIR or system temp directory
+		 * \return false if create failed
+		 */
+		bool OpenTemporary(const char* directory);
+
+		/**
+		 * \brief Close handle
+		 */
+		void Close() noexcept;
+
+		[[nodiscard]]
+		bool IsOpen() const noexcept;
+
+		/**
+		 * \brief Get if handle bypass OS page cache
+		 */
+		[[nodiscard]]
+		bool IsDirect() const noexcept {
+			return Direct.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * \brief Read until length or end of file, direct handle switch to cached I/O if request rejected
+		 * \return size read, -1 if failed
+		 */
+		size_t ReadAt(uint64_t offset, char* data, size_t length) noexcept;
+
+		/**
+		 * \brief Write whole length, direct handle switch to cached I/O if request rejected
+		 * \return size written, -1 if failed
+		 */
+		size_t WriteAt(uint64_t offset, const char* data, size_t length) noexcept;
+
+		/**
+		 * \brief Get file size, -1 if failed
+		 */
+		[[nodiscard]]
+		uint64_t GetSize() const noexcept;
+
+		/**
+		 * \brief Truncate or extend file
+		 */
+		bool SetSize(uint64_t size) noexcept;
+
+		/**
+		 * \brief Wait written data reach device
+		 */
+		bool Sync() noexcept;
+
+		[[nodiscard]]
+		NativeHandle GetHandle() const noexcept {
+			return Handle;
+		}
+
+	private:
+		/**
+		 * \brief Switch handle to cached I/O
+		 */
+		bool DisableDirect() noexcept;
+
+		#if defined(_WIN32)
+		NativeHandle Handle = nullptr;
+		#else
+		NativeHandle Handle = -1;
+		#endif
+		FileAccess        Access = FileAccess::Read;
+		std::atomic<bool> Direct{false};
+	};
+}
+
+#endif //VISCORE_FILE_NATIVE_H
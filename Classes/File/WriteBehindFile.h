@@ -0,0 +1,139 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Write behind file implementation
+ * */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Buffer/BasicBuffer.h"
+#include "File/File.h"
+#include "File/FileStream.h"
+
+#ifndef VISCORE_FILE_WRITE_BEHIND_H
+#define VISCORE_FILE_WRITE_BEHIND_H
+
+namespace VisCore::File {
+	/**
+	 * \brief File sink, Write() appends into memory blocks while a background thread writes
+	 *		  full blocks to file. Reads, WriteAt() and Seek() wait for pending blocks first.
+	 *		  Errors of background writes are reported by next Write()/Flush()
+	 */
+	class WriteBehindFile : public IFile {
+	public:
+		WriteBehindFile(std::unique_ptr<FileStream> stream, const FileOptions& options);
+		~WriteBehindFile() override;
+
+		WriteBehindFile(WriteBehindFile&& other) = delete;
+		WriteBehindFile(const WriteBehindFile& other) = delete;
+
+		WriteBehindFile& operator=(WriteBehindFile&& other) = delete;
+		WriteBehindFile& operator=(const WriteBehindFile& other) = delete;
+
+		//--------------- IStreaming -----------------
+
+		[[nodiscard]]
+		size_t Tell() const override;
+
+		size_t Read(Buffer::IBuffer* buffer, size_t length) override;
+
+		size_t Seek(int64_t offset, Streaming::SeekMode seekMode) override;
+
+		[[nodiscard]]
+		bool IsEof() const override;
+
+		/**
+		 * \brief Flush pending blocks, stop background thread and close file
+		 */
+		void Close() override;
+
+		//--------------- IFile -----------------
+
+		size_t Write(const char* data, size_t length) override;
+
+		size_t Write(const Buffer::IBuffer* buffer, size_t length) override;
+
+		size_t ReadAt(uint64_t offset, char* data, size_t length) override;
+
+		size_t WriteAt(uint64_t offset, const char* data, size_t length) override;
+
+		/**
+		 * \brief Get file size, include data still pending in memory
+		 */
+		[[nodiscard]]
+		size_t GetSize() const override;
+
+		/**
+		 * \brief Wait until every written byte reached OS
+		 * \return false if any background write failed
+		 */
+		bool Flush() override;
+
+		bool Sync() override;
+
+		[[nodiscard]]
+		bool IsDirect() const override;
+
+		[[nodiscard]]
+		FileMode GetMode() const override;
+
+		[[nodiscard]]
+		FileAccess GetAccess() const override;
+
+		[[nodiscard]]
+		FileType GetType() const override;
+
+	private:
+		/**
+		 * \brief Memory block of one contiguous file range
+		 */
+		struct Block {
+			Buffer::BasicConstraintBuffer Data;
+			uint64_t                      Offset = 0;
+			size_t                        Used   = 0;
+		};
+
+		static constexpr size_t NoBlock = static_cast<size_t>(-1);
+
+		/**
+		 * \brief Queue current block for background write
+		 */
+		void Submit();
+
+		/**
+		 * \brief Get free block for offset, wait if every block is pending
+		 */
+		void Acquire(uint64_t offset);
+
+		/**
+		 * \brief Background thread loop
+		 */
+		void Run();
+
+		std::unique_ptr<FileStream> Stream;
+		std::vector<Block>          Blocks;
+		size_t                      BlockSize;
+		std::deque<size_t>          Pending;
+		std::vector<size_t>         Free;
+		size_t                      Current  = NoBlock;
+		size_t                      Position = 0;
+		uint64_t                    End      = 0;
+
+		std::mutex              Mutex;
+		std::condition_variable WorkReady;
+		std::condition_variable BlockDone;
+		bool                    Busy     = false;
+		bool                    Stopping = false;
+		bool                    Failed   = false;
+		std::thread             Worker;
+	};
+}
+
+#endif //VISCORE_FILE_WRITE_BEHIND_H
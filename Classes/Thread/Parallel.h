@@ -0,0 +1,30 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Parallel helper used by buffer bulk operations
+ * */
+#pragma once
+
+#ifndef VISCORE_THREAD_PARALLEL_H
+#define VISCORE_THREAD_PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+
+namespace VisCore::Thread {
+	/**
+	 * \brief Get worker count used when caller pass 0 as thread count
+	 * \return hardware concurrency, at least 1
+	 */
+	size_t GetDefaultThreadCount();
+
+	/**
+	 * \brief Run task(0) ... task(count - 1) on default thread pool, task(0) runs on calling thread.
+	 *        Return after all tasks finished, tasks may share a worker when count exceeds pool size
+	 * \param count task count
+	 * \param task task function, receive task index
+	 */
+	void ParallelInvoke(size_t count, const std::function<void(size_t)>& task);
+}
+
+#endif //VISCORE_THREAD_PARALLEL_H
@@ -0,0 +1,369 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Header only buffer core, non-virtual and inlinable
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_BASIC_H
+#define VISCORE_BUFFER_BASIC_H
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "BufferStorage.h"
+#include "Span.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Non-virtual buffer core. IBuffer implementations wrap one of these,
+	 *		  performance sensitive code can use the static type directly.
+	 *		  Data is always followed by a '\0' terminator which is not part of length
+	 * \tparam StoragePolicy memory owner, see BufferStorage.h
+	 * \tparam GrowthPolicy FixedGrowth or DynamicGrowth
+	 */
+	template<typename StoragePolicy, typename GrowthPolicy>
+	class BasicBuffer {
+	public:
+		using value_type      = char;
+		using size_type       = size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference       = char&;
+		using const_reference = const char&;
+		using iterator        = char*;
+		using const_iterator  = const char*;
+
+		static constexpr bool CanGrow = GrowthPolicy::CanGrow;
+
+		BasicBuffer() = default;
+		~BasicBuffer() = default;
+
+		BasicBuffer(BasicBuffer&& other) noexcept
+			: Storage(std::move(other.Storage)), Size(std::exchange(other.Size, 0)) {
+		}
+
+		BasicBuffer(const BasicBuffer& other) = default;
+
+		BasicBuffer& operator=(BasicBuffer&& other) noexcept {
+			if (&other == this)
+				return *this;
+
+			Storage = std::move(other.Storage);
+			Size    = std::exchange(other.Size, 0);
+			return *this;
+		}
+
+		BasicBuffer& operator=(const BasicBuffer& other) = default;
+
+		//--------------- access -----------------
+
+		/**
+		 * \brief Get char by position, no range check
+		 */
+		constexpr char& operator[](const size_t position) noexcept {
+			return Storage.GetData()[position];
+		}
+
+		/**
+		 * \brief Get char by position, no range check
+		 */
+		constexpr const char& operator[](const size_t position) const noexcept {
+			return Storage.GetData()[position];
+		}
+
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length
+		 */
+		constexpr char& At(const size_t position) {
+			if (position >= Size)
+				throw std::out_of_range("Access buffer out of range!!!");
+
+			return Storage.GetData()[position];
+		}
+
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length
+		 */
+		constexpr const char& At(const size_t position) const {
+			if (position >= Size)
+				throw std::out_of_range("Access buffer out of range!!!");
+
+			return Storage.GetData()[position];
+		}
+
+		[[nodiscard]]
+		constexpr char* GetData() noexcept {
+			return Storage.GetData();
+		}
+
+		[[nodiscard]]
+		constexpr const char* GetData() const noexcept {
+			return Storage.GetData();
+		}
+
+		[[nodiscard]]
+		constexpr size_t GetLength() const noexcept {
+			return Size;
+		}
+
+		/**
+		 * \brief Get allocated bytes, include terminator and reserved space
+		 */
+		[[nodiscard]]
+		constexpr size_t GetCapacity() const noexcept {
+			return Storage.GetCapacity();
+		}
+
+		/**
+		 * \brief Get alignment and huge page options, heap storage only
+		 */
+		[[nodiscard]]
+		const BufferAllocation& GetAllocation() const noexcept {
+			return Storage.GetAllocation();
+		}
+
+		[[nodiscard]]
+		constexpr Span<const char> GetSpan() const noexcept {
+			return Span<const char>(Storage.GetData(), Size);
+		}
+
+		[[nodiscard]]
+		constexpr Span<char> GetWritableSpan() noexcept {
+			return Span<char>(Storage.GetData(), Size);
+		}
+
+		constexpr iterator begin() noexcept {
+			return Storage.GetData();
+		}
+
+		constexpr iterator end() noexcept {
+			return Storage.GetData() + Size;
+		}
+
+		constexpr const_iterator begin() const noexcept {
+			return Storage.GetData();
+		}
+
+		constexpr const_iterator end() const noexcept {
+			return Storage.GetData() + Size;
+		}
+
+		//--------------- modify -----------------
+
+		/**
+		 * \brief Allocate buffer without initialize content
+		 * \param size Buffer size
+		 */
+		void Allocate(const size_t size) {
+			Storage.Allocate(size + 1);
+			Size = size;
+			Storage.GetData()[Size] = '\0';
+		}
+
+		/**
+		 * \brief Allocate buffer with given alignment and huge page options, heap storage only.
+		 *		  Options are kept for later allocations of this buffer
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void Allocate(const size_t size, const BufferAllocation& allocation) {
+			Storage.SetAllocation(allocation);
+			Size = 0;
+			Allocate(size);
+		}
+
+		/**
+		 * \brief Init buffer by given data and size
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 */
+		void InitBuffer(const size_t size, const char initData) {
+			Allocate(size);
+			memset(Storage.GetData(), initData, Size);
+		}
+
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const size_t size, const char initData, const BufferAllocation& allocation) {
+			Allocate(size, allocation);
+			memset(Storage.GetData(), initData, Size);
+		}
+
+		/**
+		 * \brief Init buffer by given data ptr and size
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 */
+		void InitBuffer(const char* ptr, const size_t size) {
+			Allocate(size);
+			if (Size)
+				memcpy(Storage.GetData(), ptr, Size);
+		}
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		void InitBuffer(const char* ptr, const size_t size, const BufferAllocation& allocation) {
+			Allocate(size, allocation);
+			if (Size)
+				memcpy(Storage.GetData(), ptr, Size);
+		}
+
+		/**
+		 * \brief Release all buffer data
+		 */
+		void Release() noexcept {
+			Storage.Release();
+			Size = 0;
+		}
+
+		/**
+		 * \brief Update buffer region, growable buffer extends to cover the region
+		 * \param offset start position
+		 * \param size update size
+		 * \param ptr data ptr
+		 * \return false if region out of range for fixed buffer
+		 */
+		bool Update(const size_t offset, const size_t size, const char* ptr) {
+			if (offset + size > Size) {
+				if constexpr (!CanGrow) {
+					return false;
+				} else {
+					// gap between old end and offset reads as zero
+					const auto oldSize = Size;
+					Extend(offset + size);
+					if (offset > oldSize)
+						memset(Storage.GetData() + oldSize, 0, offset - oldSize);
+				}
+			}
+
+			if (!Storage.GetData())
+				return false;
+
+			memcpy(Storage.GetData() + offset, ptr, size);
+			return true;
+		}
+
+		/**
+		 * \brief Append data, only growable buffer support this operator
+		 */
+		bool Append(const char* data, const size_t length) {
+			if constexpr (!CanGrow) {
+				return false;
+			} else {
+				const auto oldSize = Size;
+				Extend(Size + length);
+				if (length)
+					memcpy(Storage.GetData() + oldSize, data, length);
+				return true;
+			}
+		}
+
+		/**
+		 * \brief Append char, only growable buffer support this operator
+		 */
+		bool Append(const char data) {
+			return Append(&data, 1);
+		}
+
+		/**
+		 * \brief Insert data before index, only growable buffer support this operator
+		 */
+		bool Insert(const size_t index, const char* data, const size_t length) {
+			if constexpr (!CanGrow) {
+				return false;
+			} else {
+				if (index > Size)
+					return false;
+
+				const auto oldSize = Size;
+				Extend(Size + length);
+				auto* base = Storage.GetData();
+				memmove(base + index + length, base + index, oldSize - index);
+				if (length)
+					memcpy(base + index, data, length);
+				return true;
+			}
+		}
+
+		/**
+		 * \brief Change length, keep content, new bytes are zero.
+		 *		  Only growable buffer support grow, shrink is always allowed
+		 * \return false if grow is not allowed
+		 */
+		bool Resize(const size_t size) {
+			if (size > Size) {
+				if constexpr (!CanGrow) {
+					return false;
+				} else {
+					const auto oldSize = Size;
+					Extend(size);
+					memset(Storage.GetData() + oldSize, 0, size - oldSize);
+					return true;
+				}
+			}
+
+			Size = size;
+			if (Storage.GetData())
+				Storage.GetData()[Size] = '\0';
+			return true;
+		}
+
+		/**
+		 * \brief Zero first length bytes, not release
+		 * \param length clear size, clamped to buffer length
+		 */
+		void Clear(const size_t length) noexcept {
+			if (!Storage.GetData() || Size == 0)
+				return;
+
+			memset(Storage.GetData(), 0, length > Size ? Size : length);
+		}
+
+	private:
+		/**
+		 * \brief Grow length to size, new bytes are not initialized
+		 */
+		void Extend(const size_t size) {
+			if (size + 1 > Storage.GetCapacity())
+				Storage.Reserve(GrowthPolicy::NextCapacity(Storage.GetCapacity(), size + 1));
+
+			Size = size;
+			Storage.GetData()[Size] = '\0';
+		}
+
+		StoragePolicy Storage;
+		size_t        Size = 0;
+	};
+
+	/**
+	 * \brief Alloc only once, Disallow Append()/Insert(), Allow Update()
+	 */
+	typedef BasicBuffer<UniqueStorage, FixedGrowth> BasicConstraintBuffer;
+
+	/**
+	 * \brief Alloc dynamic, Allow Append()/Insert()/Update()
+	 */
+	typedef BasicBuffer<HeapStorage, DynamicGrowth> BasicDynamicBuffer;
+
+	/**
+	 * \brief Alloc only once, copies share same memory
+	 */
+	typedef BasicBuffer<SharedStorage, FixedGrowth> BasicStreamingBuffer;
+
+	/**
+	 * \brief Fixed size in-place buffer, no heap allocation
+	 */
+	template<size_t Size>
+	using BasicInlineBuffer = BasicBuffer<InlineStorage<Size + 1>, FixedGrowth>;
+}
+
+#endif //VISCORE_BUFFER_BASIC_H
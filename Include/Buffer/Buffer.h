@@ -10,8 +10,12 @@
 #define VISCORE_BUFFER_H
 
 #include <memory>
+#include <stdexcept>
 
+#include "BufferAllocation.h"
 #include "BufferType.h"
+#include "Span.h"
+#include "UpdateRegion.h"
 #include "VisCoreExport.generate.h"
 
 namespace VisCore {
@@ -26,8 +30,18 @@ namespace VisCore::Buffer {
 
 	VIS_CORE_EXPORTS IBufferPtr CreateBuffer(BufferType type, size_t size, char initData);
 	VIS_CORE_EXPORTS IBufferPtr CreateBuffer(BufferType type, const char* ptr, size_t size);
-
-	class VIS_CORE_EXPORTS IBuffer {
+	VIS_CORE_EXPORTS IBufferPtr CreateBuffer(BufferType type, size_t size, char initData, const BufferAllocation& allocation);
+	VIS_CORE_EXPORTS IBufferPtr CreateBuffer(BufferType type, const char* ptr, size_t size, const BufferAllocation& allocation);
+
+	/**
+	 * \brief Create concat buffer that reference both operands without copy, see BufferType::Concat
+	 * \param left first operand
+	 * \param right second operand
+	 * \return IBufferPtr
+	 */
+	VIS_CORE_EXPORTS IBufferPtr CreateConcatBuffer(const IBufferPtr& left, const IBufferPtr& right);
+
+	class VIS_CORE_EXPORTS IBuffer : public std::enable_shared_from_this<IBuffer> {
 	public:
 		IBuffer() = default;
 		virtual ~IBuffer() = default;
@@ -53,12 +67,110 @@ namespace VisCore::Buffer {
 		virtual const char* operator*() const = 0;
 
 		/**
-		 * \brief Get char by position
+		 * \brief Get char by position, throw std::out_of_range if position >= length
 		 * \param position position
 		 * \return char value
 		 */
 		virtual char& operator[](size_t position) = 0;
 
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length
+		 * \param position position
+		 * \return char value
+		 */
+		char& At(const size_t position) {
+			const auto span = GetWritableSpan();
+			if (position >= span.size())
+				throw std::out_of_range("Access buffer out of range!!!");
+
+			return span[position];
+		}
+
+		/**
+		 * \brief Get char by position, throw std::out_of_range if position >= length
+		 * \param position position
+		 * \return char value
+		 */
+		[[nodiscard]]
+		const char& At(const size_t position) const {
+			const auto span = GetSpan();
+			if (position >= span.size())
+				throw std::out_of_range("Access buffer out of range!!!");
+
+			return span[position];
+		}
+
+		/**
+		 * \brief Get char by position without range check, caller must keep position < length and
+		 *		  buffer writable, read only shared buffer has no writable memory (GetWritableSpan() is empty)
+		 * \param position position
+		 * \return char value
+		 */
+		char& Unchecked(const size_t position) noexcept {
+			return (**this)[position];
+		}
+
+		/**
+		 * \brief Get char by position without range check, caller must keep position < length
+		 * \param position position
+		 * \return char value
+		 */
+		[[nodiscard]]
+		const char& Unchecked(const size_t position) const noexcept {
+			return GetData()[position];
+		}
+
+		/**
+		 * \brief Get read only view of whole buffer, query once and use it for bulk access
+		 * \return span of buffer data
+		 */
+		[[nodiscard]]
+		Span<const char> GetSpan() const {
+			return Span<const char>(GetData(), GetLength());
+		}
+
+		/**
+		 * \brief Get writable view of whole buffer, query once and use it for bulk access.
+		 *		  View is invalid after any operator that resize buffer
+		 * \return span of buffer data, empty if buffer has no writable memory
+		 */
+		[[nodiscard]]
+		Span<char> GetWritableSpan() {
+			auto* data = **this;
+			return Span<char>(data, data ? GetLength() : 0);
+		}
+
+		/**
+		 * \brief Random access iterator, usable with <algorithm>
+		 */
+		char* begin() {
+			return GetWritableSpan().data();
+		}
+
+		/**
+		 * \brief Random access iterator, usable with <algorithm>, same as begin() if buffer has no writable memory
+		 */
+		char* end() {
+			const auto span = GetWritableSpan();
+			return span.data() + span.size();
+		}
+
+		/**
+		 * \brief Random access iterator, usable with <algorithm>
+		 */
+		[[nodiscard]]
+		const char* begin() const {
+			return GetData();
+		}
+
+		/**
+		 * \brief Random access iterator, usable with <algorithm>
+		 */
+		[[nodiscard]]
+		const char* end() const {
+			return GetData() + GetLength();
+		}
+
 		/**
 		 * \brief Append buffer with char value
 		 * \param value char data
@@ -124,6 +236,24 @@ namespace VisCore::Buffer {
 		 */
 		virtual void InitBuffer(const char* ptr, size_t size) = 0;
 
+		/**
+		 * \brief Init buffer by given data and size with alignment and huge page options,
+		 *		  options are kept for later allocations of this buffer
+		 * \param size Buffer size
+		 * \param initData data to fill
+		 * \param allocation alignment and huge page options
+		 */
+		virtual void InitBuffer(size_t size, char initData, const BufferAllocation& allocation) = 0;
+
+		/**
+		 * \brief Init buffer by given data ptr and size with alignment and huge page options,
+		 *		  options are kept for later allocations of this buffer
+		 * \param ptr data ptr
+		 * \param size Buffer size
+		 * \param allocation alignment and huge page options
+		 */
+		virtual void InitBuffer(const char* ptr, size_t size, const BufferAllocation& allocation) = 0;
+
 		/**
 		 * \brief Release all buffer Data
 		 */
@@ -138,6 +268,17 @@ namespace VisCore::Buffer {
 		[[maybe_unused]]
 		virtual bool Update(size_t offset, size_t size, const char* ptr) = 0;
 
+		/**
+		 * \brief Update several buffer regions in one pass. Whole batch is validated before any write,
+		 *		  regions are sorted and adjacent ones coalesced, overlapped regions keep Update() order
+		 * \param regions region array
+		 * \param count region count
+		 * \param threads max worker count when total payload is large, 0 means hardware concurrency
+		 * \return false if any region out of range, nothing is written in this case
+		 */
+		[[maybe_unused]]
+		virtual bool UpdateMany(const UpdateRegion* regions, size_t count, size_t threads = 1);
+
 		/**
 		 * \brief Copy buffer with special size to another buffer
 		 * \param buffer destination buffer
@@ -196,6 +337,13 @@ namespace VisCore::Buffer {
 		[[nodiscard]]
 		virtual const char* GetData() const = 0;
 
+		/**
+		 * \brief Get buffer alignment and huge page options
+		 * \return allocation options
+		 */
+		[[nodiscard]]
+		virtual BufferAllocation GetAllocation() const = 0;
+
 		/**
 		 * \brief Create sub buffer copy with special size
 		 * \param type buffer type
@@ -0,0 +1,88 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Buffer memory alignment and huge page options
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_ALLOCATION_H
+#define VISCORE_BUFFER_ALLOCATION_H
+
+#include <cstddef>
+
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Huge page size used when BufferAllocation::HugePages is set
+	 */
+	constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+	/**
+	 * \brief How buffer memory is allocated
+	 */
+	struct BufferAllocation {
+		/**
+		 * \brief Data alignment in bytes, power of two, e.g. 64 for SIMD, 4096 for O_DIRECT.
+		 *		  0 means default malloc alignment
+		 */
+		size_t Alignment = 0;
+
+		/**
+		 * \brief Back allocations of at least HugePageSize with transparent huge pages,
+		 *		  block is aligned and rounded to HugePageSize. Ignored where not supported
+		 */
+		bool HugePages = false;
+
+		/**
+		 * \brief Get if alignment is 0 or power of two
+		 */
+		[[nodiscard]]
+		constexpr bool IsValid() const noexcept {
+			return (Alignment & (Alignment - 1)) == 0;
+		}
+
+		/**
+		 * \brief Get if plain malloc already satisfies this allocation, invalid alignment is never default
+		 */
+		[[nodiscard]]
+		constexpr bool IsDefault() const noexcept {
+			return IsValid() && Alignment <= alignof(std::max_align_t) && !HugePages;
+		}
+
+		constexpr bool operator==(const BufferAllocation& other) const noexcept {
+			return Alignment == other.Alignment && HugePages == other.HugePages;
+		}
+
+		constexpr bool operator!=(const BufferAllocation& other) const noexcept {
+			return !(*this == other);
+		}
+	};
+
+	/**
+	 * \brief Allocate buffer memory
+	 * \param bytes allocation size
+	 * \param allocation alignment and huge page options
+	 * \return memory ptr, throw std::bad_alloc on failure or invalid alignment
+	 */
+	VIS_CORE_EXPORTS char* AllocateMemory(size_t bytes, const BufferAllocation& allocation);
+
+	/**
+	 * \brief Grow memory block, old content is kept. Default allocation uses realloc
+	 * \param data memory from AllocateMemory() with same allocation, may be nullptr
+	 * \param oldBytes current block size
+	 * \param bytes new block size
+	 * \param allocation alignment and huge page options
+	 * \return new memory ptr, throw std::bad_alloc on failure and data stays valid
+	 */
+	VIS_CORE_EXPORTS char* ReallocateMemory(char* data, size_t oldBytes, size_t bytes, const BufferAllocation& allocation);
+
+	/**
+	 * \brief Free memory from AllocateMemory()/ReallocateMemory()
+	 * \param data memory ptr, may be nullptr
+	 * \param allocation options used to allocate data
+	 */
+	VIS_CORE_EXPORTS void FreeMemory(char* data, const BufferAllocation& allocation) noexcept;
+}
+
+#endif //VISCORE_BUFFER_ALLOCATION_H
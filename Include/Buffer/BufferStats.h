@@ -0,0 +1,105 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Process wide buffer memory accounting
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_STATS_H
+#define VISCORE_BUFFER_STATS_H
+
+#include <cstdint>
+#include <ostream>
+
+#include "BufferType.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Memory counters of one buffer type
+	 */
+	struct BufferTypeStats {
+		/**
+		 * \brief Buffers currently holding memory
+		 */
+		uint64_t LiveBuffers;
+
+		/**
+		 * \brief Bytes currently allocated
+		 */
+		uint64_t LiveBytes;
+
+		/**
+		 * \brief Max LiveBytes since last reset
+		 */
+		uint64_t PeakBytes;
+
+		/**
+		 * \brief Buffers acquired memory since last reset
+		 */
+		uint64_t Allocations;
+
+		/**
+		 * \brief Buffers released memory since last reset
+		 */
+		uint64_t Releases;
+
+		/**
+		 * \brief Allocations per second since last reset
+		 */
+		double AllocationsPerSecond;
+
+		/**
+		 * \brief Average lifetime of buffers released since last reset, in milliseconds
+		 */
+		double AverageLifetimeMs;
+	};
+
+	/**
+	 * \brief Snapshot of buffer memory counters
+	 */
+	struct BufferStats {
+		/**
+		 * \brief Counters by type, index by static_cast<size_t>(BufferType)
+		 */
+		BufferTypeStats Types[BufferTypeCount];
+
+		/**
+		 * \brief Counters of all types
+		 */
+		BufferTypeStats Total;
+
+		/**
+		 * \brief Seconds since last reset
+		 */
+		double ElapsedSeconds;
+
+		[[nodiscard]]
+		const BufferTypeStats& operator[](const BufferType type) const {
+			return Types[static_cast<size_t>(type)];
+		}
+	};
+
+	/**
+	 * \brief Get snapshot of buffer memory counters, counters are relaxed so a snapshot
+	 *		  taken while other threads allocate may be slightly inconsistent
+	 * \return counters snapshot
+	 */
+	VIS_CORE_EXPORTS BufferStats GetBufferStats();
+
+	/**
+	 * \brief Reset allocation/release counters and rate timer, peak restarts from current live bytes.
+	 *		  Live counters are not changed
+	 */
+	VIS_CORE_EXPORTS void ResetBufferStats();
+
+	/**
+	 * \brief Dump CreateBuffer()/IBuffer::Create() call sites with most allocated bytes.
+	 *		  Only record when library is built with VIS_CORE_TRACK_ALLOCATION_SITES
+	 * \param stream output stream
+	 * \param top max site count
+	 */
+	VIS_CORE_EXPORTS void DumpBufferAllocationSites(std::ostream& stream, size_t top = 10);
+}
+
+#endif //VISCORE_BUFFER_STATS_H
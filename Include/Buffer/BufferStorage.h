@@ -0,0 +1,360 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Storage and growth policies for BasicBuffer
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_STORAGE_H
+#define VISCORE_BUFFER_STORAGE_H
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "BufferAllocation.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Storage policy contract used by BasicBuffer:
+	 *		  GetData()			- raw data ptr, nullptr when nothing allocated
+	 *		  GetCapacity()		- allocated bytes
+	 *		  Allocate(bytes)	- allocate bytes, old content is dropped
+	 *		  Reserve(bytes)	- grow to at least bytes, old content is kept (growable buffer only)
+	 *		  Release()			- free all memory
+	 *		  Heap storages also provide GetAllocation()/SetAllocation(), which apply from next Allocate()
+	 */
+
+	/**
+	 * \brief Heap storage owned by one buffer, copy makes deep copy
+	 */
+	class UniqueStorage {
+	public:
+		UniqueStorage() noexcept = default;
+
+		~UniqueStorage() {
+			Release();
+		}
+
+		UniqueStorage(UniqueStorage&& other) noexcept
+			: Data(std::exchange(other.Data, nullptr)), Capacity(std::exchange(other.Capacity, 0)),
+			  Allocation(other.Allocation) {
+		}
+
+		UniqueStorage(const UniqueStorage& other) : Allocation(other.Allocation) {
+			Allocate(other.Capacity);
+			if (Capacity)
+				memcpy(Data, other.Data, Capacity);
+		}
+
+		UniqueStorage& operator=(UniqueStorage&& other) noexcept {
+			if (&other == this)
+				return *this;
+
+			Release();
+			Data       = std::exchange(other.Data, nullptr);
+			Capacity   = std::exchange(other.Capacity, 0);
+			Allocation = other.Allocation;
+			return *this;
+		}
+
+		UniqueStorage& operator=(const UniqueStorage& other) {
+			if (&other == this)
+				return *this;
+
+			Release();
+			Allocation = other.Allocation;
+			Allocate(other.Capacity);
+			if (Capacity)
+				memcpy(Data, other.Data, Capacity);
+			return *this;
+		}
+
+		[[nodiscard]]
+		char* GetData() noexcept {
+			return Data;
+		}
+
+		[[nodiscard]]
+		const char* GetData() const noexcept {
+			return Data;
+		}
+
+		[[nodiscard]]
+		size_t GetCapacity() const noexcept {
+			return Capacity;
+		}
+
+		[[nodiscard]]
+		const BufferAllocation& GetAllocation() const noexcept {
+			return Allocation;
+		}
+
+		void SetAllocation(const BufferAllocation& allocation) noexcept {
+			Release();
+			Allocation = allocation;
+		}
+
+		void Allocate(const size_t bytes) {
+			Release();
+			if (!bytes)
+				return;
+
+			Data     = AllocateMemory(bytes, Allocation);
+			Capacity = bytes;
+		}
+
+		void Reserve(const size_t bytes) {
+			if (bytes <= Capacity)
+				return;
+
+			auto* data = AllocateMemory(bytes, Allocation);
+			if (Capacity)
+				memcpy(data, Data, Capacity);
+			FreeMemory(Data, Allocation);
+			Data     = data;
+			Capacity = bytes;
+		}
+
+		void Release() noexcept {
+			FreeMemory(Data, Allocation);
+			Data     = nullptr;
+			Capacity = 0;
+		}
+
+	private:
+		char*            Data     = nullptr;
+		size_t           Capacity = 0;
+		BufferAllocation Allocation;
+	};
+
+	/**
+	 * \brief malloc/realloc backed storage for growable buffer, realloc can extend
+	 *		  large blocks in place instead of copy, copy makes deep copy
+	 */
+	class HeapStorage {
+	public:
+		HeapStorage() noexcept = default;
+
+		~HeapStorage() {
+			Release();
+		}
+
+		HeapStorage(HeapStorage&& other) noexcept
+			: Data(std::exchange(other.Data, nullptr)), Capacity(std::exchange(other.Capacity, 0)),
+			  Allocation(other.Allocation) {
+		}
+
+		HeapStorage(const HeapStorage& other) : Allocation(other.Allocation) {
+			Allocate(other.Capacity);
+			if (Capacity)
+				memcpy(Data, other.Data, Capacity);
+		}
+
+		HeapStorage& operator=(HeapStorage&& other) noexcept {
+			if (&other == this)
+				return *this;
+
+			Release();
+			Data       = std::exchange(other.Data, nullptr);
+			Capacity   = std::exchange(other.Capacity, 0);
+			Allocation = other.Allocation;
+			return *this;
+		}
+
+		HeapStorage& operator=(const HeapStorage& other) {
+			if (&other == this)
+				return *this;
+
+			Release();
+			Allocation = other.Allocation;
+			Allocate(other.Capacity);
+			if (Capacity)
+				memcpy(Data, other.Data, Capacity);
+			return *this;
+		}
+
+		[[nodiscard]]
+		char* GetData() noexcept {
+			return Data;
+		}
+
+		[[nodiscard]]
+		const char* GetData() const noexcept {
+			return Data;
+		}
+
+		[[nodiscard]]
+		size_t GetCapacity() const noexcept {
+			return Capacity;
+		}
+
+		[[nodiscard]]
+		const BufferAllocation& GetAllocation() const noexcept {
+			return Allocation;
+		}
+
+		void SetAllocation(const BufferAllocation& allocation) noexcept {
+			Release();
+			Allocation = allocation;
+		}
+
+		void Allocate(const size_t bytes) {
+			Release();
+			if (!bytes)
+				return;
+
+			Data     = AllocateMemory(bytes, Allocation);
+			Capacity = bytes;
+		}
+
+		void Reserve(const size_t bytes) {
+			if (bytes <= Capacity)
+				return;
+
+			Data     = ReallocateMemory(Data, Capacity, bytes, Allocation);
+			Capacity = bytes;
+		}
+
+		void Release() noexcept {
+			FreeMemory(Data, Allocation);
+			Data     = nullptr;
+			Capacity = 0;
+		}
+
+	private:
+		char*            Data     = nullptr;
+		size_t           Capacity = 0;
+		BufferAllocation Allocation;
+	};
+
+	/**
+	 * \brief Reference counted storage, copy shares same memory
+	 */
+	class SharedStorage {
+	public:
+		[[nodiscard]]
+		char* GetData() noexcept {
+			return Data.get();
+		}
+
+		[[nodiscard]]
+		const char* GetData() const noexcept {
+			return Data.get();
+		}
+
+		[[nodiscard]]
+		size_t GetCapacity() const noexcept {
+			return Data ? Capacity : 0;
+		}
+
+		[[nodiscard]]
+		const BufferAllocation& GetAllocation() const noexcept {
+			return Allocation;
+		}
+
+		void SetAllocation(const BufferAllocation& allocation) noexcept {
+			Release();
+			Allocation = allocation;
+		}
+
+		void Allocate(const size_t bytes) {
+			Data     = bytes ? MakeShared(bytes) : nullptr;
+			Capacity = bytes;
+		}
+
+		void Reserve(const size_t bytes) {
+			if (bytes <= GetCapacity())
+				return;
+
+			auto data = MakeShared(bytes);
+			if (Data)
+				memcpy(data.get(), Data.get(), Capacity);
+			Data     = std::move(data);
+			Capacity = bytes;
+		}
+
+		void Release() noexcept {
+			Data.reset();
+			Capacity = 0;
+		}
+
+	private:
+		[[nodiscard]]
+		std::shared_ptr<char[]> MakeShared(const size_t bytes) const {
+			// deleter keeps allocation used for this block, SetAllocation() may change member later
+			return std::shared_ptr<char[]>(AllocateMemory(bytes, Allocation), [allocation = Allocation](char* data) {
+				FreeMemory(data, allocation);
+			});
+		}
+
+		std::shared_ptr<char[]> Data;
+		size_t                  Capacity = 0;
+		BufferAllocation        Allocation;
+	};
+
+	/**
+	 * \brief Fixed size in-place storage, no heap allocation, usable in constant expression
+	 * \tparam Bytes storage size, include '\0' terminator
+	 */
+	template<size_t Bytes>
+	class InlineStorage {
+	public:
+		[[nodiscard]]
+		constexpr char* GetData() noexcept {
+			return Data.data();
+		}
+
+		[[nodiscard]]
+		constexpr const char* GetData() const noexcept {
+			return Data.data();
+		}
+
+		[[nodiscard]]
+		constexpr size_t GetCapacity() const noexcept {
+			return Bytes;
+		}
+
+		void Allocate(const size_t bytes) {
+			if (bytes > Bytes)
+				throw std::bad_alloc();
+		}
+
+		void Reserve(const size_t bytes) {
+			Allocate(bytes);
+		}
+
+		constexpr void Release() noexcept {
+		}
+
+	private:
+		std::array<char, Bytes> Data{};
+	};
+
+	/**
+	 * \brief Growth policy for buffer alloc only once, Append()/Insert() are rejected
+	 */
+	struct FixedGrowth {
+		static constexpr bool CanGrow = false;
+
+		static constexpr size_t NextCapacity(const size_t, const size_t required) noexcept {
+			return required;
+		}
+	};
+
+	/**
+	 * \brief Growth policy for dynamic buffer, capacity grows by 1.5x for amortized append
+	 */
+	struct DynamicGrowth {
+		static constexpr bool CanGrow = true;
+
+		static constexpr size_t NextCapacity(const size_t current, const size_t required) noexcept {
+			const auto grown = current + current / 2;
+			return grown > required ? grown : required;
+		}
+	};
+}
+
+#endif //VISCORE_BUFFER_STORAGE_H
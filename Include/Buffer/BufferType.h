@@ -8,6 +8,7 @@
 #ifndef VISCORE_BUFFER_TYPE_H
 #define VISCORE_BUFFER_TYPE_H
 
+#include <cstddef>
 #include <cstdint>
 
 #include "VisCoreExport.generate.h"
@@ -28,9 +29,30 @@ namespace VisCore::Buffer {
 		/**
 		 * \brief StreamingBuffer, disallow resize/append/insert
 		 */
-		Streaming = 2
+		Streaming = 2,
+		/**
+		 * \brief ConcatBuffer, reference operands and flatten on first contiguous access
+		 */
+		Concat = 3,
+		/**
+		 * \brief ManagedBuffer, fixed size, compressed in memory when idle over memory budget
+		 */
+		Managed = 4,
+		/**
+		 * \brief SpillBuffer, allow resize/append/insert, segments over memory limit move to disk
+		 */
+		Spill = 5,
+		/**
+		 * \brief SharedBuffer, fixed size, memory shared with other processes
+		 */
+		Shared = 6
 	};
 
+	/**
+	 * \brief Count of BufferType values, used to size per type tables
+	 */
+	constexpr size_t BufferTypeCount = 7;
+
 	inline const char* ToString(BufferType buffer) {
 		switch (buffer) {
 			case BufferType::Constraint:
@@ -39,6 +61,14 @@ namespace VisCore::Buffer {
 				return "Dynamic";
 			case BufferType::Streaming:
 				return "Streaming";
+			case BufferType::Concat:
+				return "Concat";
+			case BufferType::Managed:
+				return "Managed";
+			case BufferType::Spill:
+				return "Spill";
+			case BufferType::Shared:
+				return "Shared";
 			default:
 				return "unknown";
 		}
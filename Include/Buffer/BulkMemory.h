@@ -0,0 +1,71 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Multi-threaded fill and copy used by large buffer operations
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_BULK_MEMORY_H
+#define VISCORE_BUFFER_BULK_MEMORY_H
+
+#include <cstddef>
+
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Process wide tuning of BulkFill()/BulkCopy()
+	 */
+	struct BulkMemoryConfig {
+		/**
+		 * \brief Split work over worker threads from this size, SIZE_MAX disables
+		 */
+		size_t ParallelThreshold = 32 * 1024 * 1024;
+
+		/**
+		 * \brief Use non-temporal stores that bypass cache from this size, SIZE_MAX disables.
+		 *		  Keep it above last level cache size, result of smaller fills is usually read soon
+		 */
+		size_t NonTemporalThreshold = 256 * 1024 * 1024;
+
+		/**
+		 * \brief Max worker count, 0 means hardware concurrency
+		 */
+		size_t MaxThreads = 0;
+
+		/**
+		 * \brief Each worker gets at least this many bytes
+		 */
+		size_t MinChunkSize = 8 * 1024 * 1024;
+	};
+
+	/**
+	 * \brief Get current bulk memory tuning
+	 */
+	VIS_CORE_EXPORTS BulkMemoryConfig GetBulkMemoryConfig();
+
+	/**
+	 * \brief Replace bulk memory tuning, affect all buffers
+	 */
+	VIS_CORE_EXPORTS void SetBulkMemoryConfig(const BulkMemoryConfig& config);
+
+	/**
+	 * \brief memset replacement for large ranges. Work is split on page boundaries,
+	 *		  so fresh pages are first touched, and placed on NUMA node, by the worker that fills them
+	 * \param data destination
+	 * \param value fill value
+	 * \param size fill size
+	 */
+	VIS_CORE_EXPORTS void BulkFill(char* data, char value, size_t size);
+
+	/**
+	 * \brief memcpy replacement for large ranges, ranges must not overlap.
+	 *		  Work is split on destination page boundaries like BulkFill()
+	 * \param destination destination
+	 * \param source source
+	 * \param size copy size
+	 */
+	VIS_CORE_EXPORTS void BulkCopy(char* destination, const char* source, size_t size);
+}
+
+#endif //VISCORE_BUFFER_BULK_MEMORY_H
@@ -0,0 +1,65 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Bulk byte swap of element arrays
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_BYTE_SWAP_H
+#define VISCORE_BUFFER_BYTE_SWAP_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Buffer.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Reverse bytes of each element in place, 2/4/8 byte elements use AVX2 or SSSE3 shuffle
+	 *		  when cpu supports it, other sizes are reversed one by one
+	 * \param data first element
+	 * \param count element count
+	 * \param elementSize element size in bytes
+	 */
+	VIS_CORE_EXPORTS void ByteSwapArray(char* data, size_t count, size_t elementSize);
+
+	/**
+	 * \brief Reverse bytes of each element into destination, ranges must not overlap unless equal
+	 * \param destination output, count * elementSize bytes
+	 * \param source first element
+	 * \param count element count
+	 * \param elementSize element size in bytes
+	 */
+	VIS_CORE_EXPORTS void ByteSwapArray(char* destination, const char* source, size_t count, size_t elementSize);
+
+	/**
+	 * \brief Reverse bytes of each element of buffer region in place
+	 * \param buffer buffer
+	 * \param offset region offset in bytes
+	 * \param count element count
+	 * \param elementSize element size in bytes
+	 * \return false if region is out of buffer or buffer has no writable memory
+	 */
+	VIS_CORE_EXPORTS bool ByteSwapRegion(IBuffer& buffer, size_t offset, size_t count, size_t elementSize);
+
+	/**
+	 * \brief Typed in place form
+	 */
+	template<typename T>
+	void ByteSwapArray(T* data, const size_t count) {
+		static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "only arithmetic and enum types have byte order");
+		ByteSwapArray(reinterpret_cast<char*>(data), count, sizeof(T));
+	}
+
+	/**
+	 * \brief Typed out of place form
+	 */
+	template<typename T>
+	void ByteSwapArray(T* destination, const T* source, const size_t count) {
+		static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "only arithmetic and enum types have byte order");
+		ByteSwapArray(reinterpret_cast<char*>(destination), reinterpret_cast<const char*>(source), count, sizeof(T));
+	}
+}
+
+#endif //VISCORE_BUFFER_BYTE_SWAP_H
@@ -0,0 +1,47 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Fast LZ block codec used to keep cold buffers compressed in memory
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_COMPRESSION_H
+#define VISCORE_BUFFER_COMPRESSION_H
+
+#include <cstddef>
+
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Get max compressed size of size bytes, Compress() never fails with this capacity
+	 */
+	constexpr size_t GetCompressBound(const size_t size) {
+		return size + size / 255 + 16;
+	}
+
+	/**
+	 * \brief Compress block in LZ4 block format, greedy match search over a 4096 entry hash
+	 *		  table with 64 KiB window. Favors speed over ratio, runs at memory speed on
+	 *		  repetitive data
+	 * \param source input bytes
+	 * \param size input size
+	 * \param destination output bytes, must not overlap source
+	 * \param capacity output capacity
+	 * \return compressed size, -1 if output does not fit in capacity
+	 */
+	VIS_CORE_EXPORTS size_t Compress(const char* source, size_t size, char* destination, size_t capacity);
+
+	/**
+	 * \brief Decompress block written by Compress(), every read and write is bounds checked
+	 *		  so malformed input fails instead of overrun
+	 * \param source compressed bytes
+	 * \param size compressed size
+	 * \param destination output bytes, must not overlap source
+	 * \param capacity output capacity
+	 * \return decompressed size, -1 if input is malformed or output does not fit in capacity
+	 */
+	VIS_CORE_EXPORTS size_t Decompress(const char* source, size_t size, char* destination, size_t capacity);
+}
+
+#endif //VISCORE_BUFFER_COMPRESSION_H
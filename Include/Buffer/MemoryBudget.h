@@ -0,0 +1,149 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Process wide memory budget of managed buffers, cold buffers are kept compressed
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_MEMORY_BUDGET_H
+#define VISCORE_BUFFER_MEMORY_BUDGET_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Buffer.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Budget settings of BufferType::Managed buffers
+	 */
+	struct MemoryBudgetConfig {
+		/**
+		 * \brief Max bytes held by managed buffers, resident and compressed. Going over compresses
+		 *		  buffers not accessed recently, default is unlimited
+		 */
+		size_t Budget = SIZE_MAX;
+
+		/**
+		 * \brief Buffer must be idle this long before it can be compressed. Buffer methods keep
+		 *		  data resident while they run, pointers from GetData() and operator*() stay valid
+		 *		  while buffer is accessed more often than this or pinned. 0 only protects buffers
+		 *		  touched since last budget check
+		 */
+		uint32_t MinIdleMs = 1000;
+
+		/**
+		 * \brief Smaller buffers are never compressed
+		 */
+		size_t MinBufferSize = 64 * 1024;
+	};
+
+	/**
+	 * \brief Counters of managed buffers
+	 */
+	struct MemoryBudgetStats {
+		/**
+		 * \brief Managed buffers holding data
+		 */
+		uint64_t ManagedBuffers;
+
+		/**
+		 * \brief Managed buffers currently compressed
+		 */
+		uint64_t CompressedBuffers;
+
+		/**
+		 * \brief Bytes of resident buffers
+		 */
+		uint64_t ResidentBytes;
+
+		/**
+		 * \brief Bytes of compressed buffers as stored
+		 */
+		uint64_t CompressedBytes;
+
+		/**
+		 * \brief Bytes of compressed buffers before compression
+		 */
+		uint64_t OriginalBytes;
+
+		/**
+		 * \brief Buffers compressed since start
+		 */
+		uint64_t Compressions;
+
+		/**
+		 * \brief Buffers decompressed on access since start
+		 */
+		uint64_t Decompressions;
+
+		/**
+		 * \brief Compressions dropped because data saved less than 1/8, buffer is skipped until
+		 *		  next write access
+		 */
+		uint64_t Rejected;
+	};
+
+	/**
+	 * \brief Get current budget settings
+	 */
+	VIS_CORE_EXPORTS MemoryBudgetConfig GetMemoryBudgetConfig();
+
+	/**
+	 * \brief Replace budget settings, lower budget is enforced at once
+	 */
+	VIS_CORE_EXPORTS void SetMemoryBudgetConfig(const MemoryBudgetConfig& config);
+
+	/**
+	 * \brief Get snapshot of managed buffer counters
+	 */
+	VIS_CORE_EXPORTS MemoryBudgetStats GetMemoryBudgetStats();
+
+	/**
+	 * \brief Compress every managed buffer idle for MinIdleMs regardless of budget, for
+	 *		  periodic or memory pressure callbacks
+	 * \return bytes saved
+	 */
+	VIS_CORE_EXPORTS size_t TrimMemoryBudget();
+
+	/**
+	 * \brief Keep managed buffer resident until UnpinBuffer(), pins nest
+	 * \return false if buffer is not BufferType::Managed
+	 */
+	VIS_CORE_EXPORTS bool PinBuffer(IBuffer& buffer);
+
+	/**
+	 * \brief Release one pin of managed buffer
+	 * \return false if buffer is not BufferType::Managed or not pinned
+	 */
+	VIS_CORE_EXPORTS bool UnpinBuffer(IBuffer& buffer);
+
+	/**
+	 * \brief Get if managed buffer is currently compressed, false for other types
+	 */
+	VIS_CORE_EXPORTS bool IsBufferCompressed(IBuffer& buffer);
+
+	/**
+	 * \brief Pin managed buffer for scope, other types pass through
+	 */
+	class ScopedBufferPin {
+	public:
+		explicit ScopedBufferPin(IBuffer& buffer) : Target(buffer), Pinned(PinBuffer(buffer)) {
+		}
+
+		~ScopedBufferPin() {
+			if (Pinned)
+				UnpinBuffer(Target);
+		}
+
+		ScopedBufferPin(const ScopedBufferPin&)            = delete;
+		ScopedBufferPin& operator=(const ScopedBufferPin&) = delete;
+
+	private:
+		IBuffer& Target;
+		bool     Pinned;
+	};
+}
+
+#endif //VISCORE_BUFFER_MEMORY_BUDGET_H
@@ -0,0 +1,136 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Conversion between float, half precision and normalized integer arrays
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_NUMERIC_CONVERT_H
+#define VISCORE_BUFFER_NUMERIC_CONVERT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Buffer.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Element format of attribute arrays
+	 */
+	enum class NumericFormat : uint8_t {
+		/**
+		 * \brief IEEE 754 binary32
+		 */
+		Float32 = 0,
+		/**
+		 * \brief IEEE 754 binary16
+		 */
+		Float16 = 1,
+		/**
+		 * \brief High 16 bits of binary32
+		 */
+		BFloat16 = 2,
+		/**
+		 * \brief uint8_t mapping [0, 1] to [0, 255]
+		 */
+		Unorm8 = 3,
+		/**
+		 * \brief int16_t mapping [-1, 1] to [-32767, 32767], -32768 also reads as -1
+		 */
+		Snorm16 = 4
+	};
+
+	inline const char* ToString(const NumericFormat format) {
+		switch (format) {
+			case NumericFormat::Float32:
+				return "Float32";
+			case NumericFormat::Float16:
+				return "Float16";
+			case NumericFormat::BFloat16:
+				return "BFloat16";
+			case NumericFormat::Unorm8:
+				return "Unorm8";
+			case NumericFormat::Snorm16:
+				return "Snorm16";
+			default:
+				return "unknown";
+		}
+	}
+
+	/**
+	 * \brief Get element size in bytes
+	 */
+	constexpr size_t GetNumericSize(const NumericFormat format) {
+		switch (format) {
+			case NumericFormat::Float32:
+				return 4;
+			case NumericFormat::Unorm8:
+				return 1;
+			default:
+				return 2;
+		}
+	}
+
+	/**
+	 * \brief Convert float to binary16 bits, round to nearest even, NaN stays NaN
+	 */
+	VIS_CORE_EXPORTS uint16_t FloatToHalf(float value);
+
+	/**
+	 * \brief Convert binary16 bits to float, exact
+	 */
+	VIS_CORE_EXPORTS float HalfToFloat(uint16_t value);
+
+	/**
+	 * \brief Convert float to bfloat16 bits, round to nearest even, NaN stays NaN
+	 */
+	VIS_CORE_EXPORTS uint16_t FloatToBFloat16(float value);
+
+	/**
+	 * \brief Convert bfloat16 bits to float, exact
+	 */
+	VIS_CORE_EXPORTS float BFloat16ToFloat(uint16_t value);
+
+	/**
+	 * \brief Convert element array between formats. Float16 uses F16C when cpu supports it,
+	 *		  or NEON on AArch64, other formats use SSE2. Float to normalized integer clamps,
+	 *		  rounds to nearest even and maps NaN to 0. Pairs without Float32 go through
+	 *		  Float32 in small blocks
+	 * \param source source elements, no alignment needed
+	 * \param from source format
+	 * \param destination destination elements, must not overlap source unless formats are equal
+	 * \param to destination format
+	 * \param count element count
+	 */
+	VIS_CORE_EXPORTS void ConvertNumeric(const char* source, NumericFormat from, char* destination, NumericFormat to,
+	                                     size_t count);
+
+	/**
+	 * \brief Convert elements between buffer regions
+	 * \param source source buffer
+	 * \param sourceOffset first source element offset in bytes
+	 * \param from source format
+	 * \param destination destination buffer, must not be source
+	 * \param destinationOffset first destination element offset in bytes
+	 * \param to destination format
+	 * \param count element count
+	 * \return false if a region is out of its buffer or destination has no writable memory
+	 */
+	VIS_CORE_EXPORTS bool ConvertNumericRegion(const IBuffer& source, size_t sourceOffset, NumericFormat from,
+	                                           IBuffer& destination, size_t destinationOffset, NumericFormat to,
+	                                           size_t count);
+
+	/**
+	 * \brief Convert whole buffer into new buffer
+	 * \param source source buffer
+	 * \param from source format
+	 * \param to destination format
+	 * \param type destination buffer type
+	 * \return nullptr if source length is not multiple of source element size
+	 */
+	VIS_CORE_EXPORTS IBufferPtr ConvertNumeric(const IBuffer& source, NumericFormat from, NumericFormat to,
+	                                           BufferType type = BufferType::Constraint);
+}
+
+#endif //VISCORE_BUFFER_NUMERIC_CONVERT_H
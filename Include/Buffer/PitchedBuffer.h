@@ -0,0 +1,231 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * 2D buffer with aligned row pitch or tiled layout, for image and grid data
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_PITCHED_BUFFER_H
+#define VISCORE_BUFFER_PITCHED_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Buffer.h"
+#include "TypedView.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Element order in memory of PitchedBuffer
+	 */
+	enum class PitchedLayout : uint8_t {
+		/**
+		 * \brief Rows one after another, each starting at multiple of alignment
+		 */
+		Linear = 0,
+		/**
+		 * \brief PitchedTileEdge x PitchedTileEdge tiles stored row by row, elements inside
+		 *		  a tile are row major. Keeps 2D neighbors within a few cache lines
+		 */
+		Tiled = 1,
+		/**
+		 * \brief Z-order curve, x and y bits interleaved. Width and height are padded to
+		 *		  powers of two, extra bits of longer side go above interleaved bits
+		 */
+		Morton = 2
+	};
+
+	/**
+	 * \brief Tile width and height in elements of PitchedLayout::Tiled
+	 */
+	constexpr size_t PitchedTileEdge = 8;
+
+	inline const char* ToString(const PitchedLayout layout) {
+		switch (layout) {
+			case PitchedLayout::Linear:
+				return "Linear";
+			case PitchedLayout::Tiled:
+				return "Tiled";
+			case PitchedLayout::Morton:
+				return "Morton";
+			default:
+				return "unknown";
+		}
+	}
+
+	/**
+	 * \brief Width x height grid of fixed size elements over one aligned Constraint buffer.
+	 *		  Linear layout pads each row to a multiple of alignment so every row starts SIMD
+	 *		  aligned, tiled and Morton layouts trade contiguous rows for 2D locality
+	 */
+	class VIS_CORE_EXPORTS PitchedBuffer {
+	public:
+		/**
+		 * \brief Create zero filled grid
+		 * \param width element count of each row
+		 * \param height row count
+		 * \param elementSize element size in bytes
+		 * \param layout element order
+		 * \param alignment data and row alignment in bytes, power of two
+		 * \throw std::invalid_argument if element size is 0 or alignment is not power of two
+		 * \throw std::length_error if grid size overflows
+		 */
+		PitchedBuffer(size_t width, size_t height, size_t elementSize, PitchedLayout layout = PitchedLayout::Linear,
+		              size_t alignment = 64);
+
+		[[nodiscard]]
+		size_t GetWidth() const noexcept {
+			return Width;
+		}
+
+		[[nodiscard]]
+		size_t GetHeight() const noexcept {
+			return Height;
+		}
+
+		[[nodiscard]]
+		size_t GetElementSize() const noexcept {
+			return ElementSize;
+		}
+
+		[[nodiscard]]
+		PitchedLayout GetLayout() const noexcept {
+			return Layout;
+		}
+
+		/**
+		 * \brief Get row distance in bytes of linear layout, bytes per tile row of tiled layout,
+		 *		  0 for Morton layout
+		 */
+		[[nodiscard]]
+		size_t GetPitch() const noexcept {
+			return Pitch;
+		}
+
+		/**
+		 * \brief Get backing buffer, its length includes row and tile padding
+		 */
+		[[nodiscard]]
+		const IBufferPtr& GetBuffer() const noexcept {
+			return Storage;
+		}
+
+		/**
+		 * \brief Get byte offset of element in backing buffer, no range check
+		 */
+		[[nodiscard]]
+		size_t GetOffset(size_t x, size_t y) const noexcept;
+
+		/**
+		 * \brief Get element count from column x on the same row that is contiguous in memory,
+		 *		  no range check
+		 */
+		[[nodiscard]]
+		size_t GetRun(size_t x) const noexcept;
+
+		/**
+		 * \brief Get element address
+		 * \return nullptr if x or y is out of grid
+		 */
+		char* GetElement(size_t x, size_t y);
+
+		/**
+		 * \brief Read only form
+		 */
+		const char* GetElement(size_t x, size_t y) const;
+
+		/**
+		 * \brief Get row bytes, width * element size
+		 * \return empty span if layout is not linear or y is out of grid
+		 */
+		Span<char> GetRow(size_t y);
+
+		/**
+		 * \brief Read only form
+		 */
+		Span<const char> GetRow(size_t y) const;
+
+		/**
+		 * \brief Get row as span of T, sizeof(T) must be element size
+		 * \return empty span if layout is not linear, y is out of grid or T does not match
+		 */
+		template<typename T>
+		Span<T> GetRow(const size_t y) {
+			if (sizeof(T) != ElementSize)
+				return {};
+			const auto row = GetRow(y);
+			return AsSpan<T>(row.data(), row.size());
+		}
+
+		/**
+		 * \brief Get column as strided view of T, sizeof(T) must be element size
+		 * \return empty view if layout is not linear, x is out of grid or T does not match
+		 */
+		template<typename T>
+		StridedView<T> GetColumn(const size_t x) {
+			if (sizeof(T) != ElementSize || Layout != PitchedLayout::Linear || x >= Width)
+				return {};
+			return StridedView<T>(**Storage + x * ElementSize, Height, Pitch);
+		}
+
+		/**
+		 * \brief Copy rectangle from row major memory into grid
+		 * \param x left column
+		 * \param y top row
+		 * \param width rectangle width in elements
+		 * \param height rectangle height in rows
+		 * \param data first source row
+		 * \param pitch source row distance in bytes
+		 * \return false if rectangle is out of grid
+		 */
+		bool Update(size_t x, size_t y, size_t width, size_t height, const char* data, size_t pitch);
+
+		/**
+		 * \brief Copy rectangle of grid into row major memory
+		 * \param x left column
+		 * \param y top row
+		 * \param width rectangle width in elements
+		 * \param height rectangle height in rows
+		 * \param data first destination row
+		 * \param pitch destination row distance in bytes
+		 * \return false if rectangle is out of grid
+		 */
+		bool Read(size_t x, size_t y, size_t width, size_t height, char* data, size_t pitch) const;
+
+		/**
+		 * \brief Blit rectangle of source into this grid, layouts may differ. Each row moves as
+		 *		  runs contiguous in both layouts, one memcpy per row between linear grids
+		 * \param source source grid, may be this grid
+		 * \param sourceX source left column
+		 * \param sourceY source top row
+		 * \param width rectangle width in elements
+		 * \param height rectangle height in rows
+		 * \param x destination left column
+		 * \param y destination top row
+		 * \return false if element sizes differ or a rectangle is out of its grid
+		 */
+		bool CopyRect(const PitchedBuffer& source, size_t sourceX, size_t sourceY, size_t width, size_t height, size_t x,
+		              size_t y);
+
+		/**
+		 * \brief Write transpose of this grid into destination, walking both in
+		 *		  PitchedTileEdge square blocks so neither side is read column by column
+		 * \param destination grid of height x width with same element size, must not be this grid
+		 * \return false if destination does not match
+		 */
+		bool Transpose(PitchedBuffer& destination) const;
+
+	private:
+		IBufferPtr    Storage;
+		size_t        Width;
+		size_t        Height;
+		size_t        ElementSize;
+		size_t        Pitch       = 0;
+		PitchedLayout Layout;
+		uint8_t       MortonBits  = 0;
+		bool          MortonWideX = false;
+	};
+}
+
+#endif //VISCORE_BUFFER_PITCHED_BUFFER_H
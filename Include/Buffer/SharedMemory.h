@@ -0,0 +1,91 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Shared memory buffers, mapped by several processes on same host without copy
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_SHARED_MEMORY_H
+#define VISCORE_BUFFER_SHARED_MEMORY_H
+
+#include <cstddef>
+
+#include "Buffer.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief OS handle of shared memory, file descriptor on POSIX, HANDLE on Windows
+	 */
+	#if defined(_WIN32)
+	typedef void* SharedMemoryHandle;
+	#else
+	typedef int SharedMemoryHandle;
+	#endif
+
+	/**
+	 * \brief Value of SharedMemoryHandle that refers to nothing
+	 */
+	#if defined(_WIN32)
+	constexpr SharedMemoryHandle InvalidSharedMemoryHandle = nullptr;
+	#else
+	constexpr SharedMemoryHandle InvalidSharedMemoryHandle = -1;
+	#endif
+
+	/**
+	 * \brief Create zero filled shared memory buffer of fixed size
+	 * \param name name other processes open it by, shm_open() name on POSIX and Local\ object on Windows.
+	 *		  nullptr or empty creates anonymous memory (memfd on Linux) shared by passing its handle
+	 * \param size buffer size
+	 * \return BufferType::Shared buffer, nullptr if name exists or create failed
+	 */
+	VIS_CORE_EXPORTS IBufferPtr CreateSharedBuffer(const char* name, size_t size);
+
+	/**
+	 * \brief Map shared memory created by CreateSharedBuffer()
+	 * \param name name given to CreateSharedBuffer()
+	 * \param readOnly map without write access
+	 * \return BufferType::Shared buffer, nullptr if name does not exist or open failed
+	 */
+	VIS_CORE_EXPORTS IBufferPtr OpenSharedBuffer(const char* name, bool readOnly = false);
+
+	/**
+	 * \brief Map shared memory by handle received from another process, e.g. SCM_RIGHTS message,
+	 *		  inherited descriptor or DuplicateHandle(). Handle is duplicated, caller still owns it.
+	 *		  Sealed or read only handle always opens read only
+	 * \param handle shared memory handle
+	 * \param readOnly map without write access
+	 * \return BufferType::Shared buffer, nullptr if open failed
+	 */
+	VIS_CORE_EXPORTS IBufferPtr OpenSharedBuffer(SharedMemoryHandle handle, bool readOnly = false);
+
+	/**
+	 * \brief Get handle to pass to other processes, owned by buffer and closed with it
+	 * \return InvalidSharedMemoryHandle if buffer is not BufferType::Shared or holds no data
+	 */
+	VIS_CORE_EXPORTS SharedMemoryHandle GetSharedBufferHandle(IBuffer& buffer);
+
+	/**
+	 * \brief Freeze content for every process, buffer is remapped read only so earlier data pointers
+	 *		  are invalid. Only anonymous buffers on Linux can be sealed, fails while another process
+	 *		  has writable mapping
+	 * \return false if buffer is not BufferType::Shared or seal is not supported or failed
+	 */
+	VIS_CORE_EXPORTS bool SealSharedBuffer(IBuffer& buffer);
+
+	/**
+	 * \brief Get if shared buffer is mapped without write access, Update()/Clear() fail and writes
+	 *		  through data pointers fault
+	 * \return false for writable buffer and other types
+	 */
+	VIS_CORE_EXPORTS bool IsSharedBufferReadOnly(IBuffer& buffer);
+
+	/**
+	 * \brief Remove name of shared memory, mapped buffers stay valid and memory is freed with last
+	 *		  mapping. On Windows name is removed with last handle so nothing is done
+	 * \return false if name does not exist
+	 */
+	VIS_CORE_EXPORTS bool RemoveSharedBuffer(const char* name);
+}
+
+#endif //VISCORE_BUFFER_SHARED_MEMORY_H
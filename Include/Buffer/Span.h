@@ -0,0 +1,134 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Non-owning contiguous view, C++17 stand-in for std::span
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_SPAN_H
+#define VISCORE_BUFFER_SPAN_H
+
+#include <cstddef>
+#include <type_traits>
+
+#if __has_include(<span>)
+#include <span>
+#endif
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Non-owning view over contiguous elements, same member names as std::span
+	 *		  so it works with <algorithm> and range-for, convertible to std::span when available
+	 */
+	template<typename T>
+	class Span {
+	public:
+		using element_type    = T;
+		using value_type      = std::remove_cv_t<T>;
+		using size_type       = size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer         = T*;
+		using reference       = T&;
+		using iterator        = T*;
+
+		static constexpr size_t npos = static_cast<size_t>(-1);
+
+		constexpr Span() noexcept : Pointer(nullptr), Length(0) {
+		}
+
+		constexpr Span(T* ptr, const size_t length) noexcept : Pointer(ptr), Length(length) {
+		}
+
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+		constexpr Span(const Span<U>& other) noexcept : Pointer(other.data()), Length(other.size()) {
+		}
+
+		/**
+		 * \brief Get element ptr
+		 * \return first element ptr
+		 */
+		[[nodiscard]]
+		constexpr T* data() const noexcept {
+			return Pointer;
+		}
+
+		/**
+		 * \brief Get element count
+		 * \return element count
+		 */
+		[[nodiscard]]
+		constexpr size_t size() const noexcept {
+			return Length;
+		}
+
+		/**
+		 * \brief Get view size in bytes
+		 * \return byte size
+		 */
+		[[nodiscard]]
+		constexpr size_t size_bytes() const noexcept {
+			return Length * sizeof(T);
+		}
+
+		[[nodiscard]]
+		constexpr bool empty() const noexcept {
+			return Length == 0;
+		}
+
+		/**
+		 * \brief Get element by position, no range check
+		 * \param position position
+		 * \return element reference
+		 */
+		constexpr T& operator[](const size_t position) const noexcept {
+			return Pointer[position];
+		}
+
+		constexpr iterator begin() const noexcept {
+			return Pointer;
+		}
+
+		constexpr iterator end() const noexcept {
+			return Pointer + Length;
+		}
+
+		/**
+		 * \brief Get view of first count elements
+		 */
+		constexpr Span first(const size_t count) const noexcept {
+			return Span(Pointer, count < Length ? count : Length);
+		}
+
+		/**
+		 * \brief Get view of last count elements
+		 */
+		constexpr Span last(const size_t count) const noexcept {
+			return count < Length ? Span(Pointer + Length - count, count) : *this;
+		}
+
+		/**
+		 * \brief Get sub view, clamped to current view
+		 * \param offset start position
+		 * \param count element count, default npos means to end
+		 */
+		constexpr Span subspan(const size_t offset, const size_t count = npos) const noexcept {
+			if (offset >= Length)
+				return Span(Pointer + Length, 0);
+
+			const auto rest = Length - offset;
+			return Span(Pointer + offset, count < rest ? count : rest);
+		}
+
+		#if defined(__cpp_lib_span)
+		constexpr operator std::span<T>() const noexcept {
+			return std::span<T>(Pointer, Length);
+		}
+		#endif
+
+	private:
+		T*     Pointer;
+		size_t Length;
+	};
+}
+
+#endif //VISCORE_BUFFER_SPAN_H
@@ -0,0 +1,56 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Options of growable buffers that spill cold segments to disk
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_SPILL_OPTIONS_H
+#define VISCORE_BUFFER_SPILL_OPTIONS_H
+
+#include <cstddef>
+#include <string>
+
+#include "Buffer.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Settings of BufferType::Spill buffers
+	 */
+	struct SpillOptions {
+		/**
+		 * \brief Max resident bytes of one buffer, least recently used segments over it are
+		 *		  written to temporary file
+		 */
+		size_t MemoryLimit = 64 * 1024 * 1024;
+
+		/**
+		 * \brief Unit of spill and read back, at least 4 KiB
+		 */
+		size_t SegmentSize = 1024 * 1024;
+
+		/**
+		 * \brief Directory of temporary file, empty uses TMPDIR or system temp directory.
+		 *		  File has no name and is removed with buffer
+		 */
+		std::string Directory;
+	};
+
+	/**
+	 * \brief Get options used by CreateBuffer(BufferType::Spill, ...)
+	 */
+	VIS_CORE_EXPORTS SpillOptions GetDefaultSpillOptions();
+
+	/**
+	 * \brief Replace options used by buffers created later
+	 */
+	VIS_CORE_EXPORTS void SetDefaultSpillOptions(const SpillOptions& options);
+
+	/**
+	 * \brief Create empty spill buffer with given options
+	 */
+	VIS_CORE_EXPORTS IBufferPtr CreateSpillBuffer(const SpillOptions& options);
+}
+
+#endif //VISCORE_BUFFER_SPILL_OPTIONS_H
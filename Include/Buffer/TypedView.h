@@ -0,0 +1,333 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Typed and strided views over buffer regions
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_TYPED_VIEW_H
+#define VISCORE_BUFFER_TYPED_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "Buffer.h"
+#include "Span.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Non-owning view over elements placed every Stride bytes, such as one attribute
+	 *		  of interleaved vertex records. Elements are read and written with memcpy so
+	 *		  stride and offset do not need to match alignment of T
+	 */
+	template<typename T>
+	class StridedView {
+		static_assert(std::is_trivially_copyable_v<std::remove_cv_t<T>>, "strided view element must be trivially copyable");
+
+		using byte_type = std::conditional_t<std::is_const_v<T>, const char, char>;
+
+	public:
+		using value_type = std::remove_cv_t<T>;
+		using size_type  = size_t;
+
+		/**
+		 * \brief Proxy reference, converts to value and assigns through memcpy
+		 */
+		class Reference {
+		public:
+			explicit Reference(byte_type* address) noexcept : Address(address) {
+			}
+
+			operator value_type() const noexcept {
+				value_type value;
+				memcpy(&value, Address, sizeof(value_type));
+				return value;
+			}
+
+			template<typename U = T, typename = std::enable_if_t<!std::is_const_v<U>>>
+			Reference& operator=(const value_type& value) noexcept {
+				memcpy(Address, &value, sizeof(value_type));
+				return *this;
+			}
+
+			Reference& operator=(const Reference& other) noexcept {
+				return *this = static_cast<value_type>(other);
+			}
+
+		private:
+			byte_type* Address;
+		};
+
+		class Iterator {
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type        = StridedView::value_type;
+			using difference_type   = std::ptrdiff_t;
+			using pointer           = void;
+			using reference         = Reference;
+
+			Iterator(byte_type* address, const size_t stride) noexcept : Address(address), Stride(stride) {
+			}
+
+			Reference operator*() const noexcept {
+				return Reference(Address);
+			}
+
+			Reference operator[](const difference_type offset) const noexcept {
+				return Reference(Address + offset * static_cast<difference_type>(Stride));
+			}
+
+			Iterator& operator++() noexcept {
+				Address += Stride;
+				return *this;
+			}
+
+			Iterator operator++(int) noexcept {
+				auto copy = *this;
+				Address += Stride;
+				return copy;
+			}
+
+			Iterator& operator--() noexcept {
+				Address -= Stride;
+				return *this;
+			}
+
+			Iterator operator--(int) noexcept {
+				auto copy = *this;
+				Address -= Stride;
+				return copy;
+			}
+
+			Iterator& operator+=(const difference_type offset) noexcept {
+				Address += offset * static_cast<difference_type>(Stride);
+				return *this;
+			}
+
+			Iterator& operator-=(const difference_type offset) noexcept {
+				Address -= offset * static_cast<difference_type>(Stride);
+				return *this;
+			}
+
+			Iterator operator+(const difference_type offset) const noexcept {
+				return Iterator(*this) += offset;
+			}
+
+			Iterator operator-(const difference_type offset) const noexcept {
+				return Iterator(*this) -= offset;
+			}
+
+			difference_type operator-(const Iterator& other) const noexcept {
+				return (Address - other.Address) / static_cast<difference_type>(Stride);
+			}
+
+			bool operator==(const Iterator& other) const noexcept {
+				return Address == other.Address;
+			}
+
+			bool operator!=(const Iterator& other) const noexcept {
+				return Address != other.Address;
+			}
+
+			bool operator<(const Iterator& other) const noexcept {
+				return Address < other.Address;
+			}
+
+		private:
+			byte_type* Address;
+			size_t     Stride;
+		};
+
+		using iterator = Iterator;
+
+		StridedView() noexcept : Address(nullptr), Length(0), Stride(sizeof(T)) {
+		}
+
+		/**
+		 * \param address first element
+		 * \param length element count
+		 * \param stride distance between elements in bytes
+		 */
+		StridedView(byte_type* address, const size_t length, const size_t stride) noexcept
+			: Address(address), Length(length), Stride(stride) {
+		}
+
+		/**
+		 * \brief Get first element address
+		 */
+		[[nodiscard]]
+		byte_type* data() const noexcept {
+			return Address;
+		}
+
+		[[nodiscard]]
+		size_t size() const noexcept {
+			return Length;
+		}
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return Length == 0;
+		}
+
+		/**
+		 * \brief Get distance between elements in bytes
+		 */
+		[[nodiscard]]
+		size_t stride() const noexcept {
+			return Stride;
+		}
+
+		/**
+		 * \brief Check elements are packed and aligned so the view can be used as Span
+		 */
+		[[nodiscard]]
+		bool IsContiguous() const noexcept {
+			return Stride == sizeof(T) && reinterpret_cast<uintptr_t>(Address) % alignof(T) == 0;
+		}
+
+		/**
+		 * \brief Get element by position, no range check
+		 */
+		Reference operator[](const size_t position) const noexcept {
+			return Reference(Address + position * Stride);
+		}
+
+		iterator begin() const noexcept {
+			return Iterator(Address, Stride);
+		}
+
+		iterator end() const noexcept {
+			return Iterator(Address + Length * Stride, Stride);
+		}
+
+		/**
+		 * \brief Get sub view, clamped to current view
+		 */
+		StridedView subview(const size_t offset, const size_t count = Span<T>::npos) const noexcept {
+			if (offset >= Length)
+				return StridedView(Address + Length * Stride, 0, Stride);
+
+			const auto rest = Length - offset;
+			return StridedView(Address + offset * Stride, count < rest ? count : rest, Stride);
+		}
+
+	private:
+		byte_type* Address;
+		size_t     Length;
+		size_t     Stride;
+	};
+
+	/**
+	 * \brief Element count of strided region fitting in length bytes after offset
+	 */
+	inline size_t GetStridedCount(const size_t length, const size_t offset, const size_t stride, const size_t elementSize) {
+		if (offset > length || length - offset < elementSize || stride == 0)
+			return 0;
+		return (length - offset - elementSize) / stride + 1;
+	}
+
+	/**
+	 * \brief Reinterpret byte region as span of T
+	 * \param data region start, must keep T aligned
+	 * \param length region length in bytes
+	 * \param count element count, npos means as many as fit
+	 * \return empty span if count does not fit or data is misaligned
+	 */
+	template<typename T, typename Byte>
+	Span<T> AsSpan(Byte* data, const size_t length, const size_t count = Span<T>::npos) {
+		static_assert(std::is_trivially_copyable_v<std::remove_cv_t<T>>, "span element must be trivially copyable");
+		static_assert(std::is_const_v<T> || !std::is_const_v<Byte>, "read only region needs const element type");
+
+		const auto fit = length / sizeof(T);
+		if ((count != Span<T>::npos && count > fit) || reinterpret_cast<uintptr_t>(data) % alignof(T))
+			return {};
+
+		return Span<T>(reinterpret_cast<T*>(data), count == Span<T>::npos ? fit : count);
+	}
+
+	/**
+	 * \brief Reinterpret buffer region as span of T
+	 * \param buffer buffer, view is invalid after it reallocates
+	 * \param offset region offset in bytes, must keep T aligned
+	 * \param count element count, default npos means to end of buffer
+	 * \return empty span if region is out of buffer, misaligned or buffer has no writable memory
+	 */
+	template<typename T>
+	Span<T> AsSpan(IBuffer& buffer, const size_t offset = 0, const size_t count = Span<T>::npos) {
+		auto*      data   = *buffer;
+		const auto length = buffer.GetLength();
+		if (!data || offset > length)
+			return {};
+		return AsSpan<T>(data + offset, length - offset, count);
+	}
+
+	/**
+	 * \brief Read only form
+	 */
+	template<typename T>
+	Span<const T> AsSpan(const IBuffer& buffer, const size_t offset = 0, const size_t count = Span<T>::npos) {
+		const auto length = buffer.GetLength();
+		if (offset > length)
+			return {};
+		return AsSpan<const T>(buffer.GetData() + offset, length - offset, count);
+	}
+
+	/**
+	 * \brief View byte region as T placed every stride bytes
+	 * \param data first element, no alignment needed
+	 * \param length region length in bytes
+	 * \param stride distance between elements in bytes, not less than sizeof(T)
+	 * \param count element count, npos means as many as fit
+	 * \return empty view if count does not fit or stride is too small
+	 */
+	template<typename T, typename Byte>
+	StridedView<T> AsStridedView(Byte* data, const size_t length, const size_t stride,
+	                             const size_t count = Span<T>::npos) {
+		static_assert(std::is_const_v<T> || !std::is_const_v<Byte>, "read only region needs const element type");
+
+		if (stride < sizeof(T))
+			return {};
+
+		const auto fit = GetStridedCount(length, 0, stride, sizeof(T));
+		if (count != Span<T>::npos && count > fit)
+			return {};
+
+		return StridedView<T>(data, count == Span<T>::npos ? fit : count, stride);
+	}
+
+	/**
+	 * \brief View buffer region as T placed every stride bytes
+	 * \param buffer buffer, view is invalid after it reallocates
+	 * \param offset first element offset in bytes, no alignment needed
+	 * \param stride distance between elements in bytes, not less than sizeof(T)
+	 * \param count element count, default npos means as many as fit
+	 * \return empty view if region is out of buffer, stride is too small or buffer has no writable memory
+	 */
+	template<typename T>
+	StridedView<T> AsStridedView(IBuffer& buffer, const size_t offset, const size_t stride,
+	                             const size_t count = Span<T>::npos) {
+		auto*      data   = *buffer;
+		const auto length = buffer.GetLength();
+		if (!data || offset > length)
+			return {};
+		return AsStridedView<T>(data + offset, length - offset, stride, count);
+	}
+
+	/**
+	 * \brief Read only form
+	 */
+	template<typename T>
+	StridedView<const T> AsStridedView(const IBuffer& buffer, const size_t offset, const size_t stride,
+	                                   const size_t count = Span<T>::npos) {
+		const auto length = buffer.GetLength();
+		if (offset > length)
+			return {};
+		return AsStridedView<const T>(buffer.GetData() + offset, length - offset, stride, count);
+	}
+}
+
+#endif //VISCORE_BUFFER_TYPED_VIEW_H
@@ -0,0 +1,35 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Update region struct
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_UPDATE_REGION_H
+#define VISCORE_BUFFER_UPDATE_REGION_H
+
+#include <cstddef>
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief One region of a batched update, see IBuffer::UpdateMany()
+	 */
+	struct UpdateRegion {
+		/**
+		 * \brief Start position in destination buffer
+		 */
+		size_t Offset;
+
+		/**
+		 * \brief Update size
+		 */
+		size_t Size;
+
+		/**
+		 * \brief Source data ptr
+		 */
+		const char* Ptr;
+	};
+}
+
+#endif //VISCORE_BUFFER_UPDATE_REGION_H
@@ -0,0 +1,125 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Interleave/deinterleave of vertex records and attribute reductions
+ * */
+#pragma once
+
+#ifndef VISCORE_BUFFER_VERTEX_DATA_H
+#define VISCORE_BUFFER_VERTEX_DATA_H
+
+#include <cstddef>
+
+#include "Buffer.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief One attribute of interleaved vertex records and its packed stream
+	 */
+	struct AttributeStream {
+		/**
+		 * \brief Attribute offset inside record in bytes
+		 */
+		size_t Offset;
+
+		/**
+		 * \brief Attribute size in bytes, also stride of packed stream
+		 */
+		size_t Size;
+
+		/**
+		 * \brief Packed stream, count * Size bytes
+		 */
+		char* Data;
+	};
+
+	/**
+	 * \brief Read only attribute stream
+	 */
+	struct ConstAttributeStream {
+		size_t      Offset;
+		size_t      Size;
+		const char* Data;
+	};
+
+	/**
+	 * \brief Split interleaved records into packed attribute streams, records are walked in L1
+	 *		  sized blocks. 2 to 4 streams of 4 byte components filling an 8 to 16 byte record,
+	 *		  such as xyz float positions to x/y/z arrays, are transposed with SSE
+	 * \param records first record
+	 * \param count record count
+	 * \param stride record size in bytes
+	 * \param streams attribute streams to write
+	 * \param streamCount stream count
+	 * \return false if an attribute is out of record
+	 */
+	VIS_CORE_EXPORTS bool Deinterleave(const char* records, size_t count, size_t stride, const AttributeStream* streams,
+	                                   size_t streamCount);
+
+	/**
+	 * \brief Merge packed attribute streams into interleaved records, bytes not covered by
+	 *		  any attribute are left as they are
+	 * \param records first record, count * stride bytes
+	 * \param count record count
+	 * \param stride record size in bytes
+	 * \param streams attribute streams to read
+	 * \param streamCount stream count
+	 * \return false if an attribute is out of record
+	 */
+	VIS_CORE_EXPORTS bool Interleave(char* records, size_t count, size_t stride, const ConstAttributeStream* streams,
+	                                 size_t streamCount);
+
+	/**
+	 * \brief Split records of buffer region into attribute streams
+	 * \param buffer buffer holding records
+	 * \param offset first record offset in bytes
+	 * \param count record count
+	 * \param stride record size in bytes
+	 * \return false if region is out of buffer or an attribute is out of record
+	 */
+	VIS_CORE_EXPORTS bool DeinterleaveRegion(const IBuffer& buffer, size_t offset, size_t count, size_t stride,
+	                                         const AttributeStream* streams, size_t streamCount);
+
+	/**
+	 * \brief Merge attribute streams into records of buffer region
+	 * \param buffer buffer holding records
+	 * \param offset first record offset in bytes
+	 * \param count record count
+	 * \param stride record size in bytes
+	 * \return false if region is out of buffer, buffer has no writable memory or an attribute is out of record
+	 */
+	VIS_CORE_EXPORTS bool InterleaveRegion(IBuffer& buffer, size_t offset, size_t count, size_t stride,
+	                                       const ConstAttributeStream* streams, size_t streamCount);
+
+	/**
+	 * \brief Get min and max of packed floats, NaN is ignored
+	 * \param data values
+	 * \param count value count
+	 * \param min min value output
+	 * \param max max value output
+	 * \return false if there is no value other than NaN
+	 */
+	VIS_CORE_EXPORTS bool ComputeMinMax(const float* data, size_t count, float& min, float& max);
+
+	/**
+	 * \brief Get sum of packed floats, accumulated in double
+	 */
+	VIS_CORE_EXPORTS double ComputeSum(const float* data, size_t count);
+
+	/**
+	 * \brief Get per component bounds of float vectors, such as box of vertex positions.
+	 *		  Packed vectors of 1 to 4 components run with SSE, NaN is ignored
+	 * \param data first vector, no alignment needed
+	 * \param count vector count
+	 * \param stride vector distance in bytes, components * 4 for packed vectors
+	 * \param components float component count of each vector
+	 * \param min per component min output
+	 * \param max per component max output
+	 * \return false if count is 0, stride is less than vector size or every value is NaN
+	 */
+	VIS_CORE_EXPORTS bool ComputeBounds(const char* data, size_t count, size_t stride, size_t components, float* min,
+	                                    float* max);
+}
+
+#endif //VISCORE_BUFFER_VERTEX_DATA_H
@@ -0,0 +1,173 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * File class interface
+ * */
+#pragma once
+
+#ifndef VISCORE_FILE_H
+#define VISCORE_FILE_H
+
+#include <cstdint>
+#include <memory>
+
+#include "Buffer/Buffer.h"
+#include "FileAccess.h"
+#include "FileMode.h"
+#include "FileOptions.h"
+#include "FileType.h"
+#include "Streaming/Streaming.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::File {
+	class IFile;
+	typedef std::shared_ptr<IFile> IFilePtr;
+
+	/**
+	 * \brief Open file
+	 * \param path file path
+	 * \param mode how to open or create file
+	 * \param access read/write access
+	 * \param type text or binary, both are read/write as raw bytes
+	 * \param options extra options, see FileOptions
+	 * \return opened file, nullptr if open failed
+	 */
+	VIS_CORE_EXPORTS IFilePtr OpenFile(const char* path, FileMode mode, FileAccess access,
+	                                   FileType type = FileType::Binary, const FileOptions& options = {});
+
+	/**
+	 * \brief Load whole file into one buffer. Buffer is allocated once and disjoint ranges are read
+	 *		  in place by several threads with positional reads
+	 * \param path file path
+	 * \param type buffer type
+	 * \param threads max reader count, 0 means hardware concurrency, small files use one thread
+	 * \param options Direct reads bypass OS page cache into aligned buffer, other options are ignored
+	 * \return loaded buffer, nullptr if open or read failed
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr LoadFile(const char* path, Buffer::BufferType type, size_t threads = 0,
+	                                             const FileOptions& options = {});
+
+	/**
+	 * \brief OS handle of file, socket or pipe, file descriptor on POSIX, HANDLE on Windows
+	 */
+	#if defined(_WIN32)
+	typedef void* FileHandle;
+	#else
+	typedef int FileHandle;
+	#endif
+
+	/**
+	 * \brief Copy bytes from source position to sink position, both positions move forward.
+	 *		  File to file copies inside kernel (copy_file_range/sendfile on Linux), contiguous
+	 *		  streaming buffers are written straight from memory, others go through a reused
+	 *		  aligned bounce buffer of calling thread
+	 * \param source stream to read, files opened by OpenFile() avoid user space copy
+	 * \param sink file to write
+	 * \param length max bytes to copy
+	 * \return size copied, less than length at end of source, -1 if failed before any byte copied
+	 */
+	VIS_CORE_EXPORTS size_t Transfer(Streaming::IStreaming& source, IFile& sink, size_t length);
+
+	/**
+	 * \brief Copy bytes from source position to blocking OS handle, e.g. socket or pipe. Handle
+	 *		  is written at its own position and is not closed. Files opened by OpenFile() use
+	 *		  sendfile/splice on Linux
+	 * \param source stream to read
+	 * \param sink writable OS handle
+	 * \param length max bytes to copy
+	 * \return size copied, less than length at end of source, -1 if failed before any byte copied
+	 */
+	VIS_CORE_EXPORTS size_t Transfer(Streaming::IStreaming& source, FileHandle sink, size_t length);
+
+	/**
+	 * \brief File Class Interface, sequential access through IStreaming and positional access
+	 *		  through ReadAt()/WriteAt(). Instance is not thread safe
+	 */
+	class VIS_CORE_EXPORTS IFile : public Streaming::IStreaming {
+	public:
+		~IFile() override = default;
+
+		/**
+		 * \brief Write data at current position, position moves forward
+		 * \param data data ptr
+		 * \param length data length
+		 * \return size successfully written, -1 if failed
+		 */
+		[[maybe_unused]]
+		virtual size_t Write(const char* data, size_t length) = 0;
+
+		/**
+		 * \brief Write buffer data at current position, position moves forward
+		 * \param buffer source buffer
+		 * \param length write length, if length large than buffer size, will use buffer size as length
+		 * \return size successfully written, -1 if failed
+		 */
+		[[maybe_unused]]
+		virtual size_t Write(const Buffer::IBuffer* buffer, size_t length) = 0;
+
+		/**
+		 * \brief Read at given position, current position is not changed
+		 * \param offset file offset
+		 * \param data destination
+		 * \param length read length
+		 * \return size successfully read, less than length at end of file, -1 if failed
+		 */
+		[[maybe_unused]]
+		virtual size_t ReadAt(uint64_t offset, char* data, size_t length) = 0;
+
+		/**
+		 * \brief Write at given position, current position is not changed
+		 * \param offset file offset
+		 * \param data data ptr
+		 * \param length data length
+		 * \return size successfully written, -1 if failed
+		 */
+		[[maybe_unused]]
+		virtual size_t WriteAt(uint64_t offset, const char* data, size_t length) = 0;
+
+		/**
+		 * \brief Get file size
+		 * \return file size, -1 if failed
+		 */
+		[[nodiscard]]
+		virtual size_t GetSize() const = 0;
+
+		/**
+		 * \brief Push data buffered by this instance to OS
+		 * \return false if failed
+		 */
+		virtual bool Flush() = 0;
+
+		/**
+		 * \brief Flush() then wait OS write data to device
+		 * \return false if failed
+		 */
+		virtual bool Sync() = 0;
+
+		/**
+		 * \brief Get if file bypass OS page cache, false when Direct is not requested or not supported
+		 */
+		[[nodiscard]]
+		virtual bool IsDirect() const = 0;
+
+		/**
+		 * \brief Get open mode
+		 */
+		[[nodiscard]]
+		virtual FileMode GetMode() const = 0;
+
+		/**
+		 * \brief Get file access
+		 */
+		[[nodiscard]]
+		virtual FileAccess GetAccess() const = 0;
+
+		/**
+		 * \brief Get file type
+		 */
+		[[nodiscard]]
+		virtual FileType GetType() const = 0;
+	};
+}
+
+#endif //VISCORE_FILE_H
@@ -35,7 +35,7 @@ namespace VisCore::File {
 		ReadWrite = 3,
 	};
 
-	inline const char* VIS_CORE_EXPORTS ToString(FileAccess fileAccess) {
+	inline const char* ToString(FileAccess fileAccess) {
 		switch (fileAccess) {
 			case FileAccess::Read:
 				return "Read";
@@ -49,7 +49,7 @@ namespace VisCore::File {
 		Append = 5,
 	};
 
-	inline const char* VIS_CORE_EXPORTS ToString(FileMode fileMode) {
+	inline const char* ToString(FileMode fileMode) {
 		switch (fileMode) {
 			case FileMode::Create:
 				return "Create";
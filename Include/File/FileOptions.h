@@ -0,0 +1,46 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * File open options
+ * */
+#pragma once
+
+#ifndef VISCORE_FILE_OPTIONS_H
+#define VISCORE_FILE_OPTIONS_H
+
+#include <cstddef>
+
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::File {
+	/**
+	 * \brief Extra options used by OpenFile()
+	 */
+	struct FileOptions {
+		/**
+		 * \brief Bypass OS page cache (O_DIRECT / FILE_FLAG_NO_BUFFERING) for large sequential I/O.
+		 *		  Unaligned head and tail go through an aligned staging block,
+		 *		  fall back to cached I/O if file system does not support it
+		 */
+		bool Direct = false;
+
+		/**
+		 * \brief Write() copies into memory blocks and a background thread writes full blocks to file.
+		 *		  Only used with write access, Flush()/Sync() wait for all pending blocks
+		 */
+		bool WriteBehind = false;
+
+		/**
+		 * \brief Write behind block size in bytes
+		 */
+		size_t BlockSize = 4 * 1024 * 1024;
+
+		/**
+		 * \brief Write behind block count, at least 2. Write() waits when all blocks are pending,
+		 *		  so memory used is bounded by BlockSize * BlockCount
+		 */
+		size_t BlockCount = 4;
+	};
+}
+
+#endif //VISCORE_FILE_OPTIONS_H
@@ -30,7 +30,7 @@ namespace VisCore::File {
 		Streaming = 2
 	};
 
-	inline const char* VIS_CORE_EXPORTS ToString(FileType buffer) {
+	inline const char* ToString(FileType buffer) {
 		switch (buffer) {
 			case FileType::Text:
 				return "Text";
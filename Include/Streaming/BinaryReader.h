@@ -0,0 +1,167 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Typed binary reader over streaming and buffers
+ * */
+#pragma once
+
+#ifndef VISCORE_STREAMING_BINARY_READER_H
+#define VISCORE_STREAMING_BINARY_READER_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "Buffer/Buffer.h"
+#include "Buffer/ByteSwap.h"
+#include "Buffer/Span.h"
+#include "ByteOrder.h"
+#include "Streaming.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Streaming {
+	/**
+	 * \brief Read trivially copyable values. Stream source is read ahead in chunks so each value is a
+	 *		  memcpy from the chunk, buffer source is read in place
+	 */
+	class VIS_CORE_EXPORTS BinaryReader {
+	public:
+		/**
+		 * \param stream source, read from current position, must outlive reader.
+		 *		  Stream position runs ahead of Tell() by unread part of chunk
+		 * \param chunkSize bytes requested by each Read() of source
+		 */
+		explicit BinaryReader(IStreaming* stream, size_t chunkSize = 64 * 1024);
+
+		/**
+		 * \param buffer source, must outlive reader and keep its data in place
+		 * \param offset start offset
+		 */
+		explicit BinaryReader(const Buffer::IBuffer& buffer, size_t offset = 0);
+
+		BinaryReader(BinaryReader&& other) = delete;
+		BinaryReader(const BinaryReader& other) = delete;
+
+		BinaryReader& operator=(BinaryReader&& other) = delete;
+		BinaryReader& operator=(const BinaryReader& other) = delete;
+
+		/**
+		 * \brief Read one value, arithmetic and enum values are converted from Order
+		 * \param value output, unchanged if failed
+		 * \return false at end of data or if read failed
+		 */
+		template<typename T, ByteOrder Order = ByteOrder::Little>
+		bool Read(T& value) {
+			static_assert(std::is_trivially_copyable_v<T>, "value must be trivially copyable");
+			static_assert(Order == ByteOrder::Native || std::is_arithmetic_v<T> || std::is_enum_v<T>,
+			              "byte order conversion needs arithmetic or enum type");
+
+			T result;
+			if (static_cast<size_t>(End - Cursor) >= sizeof(T)) {
+				memcpy(&result, Cursor, sizeof(T));
+				Cursor += sizeof(T);
+			} else if (!ReadBytes(reinterpret_cast<char*>(&result), sizeof(T))) {
+				return false;
+			}
+
+			if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+				result = ConvertByteOrder<Order>(result);
+
+			value = result;
+			return true;
+		}
+
+		/**
+		 * \brief Read one value, check IsFailed() after a sequence of reads
+		 * \return value, T{} at end of data
+		 */
+		template<typename T, ByteOrder Order = ByteOrder::Little>
+		T Read() {
+			T value{};
+			Read<T, Order>(value);
+			return value;
+		}
+
+		/**
+		 * \brief Read values.size() values in one copy, then convert from Order with bulk byte swap
+		 * \return false if not all values could be read
+		 */
+		template<typename T, ByteOrder Order = ByteOrder::Little>
+		bool ReadArray(Buffer::Span<T> values) {
+			static_assert(std::is_trivially_copyable_v<T> && !std::is_const_v<T>, "values must be writable and trivially copyable");
+			static_assert(Order == ByteOrder::Native || std::is_arithmetic_v<T> || std::is_enum_v<T>,
+			              "byte order conversion needs arithmetic or enum type");
+
+			if (!ReadBytes(reinterpret_cast<char*>(values.data()), values.size_bytes()))
+				return false;
+
+			if constexpr (Order != ByteOrder::Native && sizeof(T) > 1)
+				Buffer::ByteSwapArray(reinterpret_cast<char*>(values.data()), values.size(), sizeof(T));
+
+			return true;
+		}
+
+		/**
+		 * \brief Read raw bytes
+		 * \return false if not all bytes could be read
+		 */
+		bool ReadBytes(char* data, size_t size);
+
+		/**
+		 * \brief Read unsigned LEB128, at most 10 bytes
+		 * \return false at end of data or if encoding is too long
+		 */
+		bool ReadVarint(uint64_t& value);
+
+		/**
+		 * \brief Read signed LEB128, at most 10 bytes
+		 * \return false at end of data or if encoding is too long
+		 */
+		bool ReadSignedVarint(int64_t& value);
+
+		/**
+		 * \brief Skip bytes
+		 * \return false if end of data is reached first
+		 */
+		bool Skip(size_t size);
+
+		/**
+		 * \brief Get bytes consumed so far
+		 */
+		[[nodiscard]]
+		uint64_t Tell() const;
+
+		/**
+		 * \brief Get if a read hit end of data or source Read() failed
+		 */
+		[[nodiscard]]
+		bool IsFailed() const;
+
+	private:
+		/**
+		 * \brief Read next chunk of stream
+		 * \return false at end of stream or if read failed
+		 */
+		bool Fill();
+
+		IStreaming*        Stream;
+		Buffer::IBufferPtr Chunk;
+		size_t             ChunkSize;
+
+		/**
+		 * \brief Unread data, in Chunk or in source buffer
+		 */
+		const char* Cursor = nullptr;
+		const char* End    = nullptr;
+
+		/**
+		 * \brief Bytes consumed before Base, Base is start of current chunk
+		 */
+		uint64_t    Consumed = 0;
+		const char* Base     = nullptr;
+
+		bool Failed = false;
+	};
+}
+
+#endif //VISCORE_STREAMING_BINARY_READER_H
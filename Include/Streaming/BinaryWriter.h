@@ -0,0 +1,162 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Typed binary writer over files and buffers
+ * */
+#pragma once
+
+#ifndef VISCORE_STREAMING_BINARY_WRITER_H
+#define VISCORE_STREAMING_BINARY_WRITER_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "Buffer/Buffer.h"
+#include "Buffer/Span.h"
+#include "ByteOrder.h"
+#include "File/File.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Streaming {
+	/**
+	 * \brief Write trivially copyable values. Values are collected in a staging chunk,
+	 *		  sink is written once per chunk and on Flush()
+	 */
+	class VIS_CORE_EXPORTS BinaryWriter {
+	public:
+		/**
+		 * \param file sink, written at its current position, must outlive writer
+		 * \param chunkSize staging chunk size
+		 */
+		explicit BinaryWriter(File::IFile* file, size_t chunkSize = 64 * 1024);
+
+		/**
+		 * \param buffer sink, written through Update(), data past end is appended so only
+		 *		  dynamic buffer can grow, must outlive writer
+		 * \param offset start offset
+		 * \param chunkSize staging chunk size
+		 */
+		explicit BinaryWriter(Buffer::IBuffer& buffer, size_t offset = 0, size_t chunkSize = 64 * 1024);
+
+		/**
+		 * \brief Flush staged data
+		 */
+		~BinaryWriter();
+
+		BinaryWriter(BinaryWriter&& other) = delete;
+		BinaryWriter(const BinaryWriter& other) = delete;
+
+		BinaryWriter& operator=(BinaryWriter&& other) = delete;
+		BinaryWriter& operator=(const BinaryWriter& other) = delete;
+
+		/**
+		 * \brief Write one value, arithmetic and enum values are converted to Order
+		 * \return false if sink write failed
+		 */
+		template<typename T, ByteOrder Order = ByteOrder::Little>
+		bool Write(const T& value) {
+			static_assert(std::is_trivially_copyable_v<T>, "value must be trivially copyable");
+			static_assert(Order == ByteOrder::Native || std::is_arithmetic_v<T> || std::is_enum_v<T>,
+			              "byte order conversion needs arithmetic or enum type");
+
+			T stored = value;
+			if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+				stored = ConvertByteOrder<Order>(value);
+
+			if (static_cast<size_t>(End - Cursor) >= sizeof(T)) {
+				memcpy(Cursor, &stored, sizeof(T));
+				Cursor += sizeof(T);
+				return true;
+			}
+			return WriteBytes(reinterpret_cast<const char*>(&stored), sizeof(T));
+		}
+
+		/**
+		 * \brief Write values, converted to Order
+		 * \return false if sink write failed
+		 */
+		template<typename T, ByteOrder Order = ByteOrder::Little>
+		bool WriteArray(Buffer::Span<const T> values) {
+			static_assert(std::is_trivially_copyable_v<T>, "values must be trivially copyable");
+			static_assert(Order == ByteOrder::Native || std::is_arithmetic_v<T> || std::is_enum_v<T>,
+			              "byte order conversion needs arithmetic or enum type");
+
+			if constexpr (Order == ByteOrder::Native || sizeof(T) == 1) {
+				return WriteBytes(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+			} else {
+				for (const auto& value : values) {
+					if (!Write<T, Order>(value))
+						return false;
+				}
+				return true;
+			}
+		}
+
+		/**
+		 * \brief Write raw bytes
+		 * \return false if sink write failed
+		 */
+		bool WriteBytes(const char* data, size_t size);
+
+		/**
+		 * \brief Write unsigned LEB128
+		 * \return false if sink write failed
+		 */
+		bool WriteVarint(uint64_t value);
+
+		/**
+		 * \brief Write signed LEB128
+		 * \return false if sink write failed
+		 */
+		bool WriteSignedVarint(int64_t value);
+
+		/**
+		 * \brief Write staged data to sink
+		 * \return false if sink write failed
+		 */
+		bool Flush();
+
+		/**
+		 * \brief Get bytes written so far, staged data included
+		 */
+		[[nodiscard]]
+		uint64_t Tell() const;
+
+		/**
+		 * \brief Get if a sink write failed
+		 */
+		[[nodiscard]]
+		bool IsFailed() const;
+
+	private:
+		/**
+		 * \brief Write size bytes to sink
+		 */
+		bool WriteSink(const char* data, size_t size);
+
+		File::IFile*     Sink   = nullptr;
+		Buffer::IBuffer* Target = nullptr;
+
+		/**
+		 * \brief Next sink offset of buffer target
+		 */
+		size_t Offset = 0;
+
+		Buffer::IBufferPtr Chunk;
+
+		/**
+		 * \brief Free part of Chunk
+		 */
+		char* Cursor = nullptr;
+		char* End    = nullptr;
+
+		/**
+		 * \brief Bytes given to sink so far
+		 */
+		uint64_t Written = 0;
+		bool     Failed  = false;
+	};
+}
+
+#endif //VISCORE_STREAMING_BINARY_WRITER_H
@@ -0,0 +1,93 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Byte order and byte swap helpers
+ * */
+#pragma once
+
+#ifndef VISCORE_STREAMING_BYTE_ORDER_H
+#define VISCORE_STREAMING_BYTE_ORDER_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+namespace VisCore::Streaming {
+	/**
+	 * \brief Byte order of stored data
+	 */
+	enum class ByteOrder : uint8_t {
+		Little = 0,
+		Big    = 1,
+		#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		Native = Big
+		#else
+		Native = Little
+		#endif
+	};
+
+	inline uint16_t ByteSwap(const uint16_t value) {
+		#if defined(_MSC_VER)
+		return _byteswap_ushort(value);
+		#else
+		return __builtin_bswap16(value);
+		#endif
+	}
+
+	inline uint32_t ByteSwap(const uint32_t value) {
+		#if defined(_MSC_VER)
+		return _byteswap_ulong(value);
+		#else
+		return __builtin_bswap32(value);
+		#endif
+	}
+
+	inline uint64_t ByteSwap(const uint64_t value) {
+		#if defined(_MSC_VER)
+		return _byteswap_uint64(value);
+		#else
+		return __builtin_bswap64(value);
+		#endif
+	}
+
+	/**
+	 * \brief Reverse bytes of arithmetic or enum value, float is swapped as its bit pattern
+	 */
+	template<typename T>
+	T ByteSwapValue(const T value) {
+		static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "only arithmetic and enum types have byte order");
+
+		if constexpr (sizeof(T) == 1) {
+			return value;
+		} else {
+			using Bits = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+			static_assert(sizeof(T) == sizeof(Bits), "unsupported value size");
+
+			Bits bits;
+			memcpy(&bits, &value, sizeof(T));
+			bits = ByteSwap(bits);
+
+			T result;
+			memcpy(&result, &bits, sizeof(T));
+			return result;
+		}
+	}
+
+	/**
+	 * \brief Convert between native order and Order, same call converts both ways
+	 */
+	template<ByteOrder Order, typename T>
+	T ConvertByteOrder(const T value) {
+		if constexpr (Order == ByteOrder::Native || sizeof(T) == 1) {
+			return value;
+		} else {
+			return ByteSwapValue(value);
+		}
+	}
+}
+
+#endif //VISCORE_STREAMING_BYTE_ORDER_H
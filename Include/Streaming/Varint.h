@@ -0,0 +1,87 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Batched LEB128 and group varint encoding
+ * */
+#pragma once
+
+#ifndef VISCORE_STREAMING_VARINT_H
+#define VISCORE_STREAMING_VARINT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Streaming {
+	/**
+	 * \brief Get LEB128 size of value, 1 to 10 bytes
+	 */
+	VIS_CORE_EXPORTS size_t GetVarintSize(uint64_t value);
+
+	/**
+	 * \brief Encode values as unsigned LEB128
+	 * \param values values
+	 * \param count value count
+	 * \param destination output, 10 bytes per value at most
+	 * \return written bytes
+	 */
+	VIS_CORE_EXPORTS size_t EncodeVarints(const uint64_t* values, size_t count, char* destination);
+
+	/**
+	 * \brief Encode values as unsigned LEB128
+	 * \param values values
+	 * \param count value count
+	 * \param destination output, 5 bytes per value at most
+	 * \return written bytes
+	 */
+	VIS_CORE_EXPORTS size_t EncodeVarints(const uint32_t* values, size_t count, char* destination);
+
+	/**
+	 * \brief Decode unsigned LEB128 values. Runs of 1 byte values are copied 8 at a time,
+	 *		  other values ending in the same 8 byte load are decoded from it without reloading
+	 * \param data encoded data
+	 * \param size data size
+	 * \param values output
+	 * \param count max value count
+	 * \param consumed bytes consumed, value cut by end of data is not consumed
+	 * \return decoded value count, -1 if a value is longer than 10 bytes
+	 */
+	VIS_CORE_EXPORTS size_t DecodeVarints(const char* data, size_t size, uint64_t* values, size_t count, size_t& consumed);
+
+	/**
+	 * \brief Decode unsigned LEB128 values into 32 bit output
+	 * \return decoded value count, -1 if a value does not fit in 32 bits
+	 */
+	VIS_CORE_EXPORTS size_t DecodeVarints(const char* data, size_t size, uint32_t* values, size_t count, size_t& consumed);
+
+	/**
+	 * \brief Get group varint size of count values at most
+	 */
+	VIS_CORE_EXPORTS size_t GetGroupVarintMaxSize(size_t count);
+
+	/**
+	 * \brief Encode values as group varint: one tag byte with 2 bit length - 1 of each of 4 values,
+	 *		  then the values in 1 to 4 little endian bytes. Last group is padded with 0 values
+	 * \param values values
+	 * \param count value count
+	 * \param destination output, GetGroupVarintMaxSize() bytes
+	 * \return written bytes
+	 */
+	VIS_CORE_EXPORTS size_t EncodeGroupVarint(const uint32_t* values, size_t count, char* destination);
+
+	/**
+	 * \brief Decode group varint, one shuffle per group when cpu supports SSSE3
+	 * \param data encoded data
+	 * \param size data size
+	 * \param values output
+	 * \param count max value count, rest of a group past count is skipped so keep it multiple of 4
+	 *		  except for the last call
+	 * \param consumed bytes consumed, group cut by end of data is not consumed
+	 * \return decoded value count
+	 */
+	VIS_CORE_EXPORTS size_t DecodeGroupVarint(const char* data, size_t size, uint32_t* values, size_t count,
+	                                          size_t& consumed);
+}
+
+#endif //VISCORE_STREAMING_VARINT_H
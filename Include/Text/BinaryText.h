@@ -0,0 +1,149 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Base64 and hex text form of binary data
+ * */
+#pragma once
+
+#ifndef VISCORE_TEXT_BINARY_TEXT_H
+#define VISCORE_TEXT_BINARY_TEXT_H
+
+#include <cstddef>
+
+#include "Buffer/Buffer.h"
+#include "Streaming/Streaming.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Text {
+	/**
+	 * \brief Bytes read from source by each Read() of streaming variants
+	 */
+	constexpr size_t BinaryTextChunkSize = 1024 * 1024;
+
+	/**
+	 * \brief Get Base64 text size of size bytes, with padding
+	 */
+	VIS_CORE_EXPORTS size_t GetBase64EncodedSize(size_t size);
+
+	/**
+	 * \brief Get exact decoded size of Base64 text
+	 * \param data text, only last 2 characters are inspected
+	 * \param size text size, must be multiple of 4
+	 * \return decoded size, -1 if size is not multiple of 4
+	 */
+	VIS_CORE_EXPORTS size_t GetBase64DecodedSize(const char* data, size_t size);
+
+	/**
+	 * \brief Encode standard Base64 (RFC 4648) with padding, SSSE3 when cpu supports it
+	 * \param data binary data
+	 * \param size data size
+	 * \param destination output, must hold GetBase64EncodedSize() bytes
+	 * \return written bytes
+	 */
+	VIS_CORE_EXPORTS size_t EncodeBase64(const char* data, size_t size, char* destination);
+
+	/**
+	 * \brief Decode standard Base64, padding is required and line breaks are not accepted
+	 * \param data text
+	 * \param size text size
+	 * \param destination output, must hold GetBase64DecodedSize() bytes
+	 * \return written bytes, -1 if text is invalid
+	 */
+	VIS_CORE_EXPORTS size_t DecodeBase64(const char* data, size_t size, char* destination);
+
+	/**
+	 * \brief Encode whole buffer into new buffer of exact size
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr EncodeBase64(const Buffer::IBuffer& source,
+	                                                 Buffer::BufferType type = Buffer::BufferType::Constraint);
+
+	/**
+	 * \brief Decode whole buffer into new buffer of exact size
+	 * \return decoded buffer, nullptr if text is invalid
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr DecodeBase64(const Buffer::IBuffer& source,
+	                                                 Buffer::BufferType type = Buffer::BufferType::Constraint);
+
+	/**
+	 * \brief Encode from current position to end of stream, read chunk by chunk
+	 * \param source seekable stream, size is taken from end position
+	 * \param type output buffer type
+	 * \param chunkSize bytes read per Read()
+	 * \return encoded buffer, nullptr if seek or read failed
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr EncodeBase64(Streaming::IStreaming* source,
+	                                                 Buffer::BufferType type = Buffer::BufferType::Constraint,
+	                                                 size_t chunkSize = BinaryTextChunkSize);
+
+	/**
+	 * \brief Decode from current position to end of stream, read chunk by chunk
+	 * \param source seekable stream, size is taken from end position
+	 * \param type output buffer type
+	 * \param chunkSize bytes read per Read()
+	 * \return decoded buffer, nullptr if text is invalid or seek or read failed
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr DecodeBase64(Streaming::IStreaming* source,
+	                                                 Buffer::BufferType type = Buffer::BufferType::Constraint,
+	                                                 size_t chunkSize = BinaryTextChunkSize);
+
+	/**
+	 * \brief Get hex text size of size bytes
+	 */
+	VIS_CORE_EXPORTS size_t GetHexEncodedSize(size_t size);
+
+	/**
+	 * \brief Get decoded size of hex text
+	 * \return decoded size, -1 if size is odd
+	 */
+	VIS_CORE_EXPORTS size_t GetHexDecodedSize(size_t size);
+
+	/**
+	 * \brief Encode hex, 2 characters per byte
+	 * \param data binary data
+	 * \param size data size
+	 * \param destination output, must hold GetHexEncodedSize() bytes
+	 * \param upperCase use 'A'-'F' instead of 'a'-'f'
+	 * \return written bytes
+	 */
+	VIS_CORE_EXPORTS size_t EncodeHex(const char* data, size_t size, char* destination, bool upperCase = false);
+
+	/**
+	 * \brief Decode hex, either case is accepted
+	 * \param data text
+	 * \param size text size
+	 * \param destination output, must hold GetHexDecodedSize() bytes
+	 * \return written bytes, -1 if text is invalid
+	 */
+	VIS_CORE_EXPORTS size_t DecodeHex(const char* data, size_t size, char* destination);
+
+	/**
+	 * \brief Encode whole buffer into new buffer of exact size
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr EncodeHex(const Buffer::IBuffer& source, bool upperCase = false,
+	                                              Buffer::BufferType type = Buffer::BufferType::Constraint);
+
+	/**
+	 * \brief Decode whole buffer into new buffer of exact size
+	 * \return decoded buffer, nullptr if text is invalid
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr DecodeHex(const Buffer::IBuffer& source,
+	                                              Buffer::BufferType type = Buffer::BufferType::Constraint);
+
+	/**
+	 * \brief Encode from current position to end of stream, read chunk by chunk
+	 * \return encoded buffer, nullptr if seek or read failed
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr EncodeHex(Streaming::IStreaming* source, bool upperCase = false,
+	                                              Buffer::BufferType type = Buffer::BufferType::Constraint,
+	                                              size_t chunkSize = BinaryTextChunkSize);
+
+	/**
+	 * \brief Decode from current position to end of stream, read chunk by chunk
+	 * \return decoded buffer, nullptr if text is invalid or seek or read failed
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr DecodeHex(Streaming::IStreaming* source,
+	                                              Buffer::BufferType type = Buffer::BufferType::Constraint,
+	                                              size_t chunkSize = BinaryTextChunkSize);
+}
+
+#endif //VISCORE_TEXT_BINARY_TEXT_H
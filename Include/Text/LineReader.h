@@ -0,0 +1,129 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Line and record reader over streaming
+ * */
+#pragma once
+
+#ifndef VISCORE_TEXT_LINE_READER_H
+#define VISCORE_TEXT_LINE_READER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Buffer/Buffer.h"
+#include "Streaming/Streaming.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Text {
+	/**
+	 * \brief LineReader options
+	 */
+	struct LineReaderOptions {
+		/**
+		 * \brief Record delimiter, any non empty byte sequence
+		 */
+		std::string Delimiter = "\n";
+
+		/**
+		 * \brief Drop '\r' left before delimiter, so "\r\n" files read as "\n" files
+		 */
+		bool TrimCarriageReturn = true;
+
+		/**
+		 * \brief Bytes requested by each Read() of source
+		 */
+		size_t ChunkSize = 1024 * 1024;
+	};
+
+	/**
+	 * \brief Split streaming into records. Delimiters are found 64 bytes at a time with SIMD compare,
+	 *		  records inside one chunk are returned in place, only records crossing chunk boundary are copied
+	 */
+	class VIS_CORE_EXPORTS LineReader {
+	public:
+		/**
+		 * \param stream source, read from current position, must outlive reader
+		 * \param options delimiter and chunk options
+		 */
+		explicit LineReader(Streaming::IStreaming* stream, const LineReaderOptions& options = {});
+
+		LineReader(LineReader&& other) = delete;
+		LineReader(const LineReader& other) = delete;
+
+		LineReader& operator=(LineReader&& other) = delete;
+		LineReader& operator=(const LineReader& other) = delete;
+
+		/**
+		 * \brief Get next record without delimiter, last record may have no delimiter
+		 * \param line record, valid until next call
+		 * \return false at end of stream or if read failed
+		 */
+		bool Next(std::string_view& line);
+
+		/**
+		 * \brief Get count of records returned so far
+		 */
+		[[nodiscard]]
+		uint64_t GetLineCount() const;
+
+		/**
+		 * \brief Get if a source Read() failed
+		 */
+		[[nodiscard]]
+		bool IsFailed() const;
+
+	private:
+		/**
+		 * \brief Find first delimiter byte in [from, End)
+		 * \return position, nullptr if not found
+		 */
+		const char* FindFirstByte(const char* from);
+
+		/**
+		 * \brief Find whole delimiter in [from, End)
+		 * \return position, nullptr if not found
+		 */
+		const char* FindDelimiter(const char* from);
+
+		/**
+		 * \brief Read next chunk into Chunk
+		 * \return false at end of stream or if read failed
+		 */
+		bool Fill();
+
+		/**
+		 * \brief Return record and apply carriage return trimming
+		 */
+		std::string_view Yield(const char* data, size_t size);
+
+		Streaming::IStreaming* Stream;
+		LineReaderOptions      Options;
+		Buffer::IBufferPtr     Chunk;
+
+		/**
+		 * \brief Unscanned part of Chunk
+		 */
+		const char* Begin = nullptr;
+		const char* End   = nullptr;
+
+		/**
+		 * \brief Match bits of 64 byte block at MaskBase
+		 */
+		const char* MaskBase = nullptr;
+		uint64_t    Mask     = 0;
+
+		/**
+		 * \brief Record head copied from previous chunks
+		 */
+		std::string Carry;
+		bool        CarryReturned = false;
+
+		uint64_t Lines  = 0;
+		bool     Eof    = false;
+		bool     Failed = false;
+	};
+}
+
+#endif //VISCORE_TEXT_LINE_READER_H
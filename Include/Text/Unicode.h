@@ -0,0 +1,138 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * UTF-8/UTF-16/UTF-32 validation and transcoding
+ * */
+#pragma once
+
+#ifndef VISCORE_TEXT_UNICODE_H
+#define VISCORE_TEXT_UNICODE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Buffer/Buffer.h"
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Text {
+	/**
+	 * \brief Unicode encoding form, UTF-16 and UTF-32 use native byte order
+	 */
+	enum class Encoding : uint8_t {
+		Utf8  = 0,
+		Utf16 = 1,
+		Utf32 = 2
+	};
+
+	inline const char* ToString(const Encoding encoding) {
+		switch (encoding) {
+			case Encoding::Utf8:
+				return "Utf8";
+			case Encoding::Utf16:
+				return "Utf16";
+			case Encoding::Utf32:
+				return "Utf32";
+			default:
+				return "unknown";
+		}
+	}
+
+	/**
+	 * \brief Check UTF-8, reject overlong forms, surrogates, values above U+10FFFF and truncated sequences.
+	 *		  Use AVX2 when cpu supports it
+	 * \param data text
+	 * \param size text size in bytes
+	 * \return true if valid
+	 */
+	VIS_CORE_EXPORTS bool ValidateUtf8(const char* data, size_t size);
+
+	/**
+	 * \brief Check whole buffer is valid UTF-8
+	 */
+	VIS_CORE_EXPORTS bool ValidateUtf8(const Buffer::IBuffer& buffer);
+
+	/**
+	 * \brief Check text in given encoding, size of UTF-16/UTF-32 must be multiple of unit size
+	 * \param data text
+	 * \param size text size in bytes
+	 * \param encoding text encoding
+	 * \return true if valid
+	 */
+	VIS_CORE_EXPORTS bool Validate(const char* data, size_t size, Encoding encoding);
+
+	/**
+	 * \brief Get exact output size of Transcode()
+	 * \param data text
+	 * \param size text size in bytes
+	 * \param from text encoding
+	 * \param to output encoding
+	 * \return output size in bytes, -1 if text is invalid
+	 */
+	VIS_CORE_EXPORTS size_t GetTranscodedSize(const char* data, size_t size, Encoding from, Encoding to);
+
+	/**
+	 * \brief Convert whole text, destination must hold GetTranscodedSize() bytes
+	 * \param data text
+	 * \param size text size in bytes
+	 * \param from text encoding
+	 * \param destination output
+	 * \param to output encoding
+	 * \return written bytes, -1 if text is invalid
+	 */
+	VIS_CORE_EXPORTS size_t Transcode(const char* data, size_t size, Encoding from, char* destination, Encoding to);
+
+	/**
+	 * \brief Convert whole buffer into new buffer of exact size
+	 * \param source text buffer
+	 * \param from text encoding
+	 * \param to output encoding
+	 * \param type output buffer type
+	 * \return converted buffer, nullptr if text is invalid
+	 */
+	VIS_CORE_EXPORTS Buffer::IBufferPtr Transcode(const Buffer::IBuffer& source, Encoding from, Encoding to,
+	                                              Buffer::BufferType type = Buffer::BufferType::Constraint);
+
+	/**
+	 * \brief Incremental transcoding, text may be split anywhere between Convert() calls,
+	 *		  incomplete sequence at chunk end is kept until next chunk
+	 */
+	class VIS_CORE_EXPORTS Transcoder {
+	public:
+		Transcoder(Encoding from, Encoding to);
+
+		/**
+		 * \brief Get output bytes Convert() may write for size input bytes at most
+		 */
+		[[nodiscard]]
+		size_t GetMaxOutputSize(size_t size) const;
+
+		/**
+		 * \brief Convert next chunk
+		 * \param data chunk
+		 * \param size chunk size in bytes
+		 * \param destination output, must hold GetMaxOutputSize(size) bytes
+		 * \return written bytes, -1 if text is invalid
+		 */
+		size_t Convert(const char* data, size_t size, char* destination);
+
+		/**
+		 * \brief End of text
+		 * \return false if an incomplete sequence is left
+		 */
+		[[nodiscard]]
+		bool Finish() const;
+
+		/**
+		 * \brief Drop pending bytes, start a new text
+		 */
+		void Reset();
+
+	private:
+		Encoding From;
+		Encoding To;
+		char     Pending[8];
+		size_t   PendingSize = 0;
+	};
+}
+
+#endif //VISCORE_TEXT_UNICODE_H
@@ -0,0 +1,159 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Work stealing thread pool shared by parallel operations
+ * */
+#pragma once
+
+#ifndef VISCORE_THREAD_POOL_H
+#define VISCORE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Thread {
+	/**
+	 * \brief Thread pool creation options
+	 */
+	struct ThreadPoolConfig {
+		/**
+		 * \brief Worker thread count, 0 means hardware concurrency - 1 since waiting caller also runs tasks
+		 */
+		size_t WorkerCount = 0;
+
+		/**
+		 * \brief CPU index of each worker, worker i is pinned to Affinity[i % size]. Empty means no pinning
+		 */
+		std::vector<size_t> Affinity;
+	};
+
+	/**
+	 * \brief Task scheduler, each worker owns a deque. Worker pushes and pops own tasks at back,
+	 *		  idle workers steal from front of others. Tasks submitted by other threads go to a shared queue
+	 */
+	class VIS_CORE_EXPORTS ThreadPool {
+	public:
+		explicit ThreadPool(const ThreadPoolConfig& config = {});
+
+		/**
+		 * \brief Run remaining tasks then stop workers
+		 */
+		~ThreadPool();
+
+		ThreadPool(ThreadPool&& other) = delete;
+		ThreadPool(const ThreadPool& other) = delete;
+
+		ThreadPool& operator=(ThreadPool&& other) = delete;
+		ThreadPool& operator=(const ThreadPool& other) = delete;
+
+		/**
+		 * \brief Get worker thread count
+		 */
+		[[nodiscard]]
+		size_t GetWorkerCount() const;
+
+		/**
+		 * \brief Queue task without waiting, exception thrown by task terminates program
+		 * \param task task function
+		 */
+		void Submit(std::function<void()> task);
+
+		/**
+		 * \brief Run body over [begin, end) split into sub ranges, calling thread takes part.
+		 *		  Ranges are split in half recursively, so stolen work is large and local work stays contiguous
+		 * \param begin range begin
+		 * \param end range end
+		 * \param body called with each sub range [begin, end)
+		 * \param grain max sub range size, 0 means about 4 ranges per thread
+		 */
+		void ParallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)>& body, size_t grain = 0);
+
+		/**
+		 * \brief Run one queued task on calling thread
+		 * \return false if no task is queued
+		 */
+		bool RunPendingTask();
+
+	private:
+		struct Worker;
+
+		void Push(std::function<void()>&& task);
+
+		bool Pop(std::function<void()>& task);
+
+		void Run(size_t index);
+
+		std::vector<std::unique_ptr<Worker>> Workers;
+		std::deque<std::function<void()>>    Injected;
+		std::mutex                           Mutex;
+		std::condition_variable              WorkReady;
+		std::atomic<size_t>                  Queued{0};
+		std::atomic<size_t>                  Sleeping{0};
+		bool                                 Stopping = false;
+	};
+
+	/**
+	 * \brief Set of tasks that can be waited together
+	 */
+	class VIS_CORE_EXPORTS TaskGroup {
+	public:
+		explicit TaskGroup(ThreadPool& pool);
+		TaskGroup();
+
+		/**
+		 * \brief Wait unfinished tasks, exception is dropped
+		 */
+		~TaskGroup();
+
+		TaskGroup(TaskGroup&& other) = delete;
+		TaskGroup(const TaskGroup& other) = delete;
+
+		TaskGroup& operator=(TaskGroup&& other) = delete;
+		TaskGroup& operator=(const TaskGroup& other) = delete;
+
+		/**
+		 * \brief Queue task into pool
+		 * \param task task function
+		 */
+		void Run(std::function<void()> task);
+
+		/**
+		 * \brief Run queued tasks on calling thread until all tasks of this group finished,
+		 *		  so waiting inside a pool task does not block a worker
+		 * \throw first exception thrown by group tasks
+		 */
+		void Wait();
+
+	private:
+		void Finish();
+
+		ThreadPool&             Pool;
+		std::atomic<size_t>     Pending{0};
+		std::mutex              Mutex;
+		std::condition_variable Done;
+		std::exception_ptr      Error;
+	};
+
+	/**
+	 * \brief Get process wide pool, created on first use
+	 */
+	VIS_CORE_EXPORTS ThreadPool& GetDefaultThreadPool();
+
+	/**
+	 * \brief Set options of process wide pool
+	 * \param config pool options
+	 * \return false if pool was already created
+	 */
+	VIS_CORE_EXPORTS bool ConfigureDefaultThreadPool(const ThreadPoolConfig& config);
+}
+
+#endif //VISCORE_THREAD_POOL_H
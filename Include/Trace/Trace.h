@@ -0,0 +1,122 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ *
+ * Hot path tracing probes with Chrome trace export
+ * */
+#pragma once
+
+#ifndef VISCORE_TRACE_H
+#define VISCORE_TRACE_H
+
+#include <cstdint>
+#include <ostream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#include "VisCoreExport.generate.h"
+
+namespace VisCore::Trace {
+	/**
+	 * \brief Read raw timestamp, TSC ticks on x86, steady clock nanoseconds otherwise
+	 * \return timestamp
+	 */
+	inline uint64_t ReadTimestamp() noexcept {
+		#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+		#else
+		using namespace std::chrono;
+		return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+		#endif
+	}
+
+	/**
+	 * \brief Record complete event into calling thread ring buffer, oldest events are overwritten when full
+	 * \param name event name, must have static lifetime (string literal)
+	 * \param start start timestamp from ReadTimestamp()
+	 * \param end end timestamp from ReadTimestamp()
+	 * \param bytes payload size, exported as event argument
+	 */
+	VIS_CORE_EXPORTS void RecordEvent(const char* name, uint64_t start, uint64_t end, uint64_t bytes) noexcept;
+
+	/**
+	 * \brief Enable or pause recording at runtime, recording is enabled by default
+	 * \param enabled is recording enabled
+	 */
+	VIS_CORE_EXPORTS void SetTraceEnabled(bool enabled) noexcept;
+
+	/**
+	 * \brief Get if recording is enabled
+	 */
+	VIS_CORE_EXPORTS bool IsTraceEnabled() noexcept;
+
+	/**
+	 * \brief Drop all recorded events
+	 */
+	VIS_CORE_EXPORTS void ClearTrace();
+
+	/**
+	 * \brief Write recorded events as Chrome/Perfetto trace JSON, events are kept
+	 * \param stream output stream
+	 * \return false if stream failed
+	 */
+	VIS_CORE_EXPORTS bool WriteChromeTrace(std::ostream& stream);
+
+	/**
+	 * \brief Write recorded events as Chrome/Perfetto trace JSON file
+	 * \param path file path
+	 * \return false if file can not be written
+	 */
+	VIS_CORE_EXPORTS bool WriteChromeTrace(const char* path);
+
+	/**
+	 * \brief RAII probe, record one complete event from construct to destruct
+	 */
+	class TraceScope {
+	public:
+		explicit TraceScope(const char* name, const uint64_t bytes = 0) noexcept
+			: Name(name), Bytes(bytes), Start(ReadTimestamp()) {
+		}
+
+		~TraceScope() {
+			RecordEvent(Name, Start, ReadTimestamp(), Bytes);
+		}
+
+		TraceScope(TraceScope&& other) = delete;
+		TraceScope(const TraceScope& other) = delete;
+
+		TraceScope& operator=(TraceScope&& other) = delete;
+		TraceScope& operator=(const TraceScope& other) = delete;
+
+	private:
+		const char* Name;
+		uint64_t    Bytes;
+		uint64_t    Start;
+	};
+}
+
+#define VIS_CORE_TRACE_CONCAT_IMPL(a, b) a##b
+#define VIS_CORE_TRACE_CONCAT(a, b) VIS_CORE_TRACE_CONCAT_IMPL(a, b)
+
+#if defined(VIS_CORE_ENABLE_TRACE)
+/**
+ * \brief Trace current scope, removed unless built with VIS_CORE_ENABLE_TRACE
+ */
+#define VIS_CORE_TRACE_SCOPE(name) \
+	::VisCore::Trace::TraceScope VIS_CORE_TRACE_CONCAT(visCoreTraceScope, __LINE__)(name)
+/**
+ * \brief Trace current scope with payload size, removed unless built with VIS_CORE_ENABLE_TRACE
+ */
+#define VIS_CORE_TRACE_SCOPE_BYTES(name, bytes) \
+	::VisCore::Trace::TraceScope VIS_CORE_TRACE_CONCAT(visCoreTraceScope, __LINE__)(name, static_cast<uint64_t>(bytes))
+#else
+#define VIS_CORE_TRACE_SCOPE(name) ((void)0)
+#define VIS_CORE_TRACE_SCOPE_BYTES(name, bytes) ((void)0)
+#endif
+
+#endif //VISCORE_TRACE_H
@@ -4,29 +4,73 @@
 
 #include "Buffer/Buffer.h"
 
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BufferStatsTracker.h"
+#include "Buffer/ConcatBuffer.h"
 #include "Buffer/ConstraintBuffer.h"
 #include "Buffer/DynamicBuffer.h"
+#include "Buffer/ManagedBuffer.h"
+#include "Buffer/SharedBuffer.h"
+#include "Buffer/SpillBuffer.h"
 #include "Buffer/StreamingBuffer.h"
+#include "Thread/Parallel.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 using namespace std;
 using namespace VisCore;
 
-Buffer::IBufferPtr Buffer::CreateBuffer(const BufferType type, const size_t size, const char initData) {
-	IBufferPtr buffer;
-	switch (type) {
-		case BufferType::Constraint:
-			buffer = std::make_shared<ConstraintBuffer>();
-			break;
-		case BufferType::Dynamic:
-			buffer = std::make_shared<DynamicBuffer>();
-			break;
-		case BufferType::Streaming:
-			buffer = std::make_shared<StreamingBuffer>();
-			break;
-		default:
-			break;
+namespace {
+	/**
+	 * \brief UpdateMany() only use worker threads when total payload is larger than this
+	 */
+	constexpr size_t ParallelUpdateThreshold = 4 * 1024 * 1024;
+
+	/**
+	 * \brief Create buffer instance without allocate data
+	 */
+	Buffer::IBufferPtr CreateEmptyBuffer(const Buffer::BufferType type) {
+		switch (type) {
+			case Buffer::BufferType::Constraint:
+				return std::make_shared<Buffer::ConstraintBuffer>();
+			case Buffer::BufferType::Dynamic:
+				return std::make_shared<Buffer::DynamicBuffer>();
+			case Buffer::BufferType::Streaming:
+				return std::make_shared<Buffer::StreamingBuffer>();
+			case Buffer::BufferType::Concat:
+				return std::make_shared<Buffer::ConcatBuffer>();
+			case Buffer::BufferType::Managed:
+				return std::make_shared<Buffer::ManagedBuffer>();
+			case Buffer::BufferType::Spill:
+				return std::make_shared<Buffer::SpillBuffer>();
+			case Buffer::BufferType::Shared:
+				return std::make_shared<Buffer::SharedBuffer>();
+			default:
+				return nullptr;
+		}
 	}
 
+	/**
+	 * \brief Copy runs in [begin, end)
+	 */
+	void ApplyRuns(char* data, const Buffer::UpdateRegion* begin, const Buffer::UpdateRegion* end) {
+		for (auto* run = begin; run != end; ++run) {
+			memcpy(data + run->Offset, run->Ptr, run->Size);
+		}
+	}
+}
+
+Buffer::IBufferPtr Buffer::CreateBuffer(const BufferType type, const size_t size, const char initData) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CreateBuffer", size);
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	RecordAllocationSite(VIS_CORE_RETURN_ADDRESS(), size);
+	#endif
+
+	auto buffer = CreateEmptyBuffer(type);
 	if (buffer)
 		buffer->InitBuffer(size, initData);
 
@@ -34,31 +78,241 @@ Buffer::IBufferPtr Buffer::CreateBuffer(const BufferType type, const size_t size
 }
 
 Buffer::IBufferPtr Buffer::CreateBuffer(const BufferType type, const char* ptr, const size_t size) {
-	IBufferPtr buffer;
-	switch (type) {
-		case BufferType::Constraint:
-			buffer = std::make_shared<ConstraintBuffer>();
-			break;
-		case BufferType::Dynamic:
-			buffer = std::make_shared<DynamicBuffer>();
-			break;
-		case BufferType::Streaming:
-			buffer = std::make_shared<StreamingBuffer>();
-			break;
-		default:
-			break;
-	}
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CreateBuffer", size);
 
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	RecordAllocationSite(VIS_CORE_RETURN_ADDRESS(), size);
+	#endif
+
+	auto buffer = CreateEmptyBuffer(type);
 	if (buffer)
 		buffer->InitBuffer(ptr, size);
 
 	return buffer;
 }
 
+Buffer::IBufferPtr Buffer::CreateBuffer(const BufferType type, const size_t size, const char initData,
+                                        const BufferAllocation& allocation) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CreateBuffer", size);
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	RecordAllocationSite(VIS_CORE_RETURN_ADDRESS(), size);
+	#endif
+
+	auto buffer = CreateEmptyBuffer(type);
+	if (buffer)
+		buffer->InitBuffer(size, initData, allocation);
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Buffer::CreateBuffer(const BufferType type, const char* ptr, const size_t size,
+                                        const BufferAllocation& allocation) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CreateBuffer", size);
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	RecordAllocationSite(VIS_CORE_RETURN_ADDRESS(), size);
+	#endif
+
+	auto buffer = CreateEmptyBuffer(type);
+	if (buffer)
+		buffer->InitBuffer(ptr, size, allocation);
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Buffer::CreateConcatBuffer(const IBufferPtr& left, const IBufferPtr& right) {
+	auto buffer = std::make_shared<ConcatBuffer>();
+	buffer->AppendPart(left);
+	buffer->AppendPart(right);
+	return buffer;
+}
+
 Buffer::IBufferPtr Buffer::IBuffer::Create(const BufferType type, const size_t size, const char initData) {
-	return CreateBuffer(type, size, initData);
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CreateBuffer", size);
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	RecordAllocationSite(VIS_CORE_RETURN_ADDRESS(), size);
+	#endif
+
+	auto buffer = CreateEmptyBuffer(type);
+	if (buffer)
+		buffer->InitBuffer(size, initData);
+
+	return buffer;
 }
 
 Buffer::IBufferPtr Buffer::IBuffer::Create(const BufferType type, const char* ptr, const size_t size) {
-	return CreateBuffer(type, ptr, size);
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CreateBuffer", size);
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	RecordAllocationSite(VIS_CORE_RETURN_ADDRESS(), size);
+	#endif
+
+	auto buffer = CreateEmptyBuffer(type);
+	if (buffer)
+		buffer->InitBuffer(ptr, size);
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Buffer::CreateUninitializedBuffer(const BufferType type, const size_t size,
+                                                     const BufferAllocation& allocation) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CreateBuffer", size);
+
+	switch (type) {
+		case BufferType::Constraint: {
+			auto buffer = std::make_shared<ConstraintBuffer>();
+			buffer->Allocate(size, allocation);
+			return buffer;
+		}
+		case BufferType::Dynamic: {
+			auto buffer = std::make_shared<DynamicBuffer>();
+			buffer->Allocate(size, allocation);
+			return buffer;
+		}
+		case BufferType::Streaming: {
+			auto buffer = std::make_shared<StreamingBuffer>();
+			buffer->Allocate(size, allocation);
+			return buffer;
+		}
+		case BufferType::Concat: {
+			auto buffer = std::make_shared<ConcatBuffer>();
+			buffer->Allocate(size, allocation);
+			return buffer;
+		}
+		case BufferType::Managed: {
+			auto buffer = std::make_shared<ManagedBuffer>();
+			buffer->Allocate(size, allocation);
+			return buffer;
+		}
+		case BufferType::Spill: {
+			auto buffer = std::make_shared<SpillBuffer>();
+			buffer->Allocate(size, allocation);
+			return buffer;
+		}
+		case BufferType::Shared: {
+			auto buffer = std::make_shared<SharedBuffer>();
+			buffer->Allocate(size, allocation);
+			return buffer;
+		}
+		default:
+			return nullptr;
+	}
+}
+
+char* Buffer::GetDirectWriteData(IBuffer& buffer) {
+	switch (buffer.GetType()) {
+		case BufferType::Constraint:
+		case BufferType::Dynamic:
+		case BufferType::Streaming:
+			return *buffer;
+		default:
+			// managed needs pin, spill and concat merge on raw access, shared may be read only
+			return nullptr;
+	}
+}
+
+bool Buffer::IBuffer::UpdateMany(const UpdateRegion* regions, const size_t count, const size_t threads) {
+	VIS_CORE_TRACE_SCOPE("Buffer::UpdateMany");
+
+	if (count == 0)
+		return true;
+
+	if (!regions)
+		return false;
+
+	// validate whole batch before write anything
+	const auto length = GetLength();
+	std::vector<size_t> order;
+	order.reserve(count);
+	for (size_t index = 0; index < count; ++index) {
+		const auto& region = regions[index];
+		if (region.Size == 0)
+			continue;
+
+		if (!region.Ptr || region.Offset > length || region.Size > length - region.Offset)
+			return false;
+
+		order.push_back(index);
+	}
+
+	char* data = **this;
+	if (order.empty())
+		return true;
+	if (!data)
+		return false;
+
+	// sort by offset, equal offset keep array order
+	std::stable_sort(order.begin(), order.end(), [regions](const size_t lhs, const size_t rhs) {
+		return regions[lhs].Offset < regions[rhs].Offset;
+	});
+
+	// split into clusters of overlapped regions, overlapped regions are applied in array order
+	// so later region wins as sequential Update() does. Clusters never overlap each other
+	std::vector<UpdateRegion> runs;
+	std::vector<size_t>       clusterStarts;
+	runs.reserve(order.size());
+	size_t payload = 0;
+	for (size_t begin = 0; begin < order.size();) {
+		auto   clusterEnd = regions[order[begin]].Offset + regions[order[begin]].Size;
+		size_t end        = begin + 1;
+		while (end < order.size() && regions[order[end]].Offset < clusterEnd) {
+			clusterEnd = std::max(clusterEnd, regions[order[end]].Offset + regions[order[end]].Size);
+			++end;
+		}
+
+		if (end - begin > 1)
+			std::sort(order.begin() + static_cast<ptrdiff_t>(begin), order.begin() + static_cast<ptrdiff_t>(end));
+
+		clusterStarts.push_back(runs.size());
+		for (auto index = begin; index < end; ++index) {
+			const auto& region = regions[order[index]];
+			payload += region.Size;
+
+			// coalesce with previous run when both destination and source are contiguous
+			if (!runs.empty()) {
+				auto& last = runs.back();
+				if (last.Offset + last.Size == region.Offset && last.Ptr + last.Size == region.Ptr) {
+					last.Size += region.Size;
+					// merged into previous cluster, they must stay on same worker
+					if (index == begin)
+						clusterStarts.pop_back();
+					continue;
+				}
+			}
+
+			runs.push_back(region);
+		}
+
+		begin = end;
+	}
+
+	auto workers = threads == 0 ? Thread::GetDefaultThreadCount() : threads;
+	if (payload < ParallelUpdateThreshold)
+		workers = 1;
+	workers = std::min(workers, clusterStarts.size());
+
+	if (workers <= 1) {
+		ApplyRuns(data, runs.data(), runs.data() + runs.size());
+		return true;
+	}
+
+	// split at cluster boundaries with roughly equal payload each worker
+	std::vector<size_t> splits(workers + 1, runs.size());
+	splits[0] = 0;
+	size_t acc = 0, worker = 1, cluster = 1;
+	for (size_t index = 0; index < runs.size() && worker < workers; ++index) {
+		if (cluster < clusterStarts.size() && clusterStarts[cluster] == index) {
+			if (acc >= payload * worker / workers)
+				splits[worker++] = index;
+			++cluster;
+		}
+		acc += runs[index].Size;
+	}
+
+	Thread::ParallelInvoke(workers, [&](const size_t index) {
+		ApplyRuns(data, runs.data() + splits[index], runs.data() + splits[index + 1]);
+	});
+	return true;
 }
\ No newline at end of file
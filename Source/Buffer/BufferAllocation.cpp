@@ -0,0 +1,101 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/BufferAllocation.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+using namespace std;
+using namespace VisCore;
+
+namespace {
+	/**
+	 * \brief Get effective alignment and block size, huge page block is aligned and rounded to page size
+	 */
+	bool GetLayout(const size_t bytes, const Buffer::BufferAllocation& allocation, size_t& alignment, size_t& size) {
+		if (!allocation.IsValid())
+			return false;
+
+		alignment = allocation.Alignment > alignof(std::max_align_t) ? allocation.Alignment : alignof(std::max_align_t);
+
+		size = bytes;
+		if (allocation.HugePages && bytes >= Buffer::HugePageSize) {
+			if (alignment < Buffer::HugePageSize)
+				alignment = Buffer::HugePageSize;
+			size = (bytes + Buffer::HugePageSize - 1) & ~(Buffer::HugePageSize - 1);
+		}
+
+		// aligned_alloc style allocators want size multiple of alignment
+		size = (size + alignment - 1) & ~(alignment - 1);
+		return size >= bytes;
+	}
+}
+
+char* Buffer::AllocateMemory(const size_t bytes, const BufferAllocation& allocation) {
+	if (allocation.IsDefault()) {
+		auto* data = static_cast<char*>(std::malloc(bytes ? bytes : 1));
+		if (!data)
+			throw std::bad_alloc();
+		return data;
+	}
+
+	size_t alignment = 0;
+	size_t size      = 0;
+	if (!GetLayout(bytes ? bytes : 1, allocation, alignment, size))
+		throw std::bad_alloc();
+
+	#if defined(_WIN32)
+	// large pages need SeLockMemoryPrivilege on windows, only alignment is applied
+	auto* data = static_cast<char*>(_aligned_malloc(size, alignment));
+	if (!data)
+		throw std::bad_alloc();
+	#else
+	void* data = nullptr;
+	if (posix_memalign(&data, alignment, size) != 0)
+		throw std::bad_alloc();
+
+	#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	if (allocation.HugePages && size >= HugePageSize)
+		madvise(data, size, MADV_HUGEPAGE);
+	#endif
+	#endif
+
+	return static_cast<char*>(data);
+}
+
+char* Buffer::ReallocateMemory(char* data, const size_t oldBytes, const size_t bytes, const BufferAllocation& allocation) {
+	if (allocation.IsDefault()) {
+		auto* newData = static_cast<char*>(std::realloc(data, bytes ? bytes : 1));
+		if (!newData)
+			throw std::bad_alloc();
+		return newData;
+	}
+
+	// no aligned realloc, allocate new block and move content
+	auto* newData = AllocateMemory(bytes, allocation);
+	if (data) {
+		memcpy(newData, data, oldBytes < bytes ? oldBytes : bytes);
+		FreeMemory(data, allocation);
+	}
+	return newData;
+}
+
+void Buffer::FreeMemory(char* data, [[maybe_unused]] const BufferAllocation& allocation) noexcept {
+	#if defined(_WIN32)
+	if (!allocation.IsDefault()) {
+		_aligned_free(data);
+		return;
+	}
+	#endif
+
+	std::free(data);
+}
@@ -0,0 +1,239 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/BufferStats.h"
+#include "Buffer/BufferStatsTracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+#include <iomanip>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_MSC_VER)
+#include <dlfcn.h>
+#endif
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+
+namespace {
+	/**
+	 * \brief Counters of one buffer type, own cache line so types don't contend
+	 */
+	struct alignas(64) TypeCounters {
+		std::atomic<uint64_t> LiveBuffers{0};
+		std::atomic<uint64_t> LiveBytes{0};
+		std::atomic<uint64_t> PeakBytes{0};
+		std::atomic<uint64_t> Allocations{0};
+		std::atomic<uint64_t> Releases{0};
+		std::atomic<uint64_t> LifetimeNs{0};
+	};
+
+	/**
+	 * \brief Per type counters, last one is total of all types
+	 */
+	TypeCounters Counters[BufferTypeCount + 1];
+
+	std::atomic<int64_t> ResetTime{0};
+
+	int64_t Now() noexcept {
+		using namespace std::chrono;
+		return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	 * \brief Start time is lazy initialized so first reset happen at first use
+	 */
+	int64_t GetResetTime() noexcept {
+		auto time = ResetTime.load(std::memory_order_relaxed);
+		if (time == 0) {
+			int64_t expected = 0;
+			ResetTime.compare_exchange_strong(expected, Now(), std::memory_order_relaxed);
+			time = ResetTime.load(std::memory_order_relaxed);
+		}
+		return time;
+	}
+
+	void UpdatePeak(TypeCounters& counters, const uint64_t live) noexcept {
+		auto peak = counters.PeakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+		}
+	}
+
+	void Apply(TypeCounters& counters, const size_t oldBytes, const size_t newBytes, const int64_t lifetime) noexcept {
+		if (newBytes >= oldBytes) {
+			const auto live = counters.LiveBytes.fetch_add(newBytes - oldBytes, std::memory_order_relaxed) + newBytes - oldBytes;
+			UpdatePeak(counters, live);
+		} else {
+			counters.LiveBytes.fetch_sub(oldBytes - newBytes, std::memory_order_relaxed);
+		}
+
+		if (oldBytes == 0 && newBytes != 0) {
+			counters.LiveBuffers.fetch_add(1, std::memory_order_relaxed);
+			counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+		} else if (oldBytes != 0 && newBytes == 0) {
+			counters.LiveBuffers.fetch_sub(1, std::memory_order_relaxed);
+			counters.Releases.fetch_add(1, std::memory_order_relaxed);
+			counters.LifetimeNs.fetch_add(static_cast<uint64_t>(lifetime), std::memory_order_relaxed);
+		}
+	}
+
+	BufferTypeStats Snapshot(const TypeCounters& counters, const double elapsed) {
+		BufferTypeStats stats{};
+		stats.LiveBuffers          = counters.LiveBuffers.load(std::memory_order_relaxed);
+		stats.LiveBytes            = counters.LiveBytes.load(std::memory_order_relaxed);
+		stats.PeakBytes            = std::max(counters.PeakBytes.load(std::memory_order_relaxed), stats.LiveBytes);
+		stats.Allocations          = counters.Allocations.load(std::memory_order_relaxed);
+		stats.Releases             = counters.Releases.load(std::memory_order_relaxed);
+		stats.AllocationsPerSecond = elapsed > 0 ? static_cast<double>(stats.Allocations) / elapsed : 0;
+		stats.AverageLifetimeMs    = stats.Releases
+			                             ? static_cast<double>(counters.LifetimeNs.load(std::memory_order_relaxed)) / 1e6 /
+			                               static_cast<double>(stats.Releases)
+			                             : 0;
+		return stats;
+	}
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	struct SiteCounters {
+		uint64_t Count = 0;
+		uint64_t Bytes = 0;
+	};
+
+	std::mutex& GetSiteMutex() {
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	std::unordered_map<const void*, SiteCounters>& GetSites() {
+		static std::unordered_map<const void*, SiteCounters> sites;
+		return sites;
+	}
+	#endif
+}
+
+BufferStatsTracker::BufferStatsTracker(const BufferType type) noexcept : Type(type), Bytes(0), AllocTime(0) {
+}
+
+BufferStatsTracker::~BufferStatsTracker() {
+	Track(0);
+}
+
+BufferStatsTracker::BufferStatsTracker(BufferStatsTracker&& other) noexcept
+	: Type(other.Type), Bytes(other.Bytes), AllocTime(other.AllocTime) {
+	other.Bytes = 0;
+}
+
+BufferStatsTracker::BufferStatsTracker(const BufferStatsTracker& other) noexcept
+	: Type(other.Type), Bytes(0), AllocTime(0) {
+}
+
+BufferStatsTracker& BufferStatsTracker::operator=(BufferStatsTracker&& other) noexcept {
+	if (&other == this)
+		return *this;
+
+	Track(0);
+	Type        = other.Type;
+	Bytes       = other.Bytes;
+	AllocTime   = other.AllocTime;
+	other.Bytes = 0;
+	return *this;
+}
+
+BufferStatsTracker& BufferStatsTracker::operator=(const BufferStatsTracker&) noexcept {
+	// owner reports its new size after copy
+	return *this;
+}
+
+void BufferStatsTracker::Track(const size_t bytes) noexcept {
+	if (bytes == Bytes)
+		return;
+
+	int64_t lifetime = 0;
+	if (Bytes == 0) {
+		AllocTime = Now();
+		GetResetTime();
+	} else if (bytes == 0) {
+		lifetime = Now() - AllocTime;
+	}
+
+	const auto index = static_cast<size_t>(Type);
+	if (index < BufferTypeCount)
+		Apply(Counters[index], Bytes, bytes, lifetime);
+	Apply(Counters[BufferTypeCount], Bytes, bytes, lifetime);
+
+	Bytes = bytes;
+}
+
+BufferStats Buffer::GetBufferStats() {
+	const auto elapsed = static_cast<double>(Now() - GetResetTime()) / 1e9;
+
+	BufferStats stats{};
+	for (size_t index = 0; index < BufferTypeCount; ++index) {
+		stats.Types[index] = Snapshot(Counters[index], elapsed);
+	}
+	stats.Total          = Snapshot(Counters[BufferTypeCount], elapsed);
+	stats.ElapsedSeconds = elapsed;
+	return stats;
+}
+
+void Buffer::ResetBufferStats() {
+	for (auto& counters : Counters) {
+		counters.PeakBytes.store(counters.LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		counters.Allocations.store(0, std::memory_order_relaxed);
+		counters.Releases.store(0, std::memory_order_relaxed);
+		counters.LifetimeNs.store(0, std::memory_order_relaxed);
+	}
+	ResetTime.store(Now(), std::memory_order_relaxed);
+
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	std::lock_guard<std::mutex> lock(GetSiteMutex());
+	GetSites().clear();
+	#endif
+}
+
+#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+void Buffer::RecordAllocationSite(const void* site, const size_t bytes) {
+	std::lock_guard<std::mutex> lock(GetSiteMutex());
+	auto& counters = GetSites()[site];
+	counters.Count += 1;
+	counters.Bytes += bytes;
+}
+#endif
+
+void Buffer::DumpBufferAllocationSites(std::ostream& stream, [[maybe_unused]] const size_t top) {
+	#if defined(VIS_CORE_TRACK_ALLOCATION_SITES)
+	std::vector<std::pair<const void*, SiteCounters>> sites;
+	{
+		std::lock_guard<std::mutex> lock(GetSiteMutex());
+		sites.assign(GetSites().begin(), GetSites().end());
+	}
+
+	std::sort(sites.begin(), sites.end(), [](const auto& lhs, const auto& rhs) {
+		return lhs.second.Bytes > rhs.second.Bytes;
+	});
+	if (sites.size() > top)
+		sites.resize(top);
+
+	stream << "Top buffer allocation sites:" << std::endl;
+	for (const auto& [site, counters] : sites) {
+		stream << "  " << site << "  count=" << counters.Count << "  bytes=" << counters.Bytes;
+		#if !defined(_MSC_VER)
+		Dl_info info;
+		if (dladdr(site, &info) && info.dli_sname)
+			stream << "  " << info.dli_sname << "+0x" << std::hex
+				<< (static_cast<const char*>(site) - static_cast<const char*>(info.dli_saddr)) << std::dec;
+		#endif
+		stream << std::endl;
+	}
+	#else
+	stream << "Allocation site tracking is disabled, build with VIS_CORE_TRACK_ALLOCATION_SITES" << std::endl;
+	#endif
+}
@@ -0,0 +1,184 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/BulkMemory.h"
+
+#include "Thread/Parallel.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIS_CORE_HAS_STREAM_STORE 1
+#endif
+
+using namespace std;
+using namespace VisCore;
+
+namespace {
+	constexpr size_t PageSize      = 4096;
+	constexpr size_t CacheLineSize = 64;
+
+	std::atomic<size_t> ParallelThreshold{Buffer::BulkMemoryConfig().ParallelThreshold};
+	std::atomic<size_t> NonTemporalThreshold{Buffer::BulkMemoryConfig().NonTemporalThreshold};
+	std::atomic<size_t> MaxThreads{Buffer::BulkMemoryConfig().MaxThreads};
+	std::atomic<size_t> MinChunkSize{Buffer::BulkMemoryConfig().MinChunkSize};
+
+	/**
+	 * \brief Bytes until ptr reach alignment, clamped to size
+	 */
+	size_t HeadSize(const char* ptr, const size_t alignment, const size_t size) {
+		const auto head = (alignment - reinterpret_cast<uintptr_t>(ptr) % alignment) % alignment;
+		return head < size ? head : size;
+	}
+
+	/**
+	 * \brief Fill with stores that bypass cache
+	 */
+	void StreamFill(char* data, const char value, size_t size) {
+		#if defined(VIS_CORE_HAS_STREAM_STORE)
+		const auto head = HeadSize(data, CacheLineSize, size);
+		memset(data, value, head);
+		data += head;
+		size -= head;
+
+		const auto fill = _mm_set1_epi8(value);
+		for (; size >= CacheLineSize; data += CacheLineSize, size -= CacheLineSize) {
+			auto* line = reinterpret_cast<__m128i*>(data);
+			_mm_stream_si128(line, fill);
+			_mm_stream_si128(line + 1, fill);
+			_mm_stream_si128(line + 2, fill);
+			_mm_stream_si128(line + 3, fill);
+		}
+
+		// non-temporal stores are weakly ordered, publish before worker returns
+		_mm_sfence();
+		#endif
+
+		memset(data, value, size);
+	}
+
+	/**
+	 * \brief Copy with stores that bypass cache
+	 */
+	void StreamCopy(char* destination, const char* source, size_t size) {
+		#if defined(VIS_CORE_HAS_STREAM_STORE)
+		const auto head = HeadSize(destination, CacheLineSize, size);
+		memcpy(destination, source, head);
+		destination += head;
+		source += head;
+		size -= head;
+
+		for (; size >= CacheLineSize; destination += CacheLineSize, source += CacheLineSize, size -= CacheLineSize) {
+			const auto* from = reinterpret_cast<const __m128i*>(source);
+			auto*       line = reinterpret_cast<__m128i*>(destination);
+
+			const auto first  = _mm_loadu_si128(from);
+			const auto second = _mm_loadu_si128(from + 1);
+			const auto third  = _mm_loadu_si128(from + 2);
+			const auto fourth = _mm_loadu_si128(from + 3);
+			_mm_stream_si128(line, first);
+			_mm_stream_si128(line + 1, second);
+			_mm_stream_si128(line + 2, third);
+			_mm_stream_si128(line + 3, fourth);
+		}
+
+		_mm_sfence();
+		#endif
+
+		memcpy(destination, source, size);
+	}
+
+	/**
+	 * \brief Split [data, data + size) on page boundaries and run task(offset, length) for each part
+	 */
+	template<typename Task>
+	void RunSplit(char* data, const size_t size, const Task& task) {
+		const auto threads = MaxThreads.load(std::memory_order_relaxed);
+		const auto minimum = std::max<size_t>(MinChunkSize.load(std::memory_order_relaxed), PageSize);
+
+		auto count = threads == 0 ? Thread::GetDefaultThreadCount() : threads;
+		count      = std::max<size_t>(1, std::min(count, size / minimum));
+		if (count == 1) {
+			task(0, size);
+			return;
+		}
+
+		// boundaries are page aligned in address space, each page has one writer
+		const auto head = HeadSize(data, PageSize, size);
+		const auto body = size - head;
+		const auto step = (body / count + PageSize - 1) & ~(PageSize - 1);
+
+		Thread::ParallelInvoke(count, [&](const size_t index) {
+			const auto begin = index == 0 ? 0 : std::min(size, head + index * step);
+			const auto end   = index + 1 == count ? size : std::min(size, head + (index + 1) * step);
+			if (begin < end)
+				task(begin, end - begin);
+		});
+	}
+}
+
+Buffer::BulkMemoryConfig Buffer::GetBulkMemoryConfig() {
+	BulkMemoryConfig config;
+	config.ParallelThreshold    = ParallelThreshold.load(std::memory_order_relaxed);
+	config.NonTemporalThreshold = NonTemporalThreshold.load(std::memory_order_relaxed);
+	config.MaxThreads           = MaxThreads.load(std::memory_order_relaxed);
+	config.MinChunkSize         = MinChunkSize.load(std::memory_order_relaxed);
+	return config;
+}
+
+void Buffer::SetBulkMemoryConfig(const BulkMemoryConfig& config) {
+	ParallelThreshold.store(config.ParallelThreshold, std::memory_order_relaxed);
+	NonTemporalThreshold.store(config.NonTemporalThreshold, std::memory_order_relaxed);
+	MaxThreads.store(config.MaxThreads, std::memory_order_relaxed);
+	MinChunkSize.store(config.MinChunkSize, std::memory_order_relaxed);
+}
+
+void Buffer::BulkFill(char* data, const char value, const size_t size) {
+	const auto parallel    = size >= ParallelThreshold.load(std::memory_order_relaxed);
+	const auto nonTemporal = size >= NonTemporalThreshold.load(std::memory_order_relaxed);
+	if (!parallel && !nonTemporal) {
+		memset(data, value, size);
+		return;
+	}
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::BulkFill", size);
+	const auto fill = [&](const size_t offset, const size_t length) {
+		if (nonTemporal)
+			StreamFill(data + offset, value, length);
+		else
+			memset(data + offset, value, length);
+	};
+
+	if (parallel)
+		RunSplit(data, size, fill);
+	else
+		fill(0, size);
+}
+
+void Buffer::BulkCopy(char* destination, const char* source, const size_t size) {
+	const auto parallel    = size >= ParallelThreshold.load(std::memory_order_relaxed);
+	const auto nonTemporal = size >= NonTemporalThreshold.load(std::memory_order_relaxed);
+	if (!parallel && !nonTemporal) {
+		memcpy(destination, source, size);
+		return;
+	}
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::BulkCopy", size);
+	const auto copy = [&](const size_t offset, const size_t length) {
+		if (nonTemporal)
+			StreamCopy(destination + offset, source + offset, length);
+		else
+			memcpy(destination + offset, source + offset, length);
+	};
+
+	if (parallel)
+		RunSplit(destination, size, copy);
+	else
+		copy(0, size);
+}
@@ -0,0 +1,164 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/ByteSwap.h"
+#include "Streaming/ByteOrder.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VIS_CORE_BYTE_SWAP_SIMD 1
+#define VIS_CORE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define VIS_CORE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+
+namespace {
+	template<typename T>
+	void SwapScalar(char* destination, const char* source, const size_t count) {
+		for (size_t index = 0; index < count; ++index) {
+			T value;
+			memcpy(&value, source + index * sizeof(T), sizeof(T));
+			value = Streaming::ByteSwap(value);
+			memcpy(destination + index * sizeof(T), &value, sizeof(T));
+		}
+	}
+
+	void SwapScalar(char* destination, const char* source, const size_t count, const size_t elementSize) {
+		switch (elementSize) {
+			case 2:
+				SwapScalar<uint16_t>(destination, source, count);
+				return;
+			case 4:
+				SwapScalar<uint32_t>(destination, source, count);
+				return;
+			case 8:
+				SwapScalar<uint64_t>(destination, source, count);
+				return;
+			default:
+				for (size_t index = 0; index < count; ++index) {
+					const auto* from = source + index * elementSize;
+					auto*       to   = destination + index * elementSize;
+					if (from == to)
+						std::reverse(to, to + elementSize);
+					else
+						std::reverse_copy(from, from + elementSize, to);
+				}
+		}
+	}
+
+	#if defined(VIS_CORE_BYTE_SWAP_SIMD)
+	bool HasSsse3() {
+		static const bool supported = __builtin_cpu_supports("ssse3");
+		return supported;
+	}
+
+	bool HasAvx2() {
+		static const bool supported = __builtin_cpu_supports("avx2");
+		return supported;
+	}
+
+	/**
+	 * \brief Byte index pattern reversing each element of a 16 byte lane
+	 */
+	void MakeSwapPattern(const size_t elementSize, char* pattern) {
+		for (size_t index = 0; index < 16; ++index) {
+			pattern[index] = static_cast<char>(index / elementSize * elementSize + elementSize - 1 - index % elementSize);
+		}
+	}
+
+	/**
+	 * \return swapped bytes
+	 */
+	VIS_CORE_TARGET_SSSE3 size_t SwapSsse3(char* destination, const char* source, const size_t size, const size_t elementSize) {
+		char pattern[16];
+		MakeSwapPattern(elementSize, pattern);
+		const auto shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+
+		size_t offset = 0;
+		for (; offset + 16 <= size; offset += 16) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + offset));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset), _mm_shuffle_epi8(input, shuffle));
+		}
+		return offset;
+	}
+
+	/**
+	 * \return swapped bytes
+	 */
+	VIS_CORE_TARGET_AVX2 size_t SwapAvx2(char* destination, const char* source, const size_t size, const size_t elementSize) {
+		char pattern[16];
+		MakeSwapPattern(elementSize, pattern);
+		// vpshufb works per 128 bit lane, same pattern for both lanes
+		const auto shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern)));
+
+		size_t offset = 0;
+		for (; offset + 64 <= size; offset += 64) {
+			const auto first  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + offset));
+			const auto second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + offset + 32));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + offset), _mm256_shuffle_epi8(first, shuffle));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + offset + 32), _mm256_shuffle_epi8(second, shuffle));
+		}
+		for (; offset + 32 <= size; offset += 32) {
+			const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + offset));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + offset), _mm256_shuffle_epi8(input, shuffle));
+		}
+		return offset;
+	}
+	#endif
+}
+
+void Buffer::ByteSwapArray(char* data, const size_t count, const size_t elementSize) {
+	ByteSwapArray(data, data, count, elementSize);
+}
+
+void Buffer::ByteSwapArray(char* destination, const char* source, const size_t count, const size_t elementSize) {
+	if (count == 0 || elementSize < 2)
+		return;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::ByteSwap", count * elementSize);
+
+	size_t done = 0;
+	#if defined(VIS_CORE_BYTE_SWAP_SIMD)
+	// elements never straddle 16 byte lanes for 2/4/8 byte sizes
+	if (elementSize == 2 || elementSize == 4 || elementSize == 8) {
+		const auto size = count * elementSize;
+		if (HasAvx2())
+			done = SwapAvx2(destination, source, size, elementSize);
+		if (HasSsse3())
+			done += SwapSsse3(destination + done, source + done, size - done, elementSize);
+	}
+	#endif
+
+	const auto swapped = done / elementSize;
+	SwapScalar(destination + done, source + done, count - swapped, elementSize);
+}
+
+bool Buffer::ByteSwapRegion(IBuffer& buffer, const size_t offset, const size_t count, const size_t elementSize) {
+	const auto length = buffer.GetLength();
+	if (elementSize && count > (static_cast<size_t>(-1) - offset) / elementSize)
+		return false;
+
+	const auto size = count * elementSize;
+	if (offset > length || size > length - offset)
+		return false;
+
+	if (size == 0)
+		return true;
+
+	// read only buffer has no writable memory
+	auto* data = *buffer;
+	if (!data)
+		return false;
+
+	ByteSwapArray(data + offset, count, elementSize);
+	return true;
+}
@@ -0,0 +1,276 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/Compression.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+
+namespace {
+	/**
+	 * \brief Shortest encoded match
+	 */
+	constexpr size_t MinMatch = 4;
+
+	/**
+	 * \brief Block always ends with this many literals
+	 */
+	constexpr size_t LastLiterals = 5;
+
+	/**
+	 * \brief Last match must start this many bytes before block end
+	 */
+	constexpr size_t MatchFindLimit = 12;
+
+	/**
+	 * \brief Max match distance, offset is stored in 2 bytes
+	 */
+	constexpr size_t MaxDistance = 65535;
+
+	constexpr unsigned HashLog = 12;
+
+	/**
+	 * \brief Fixed copy size of decoder fast path
+	 */
+	constexpr ptrdiff_t CopyChunk = 16;
+
+	/**
+	 * \brief Failed lookups before search step grows by one byte, skips incompressible data fast
+	 */
+	constexpr unsigned SkipTrigger = 6;
+
+	uint32_t Load32(const uint8_t* ptr) {
+		uint32_t value;
+		memcpy(&value, ptr, sizeof(value));
+		return value;
+	}
+
+	uint64_t Load64(const uint8_t* ptr) {
+		uint64_t value;
+		memcpy(&value, ptr, sizeof(value));
+		return value;
+	}
+
+	uint32_t Hash(const uint32_t value) {
+		return value * 2654435761u >> (32 - HashLog);
+	}
+
+	/**
+	 * \brief Bytes needed to extend a 4 bit length field
+	 */
+	size_t GetLengthBytes(const size_t length) {
+		return length < 15 ? 0 : (length - 15) / 255 + 1;
+	}
+
+	uint8_t* WriteLength(uint8_t* output, size_t length) {
+		for (length -= 15; length >= 255; length -= 255) {
+			*output++ = 255;
+		}
+		*output++ = static_cast<uint8_t>(length);
+		return output;
+	}
+
+	/**
+	 * \brief Count equal bytes of match and current position, stop at limit
+	 */
+	size_t CountMatch(const uint8_t* current, const uint8_t* match, const uint8_t* limit) {
+		const auto* start = current;
+		while (current + 8 <= limit) {
+			if (Load64(current) != Load64(match))
+				break;
+			current += 8;
+			match += 8;
+		}
+		while (current < limit && *current == *match) {
+			++current;
+			++match;
+		}
+		return current - start;
+	}
+
+	/**
+	 * \brief Write one sequence, literals followed by match, match length 0 writes last literals
+	 * \return nullptr if output does not fit
+	 */
+	uint8_t* WriteSequence(uint8_t* output, const uint8_t* outputEnd, const uint8_t* literals, const size_t literalLength,
+	                       const size_t offset, const size_t matchLength) {
+		const auto matchCode = matchLength ? matchLength - MinMatch : 0;
+		const auto required = 1 + GetLengthBytes(literalLength) + literalLength +
+		                      (matchLength ? 2 + GetLengthBytes(matchCode) : 0);
+		if (required > static_cast<size_t>(outputEnd - output))
+			return nullptr;
+
+		auto* token = output++;
+		*token = static_cast<uint8_t>((literalLength < 15 ? literalLength : 15) << 4);
+		if (literalLength >= 15)
+			output = WriteLength(output, literalLength);
+		if (literalLength)
+			memcpy(output, literals, literalLength);
+		output += literalLength;
+
+		if (matchLength) {
+			*output++ = static_cast<uint8_t>(offset);
+			*output++ = static_cast<uint8_t>(offset >> 8);
+			*token |= static_cast<uint8_t>(matchCode < 15 ? matchCode : 15);
+			if (matchCode >= 15)
+				output = WriteLength(output, matchCode);
+		}
+		return output;
+	}
+
+	/**
+	 * \brief Read extended length, add to length
+	 * \return false if input ends inside length
+	 */
+	bool ReadLength(const uint8_t*& input, const uint8_t* inputEnd, size_t& length) {
+		uint8_t value;
+		do {
+			if (input == inputEnd)
+				return false;
+			value = *input++;
+			length += value;
+		} while (value == 255);
+		return true;
+	}
+}
+
+size_t Buffer::Compress(const char* source, const size_t size, char* destination, const size_t capacity) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Compress", size);
+
+	const auto* begin     = reinterpret_cast<const uint8_t*>(source);
+	const auto* end       = begin + size;
+	const auto* anchor    = begin;
+	auto*       output    = reinterpret_cast<uint8_t*>(destination);
+	const auto* outputEnd = output + capacity;
+
+	if (size > MatchFindLimit) {
+		const auto* matchLimit = end - LastLiterals;
+		const auto* findLimit  = end - MatchFindLimit;
+
+		size_t table[1 << HashLog] = {};
+		const auto* current = begin + 1;
+
+		while (current <= findLimit) {
+			// search next match, step grows while nothing matches
+			const uint8_t* match = nullptr;
+			unsigned       attempt = 1 << SkipTrigger;
+			while (current <= findLimit) {
+				const auto hash      = Hash(Load32(current));
+				const auto* candidate = begin + table[hash];
+				table[hash]          = current - begin;
+
+				if (static_cast<size_t>(current - candidate) <= MaxDistance && Load32(candidate) == Load32(current)) {
+					match = candidate;
+					break;
+				}
+				current += attempt++ >> SkipTrigger;
+			}
+			if (!match)
+				break;
+
+			// extend backwards into pending literals
+			while (current > anchor && match > begin && current[-1] == match[-1]) {
+				--current;
+				--match;
+			}
+
+			const auto matchLength = MinMatch + CountMatch(current + MinMatch, match + MinMatch, matchLimit);
+			output = WriteSequence(output, outputEnd, anchor, current - anchor, current - match, matchLength);
+			if (!output)
+				return -1;
+
+			current += matchLength;
+			anchor = current;
+			if (current <= findLimit)
+				table[Hash(Load32(current - 2))] = current - 2 - begin;
+		}
+	}
+
+	output = WriteSequence(output, outputEnd, anchor, end - anchor, 0, 0);
+	if (!output)
+		return -1;
+
+	return output - reinterpret_cast<uint8_t*>(destination);
+}
+
+size_t Buffer::Decompress(const char* source, const size_t size, char* destination, const size_t capacity) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Decompress", size);
+
+	const auto* input     = reinterpret_cast<const uint8_t*>(source);
+	const auto* inputEnd  = input + size;
+	auto*       begin     = reinterpret_cast<uint8_t*>(destination);
+	auto*       output    = begin;
+	const auto* outputEnd = begin + capacity;
+
+	while (true) {
+		if (input == inputEnd)
+			return -1;
+
+		const auto token = *input++;
+
+		size_t literalLength = token >> 4;
+		if (literalLength == 15 && !ReadLength(input, inputEnd, literalLength))
+			return -1;
+		if (literalLength > static_cast<size_t>(inputEnd - input) ||
+		    literalLength > static_cast<size_t>(outputEnd - output))
+			return -1;
+
+		// short literals move as one fixed copy while both sides have slack
+		if (literalLength <= CopyChunk && inputEnd - input >= CopyChunk && outputEnd - output >= CopyChunk)
+			memcpy(output, input, CopyChunk);
+		else if (literalLength)
+			memcpy(output, input, literalLength);
+		input += literalLength;
+		output += literalLength;
+
+		// last sequence has literals only
+		if (input == inputEnd)
+			break;
+
+		if (inputEnd - input < 2)
+			return -1;
+		const size_t offset = input[0] | static_cast<size_t>(input[1]) << 8;
+		input += 2;
+		if (offset == 0 || offset > static_cast<size_t>(output - begin))
+			return -1;
+
+		size_t matchLength = token & 15;
+		if (matchLength == 15 && !ReadLength(input, inputEnd, matchLength))
+			return -1;
+		matchLength += MinMatch;
+		if (matchLength > static_cast<size_t>(outputEnd - output))
+			return -1;
+
+		// distant match copies fixed chunks, may write up to CopyChunk - 1 bytes past its end
+		const auto* match = output - offset;
+		if (offset >= CopyChunk && static_cast<size_t>(outputEnd - output) >= matchLength + CopyChunk) {
+			for (size_t copied = 0; copied < matchLength; copied += CopyChunk) {
+				memcpy(output + copied, match + copied, CopyChunk);
+			}
+			output += matchLength;
+			continue;
+		}
+
+		// overlapping match repeats last offset bytes, copy in chunks that double each step
+		if (offset == 1) {
+			memset(output, *match, matchLength);
+			output += matchLength;
+			continue;
+		}
+		while (matchLength) {
+			const auto chunk = std::min<size_t>(output - match, matchLength);
+			memcpy(output, match, chunk);
+			output += chunk;
+			matchLength -= chunk;
+		}
+	}
+
+	return output - begin;
+}
@@ -0,0 +1,419 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/ConcatBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BulkMemory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+using namespace VisCore::Buffer;
+using namespace VisCore::Streaming;
+
+ConcatBuffer::ConcatBuffer() : Owned(false), Length(0), Stats(BufferType::Concat), Position(0) {
+}
+
+ConcatBuffer::~ConcatBuffer() {
+	ConcatBuffer::Release();
+}
+
+ConcatBuffer::ConcatBuffer(ConcatBuffer&& other) noexcept
+	: Parts(std::move(other.Parts)), Ends(std::move(other.Ends)), Owned(other.Owned), Length(other.Length),
+	  Stats(std::move(other.Stats)), Position(other.Position) {
+	// take parts from other
+	other.Parts.clear();
+	other.Ends.clear();
+	other.Owned    = false;
+	other.Length   = 0;
+	other.Position = 0;
+}
+
+ConcatBuffer::ConcatBuffer(const ConcatBuffer& other) noexcept
+	: Parts(other.Parts), Ends(other.Ends), Owned(false), Length(other.Length), Stats(other.Stats),
+	  Position(other.Position) {
+	// share parts, private block of other is not private any more
+	other.Owned = false;
+	TrackParts();
+}
+
+const ConcatBuffer& ConcatBuffer::operator=(ConcatBuffer&& other) noexcept {
+	// Self-assignment detection
+	if (&other == this)
+		return *this;
+
+	// take parts from other
+	Parts    = std::move(other.Parts);
+	Ends     = std::move(other.Ends);
+	Owned    = other.Owned;
+	Length   = other.Length;
+	Stats    = std::move(other.Stats);
+	Position = other.Position;
+
+	other.Parts.clear();
+	other.Ends.clear();
+	other.Owned    = false;
+	other.Length   = 0;
+	other.Position = 0;
+
+	return *this;
+}
+
+const ConcatBuffer& ConcatBuffer::operator=(const ConcatBuffer& other) noexcept {
+	// Self-assignment detection
+	if (&other == this)
+		return *this;
+
+	// Share the parts
+	Parts       = other.Parts;
+	Ends        = other.Ends;
+	Owned       = false;
+	other.Owned = false;
+	Length      = other.Length;
+	Position    = other.Position;
+	TrackParts();
+
+	return *this;
+}
+
+char* ConcatBuffer::operator*() {
+	return Flatten(true);
+}
+
+const char* ConcatBuffer::operator*() const {
+	return Flatten(false);
+}
+
+char& ConcatBuffer::operator[](const size_t position) {
+	if (position >= Length)
+		throw std::out_of_range("Access buffer out of range!!!");
+
+	return Flatten(true)[position];
+}
+
+IBuffer* ConcatBuffer::operator+(char& value) {
+	const auto buffer = new ConcatBuffer(*this);
+	buffer->AppendPart(CreateBuffer(BufferType::Constraint, &value, 1));
+	return buffer;
+}
+
+IBuffer* ConcatBuffer::operator+(IBuffer& buffer) {
+	const auto newBuffer = new ConcatBuffer(*this);
+	newBuffer->AppendPart(buffer);
+	return newBuffer;
+}
+
+IBufferPtr ConcatBuffer::operator+(IBufferPtr& buffer) {
+	auto newBuffer = std::make_shared<ConcatBuffer>(*this);
+	newBuffer->AppendPart(buffer);
+	return newBuffer;
+}
+
+IBuffer* ConcatBuffer::operator+=(char& value) {
+	AppendPart(CreateBuffer(BufferType::Constraint, &value, 1));
+	return this;
+}
+
+IBuffer* ConcatBuffer::operator+=(IBuffer& buffer) {
+	AppendPart(buffer);
+	return this;
+}
+
+IBufferPtr ConcatBuffer::operator+=(IBufferPtr& buffer) {
+	AppendPart(buffer);
+	if (auto self = weak_from_this().lock())
+		return self;
+
+	// not owned by shared_ptr, hand out a node sharing same parts
+	return std::make_shared<ConcatBuffer>(*this);
+}
+
+BufferType ConcatBuffer::GetType() {
+	return BufferType::Concat;
+}
+
+void ConcatBuffer::InitBuffer(const size_t size, const char initData) {
+	InitBuffer(size, initData, BufferAllocation());
+}
+
+void ConcatBuffer::InitBuffer(const char* ptr, const size_t size) {
+	InitBuffer(ptr, size, BufferAllocation());
+}
+
+void ConcatBuffer::InitBuffer(const size_t size, const char initData, const BufferAllocation& allocation) {
+	Release();
+	AppendPart(CreateBuffer(BufferType::Constraint, size, initData, allocation));
+	Owned = !Parts.empty();
+}
+
+void ConcatBuffer::InitBuffer(const char* ptr, const size_t size, const BufferAllocation& allocation) {
+	Release();
+	AppendPart(CreateBuffer(BufferType::Constraint, ptr, size, allocation));
+	Owned = !Parts.empty();
+}
+
+void ConcatBuffer::Allocate(const size_t size, const BufferAllocation& allocation) {
+	Release();
+	AppendPart(CreateUninitializedBuffer(BufferType::Constraint, size, allocation));
+	Owned = !Parts.empty();
+}
+
+void ConcatBuffer::Release() {
+	Parts.clear();
+	Parts.shrink_to_fit();
+	Ends.clear();
+	Ends.shrink_to_fit();
+	Owned    = false;
+	Length   = 0;
+	Position = 0;
+	Stats.Track(0);
+}
+
+bool ConcatBuffer::Update(const size_t offset, const size_t size, const char* ptr) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Update", size);
+
+	if (offset > Length || size > Length - offset)
+		return false;
+
+	if (size == 0)
+		return true;
+
+	memcpy(Flatten(true) + offset, ptr, size);
+	return true;
+}
+
+void ConcatBuffer::CopyTo(IBufferPtr buffer, const int length) const {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CopyTo", Length);
+
+	if (Length == 0 || buffer.get() == this)
+		return;
+
+	const auto size     = length == -1 || length > Length ? Length : length;
+	const auto copySize = size < buffer->GetLength() ? size : buffer->GetLength();
+	if (!copySize)
+		return;
+
+	if (auto* target = GetDirectWriteData(*buffer))
+		CopyRange(0, copySize, target);
+	else
+		UpdateRange(0, copySize, *buffer);
+}
+
+bool ConcatBuffer::Append(const char& data) {
+	// Do nothing
+	return false;
+}
+
+bool ConcatBuffer::Append(const char* data, const int length) {
+	// Do nothing
+	return false;
+}
+
+bool ConcatBuffer::Insert(const int index, const char* data, const int length) {
+	// Do nothing
+	return false;
+}
+
+void ConcatBuffer::Clear(const int length) {
+	if (Length)
+		BulkFill(Flatten(true), 0, std::min<size_t>(length == -1 ? Length : length, Length));
+}
+
+size_t ConcatBuffer::GetLength() const {
+	return Length;
+}
+
+size_t ConcatBuffer::GetMemSize() const {
+	return sizeof(ConcatBuffer) + Parts.capacity() * sizeof(IBufferPtr) + Ends.capacity() * sizeof(size_t);
+}
+
+const char* ConcatBuffer::GetData() const {
+	return Flatten(false);
+}
+
+BufferAllocation ConcatBuffer::GetAllocation() const {
+	if (Parts.size() == 1)
+		return Parts.front()->GetAllocation();
+
+	return {};
+}
+
+IBufferPtr ConcatBuffer::CreateBufferCopy(const BufferType type, const int length) const {
+	if (Length == 0)
+		return CreateBuffer(type, static_cast<size_t>(0), 0);
+
+	const auto size   = length == -1 || length > Length ? Length : length;
+	auto       buffer = CreateUninitializedBuffer(type, size, GetAllocation());
+	if (buffer && size)
+		CopyRange(0, size, **buffer);
+
+	return buffer;
+}
+
+IStreaming* ConcatBuffer::GetStreaming() {
+	return this;
+}
+
+size_t ConcatBuffer::Tell() const {
+	return Position;
+}
+
+size_t ConcatBuffer::Read(IBuffer* buffer, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::Read", length);
+
+	if (IsEof()) {
+		return 0;
+	}
+
+	const auto delta    = Length - Position;
+	auto       copySize = length < delta ? length : delta;
+	copySize            = buffer->GetLength() < copySize ? buffer->GetLength() : copySize;
+
+	// walk parts in place, destination is written through Update() as other streams do
+	UpdateRange(Position, copySize, *buffer);
+
+	Position += copySize;
+	return copySize;
+}
+
+size_t ConcatBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
+	VIS_CORE_TRACE_SCOPE("Streaming::Seek");
+
+	switch (seekMode) {
+		case SeekMode::SeekSet: {
+			if (offset <= Length && offset >= 0) {
+				Position = offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		case SeekMode::SeekCurrent: {
+			if (offset >= 0) {
+				const size_t delta = Position + offset;
+				if (delta > Length) {
+					return -1;
+				}
+
+				Position = delta;
+				return Position;
+			}
+
+			if (-offset > Position) {
+				return -1;
+			}
+
+			Position -= -offset;
+			return Position;
+		}
+		case SeekMode::SeekEnd: {
+			if (offset <= 0 && -offset <= Length) {
+				Position = Length - -offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		default:
+			return -1;
+	}
+}
+
+bool ConcatBuffer::IsEof() const {
+	return Position == Length;
+}
+
+void ConcatBuffer::Close() {
+	Release();
+}
+
+void ConcatBuffer::AppendPart(IBuffer& buffer) {
+	if (buffer.GetLength() == 0)
+		return;
+
+	if (auto* concat = dynamic_cast<ConcatBuffer*>(&buffer)) {
+		// take operand parts so chains stay flat, copy first since operand may be this
+		const auto parts = concat->Parts;
+		concat->Owned    = false;
+		for (const auto& part : parts) {
+			AppendPart(part);
+		}
+		return;
+	}
+
+	if (auto shared = buffer.weak_from_this().lock()) {
+		AppendPart(shared);
+		return;
+	}
+
+	// operand lifetime is unknown, keep a copy
+	AppendPart(buffer.CreateBufferCopy(BufferType::Constraint));
+}
+
+void ConcatBuffer::AppendPart(const IBufferPtr& buffer) {
+	if (!buffer || buffer->GetLength() == 0)
+		return;
+
+	if (buffer->GetType() == BufferType::Concat) {
+		AppendPart(*buffer);
+		return;
+	}
+
+	Parts.push_back(buffer);
+	Length += buffer->GetLength();
+	Ends.push_back(Length);
+	Owned = false;
+	TrackParts();
+}
+
+void ConcatBuffer::CopyRange(const size_t offset, const size_t size, char* destination) const {
+	size_t done  = 0;
+	auto   index = static_cast<size_t>(std::upper_bound(Ends.begin(), Ends.end(), offset) - Ends.begin());
+	while (done < size) {
+		const auto begin = index == 0 ? 0 : Ends[index - 1];
+		const auto start = offset + done - begin;
+		const auto bytes = std::min(Ends[index] - begin - start, size - done);
+		BulkCopy(destination + done, Parts[index]->GetData() + start, bytes);
+		done += bytes;
+		++index;
+	}
+}
+
+void ConcatBuffer::UpdateRange(const size_t offset, const size_t size, IBuffer& destination) const {
+	size_t done  = 0;
+	auto   index = static_cast<size_t>(std::upper_bound(Ends.begin(), Ends.end(), offset) - Ends.begin());
+	while (done < size) {
+		const auto begin = index == 0 ? 0 : Ends[index - 1];
+		const auto start = offset + done - begin;
+		const auto bytes = std::min(Ends[index] - begin - start, size - done);
+		destination.Update(done, bytes, Parts[index]->GetData() + start);
+		done += bytes;
+		++index;
+	}
+}
+
+char* ConcatBuffer::Flatten(const bool writable) const {
+	if (Parts.empty())
+		return nullptr;
+
+	if (Owned || (Parts.size() == 1 && !writable))
+		return const_cast<char*>(Parts.front()->GetData());
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Flatten", Length);
+
+	auto flat = CreateUninitializedBuffer(BufferType::Constraint, Length, BufferAllocation());
+	CopyRange(0, Length, **flat);
+
+	Parts.assign(1, std::move(flat));
+	Ends.assign(1, Length);
+	Owned = true;
+	return **Parts.front();
+}
+
+void ConcatBuffer::TrackParts() {
+	Stats.Track(Parts.capacity() * sizeof(IBufferPtr) + Ends.capacity() * sizeof(size_t));
+}
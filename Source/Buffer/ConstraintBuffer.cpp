@@ -3,7 +3,12 @@
  * */
 
 #include "Buffer/ConstraintBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BulkMemory.h"
+#include "Trace/Trace.h"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 using namespace std;
@@ -11,28 +16,18 @@ using namespace VisCore::Buffer;
 using namespace VisCore::Streaming;
 
 
-ConstraintBuffer::ConstraintBuffer() : Data(nullptr), Size(0) {
+ConstraintBuffer::ConstraintBuffer() : Stats(BufferType::Constraint) {
 }
 
 ConstraintBuffer::~ConstraintBuffer() {
 	ConstraintBuffer::Release();
 }
 
-ConstraintBuffer::ConstraintBuffer(ConstraintBuffer&& other) noexcept {
-	// take buffer from other
-	Size = other.Size;
-	Data = other.Data;
-
-	other.Size = 0;
-	other.Data = nullptr;
-}
+ConstraintBuffer::ConstraintBuffer(ConstraintBuffer&& other) noexcept = default;
 
-ConstraintBuffer::ConstraintBuffer(const ConstraintBuffer& other) noexcept {
+ConstraintBuffer::ConstraintBuffer(const ConstraintBuffer& other) noexcept : Core(other.Core), Stats(other.Stats) {
 	// copy buffer
-	Size = other.Size;
-	Data = new char[Size + 1];
-	memcpy(Data, other.Data, Size);
-	Data[Size] = '\0';
+	Stats.Track(Core.GetCapacity());
 }
 
 const ConstraintBuffer& ConstraintBuffer::operator=(ConstraintBuffer&& other) noexcept {
@@ -40,15 +35,9 @@ const ConstraintBuffer& ConstraintBuffer::operator=(ConstraintBuffer&& other) no
 	if (&other == this)
 		return *this;
 
-	// Release any resource we're holding
-	Release();
-
 	// take buffer from other
-	Size = other.Size;
-	Data = other.Data;
-
-	other.Size = 0;
-	other.Data = nullptr;
+	Core  = std::move(other.Core);
+	Stats = std::move(other.Stats);
 
 	return *this;
 }
@@ -58,52 +47,45 @@ const ConstraintBuffer& ConstraintBuffer::operator=(const ConstraintBuffer& othe
 	if (&other == this)
 		return *this;
 
-	// Release any resource we're holding
-	Release();
-
 	// Copy the resource
-	Size = other.Size;
-	Data = new char[Size + 1];
-	memcpy(Data, other.Data, Size);
-	Data[Size] = '\0';
+	Core = other.Core;
+	Stats.Track(Core.GetCapacity());
 
 	return *this;
 }
 
 char* ConstraintBuffer::operator*() {
-	return Data;
+	return Core.GetData();
 }
 
 const char* ConstraintBuffer::operator*() const {
-	return Data;
+	return Core.GetData();
 }
 
 char& ConstraintBuffer::operator[](const size_t position) {
-	if (position > Size) {
-		throw std::out_of_range("Access constraint buffer out of range!!!");
-	}
-
-	return Data[position];
+	return Core.At(position);
 }
 
 IBuffer* ConstraintBuffer::operator+(char& value) {
 	const auto buffer = new ConstraintBuffer();
-	buffer->InitBuffer(Data, Size + 1);
-	(*buffer)[Size] = value;
+	buffer->InitBuffer(Core.GetLength() + 1, 0);
+	buffer->Update(0, Core.GetLength(), Core.GetData());
+	buffer->Update(Core.GetLength(), 1, &value);
 	return buffer;
 }
 
 IBuffer* ConstraintBuffer::operator+(IBuffer& buffer) {
 	const auto newBuffer = new ConstraintBuffer();
-	memcpy(**newBuffer, Data, Size);
-	memcpy(**newBuffer + Size, buffer.GetData(), buffer.GetLength());
+	newBuffer->InitBuffer(Core.GetLength() + buffer.GetLength(), 0);
+	newBuffer->Update(0, Core.GetLength(), Core.GetData());
+	newBuffer->Update(Core.GetLength(), buffer.GetLength(), buffer.GetData());
 	return newBuffer;
 }
 
 IBufferPtr ConstraintBuffer::operator+(IBufferPtr& buffer) {
-	auto newBuffer = CreateBuffer(BufferType::Constraint, Size + buffer->GetLength(), 0);
-	memcpy(**newBuffer, Data, Size);
-	memcpy(**newBuffer + Size, buffer->GetData(), buffer->GetLength());
+	auto newBuffer = CreateBuffer(BufferType::Constraint, Core.GetLength() + buffer->GetLength(), 0);
+	newBuffer->Update(0, Core.GetLength(), Core.GetData());
+	newBuffer->Update(Core.GetLength(), buffer->GetLength(), buffer->GetData());
 	return newBuffer;
 }
 
@@ -124,47 +106,68 @@ BufferType ConstraintBuffer::GetType() {
 }
 
 void ConstraintBuffer::InitBuffer(const size_t size, const char initData) {
-	// Release any resource we're holding
-	Release();
-
-	// init buffer
-	Size = size;
-	Data = new char[Size + 1];
-	memset(Data, initData, Size);
-	Data[Size] = '\0';
+	Core.Allocate(size);
+	BulkFill(Core.GetData(), initData, size);
+	Stats.Track(Core.GetCapacity());
 }
 
 void ConstraintBuffer::InitBuffer(const char* ptr, const size_t size) {
-	// Release any resource we're holding
-	Release();
+	Core.Allocate(size);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Stats.Track(Core.GetCapacity());
+}
+
+void ConstraintBuffer::InitBuffer(const size_t size, const char initData, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	BulkFill(Core.GetData(), initData, size);
+	Stats.Track(Core.GetCapacity());
+}
 
-	// init buffer
-	Size = size;
-	Data = new char[Size + 1];
-	memcpy(Data, ptr, Size);
-	Data[Size] = '\0';
+void ConstraintBuffer::InitBuffer(const char* ptr, const size_t size, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Stats.Track(Core.GetCapacity());
+}
+
+void ConstraintBuffer::Allocate(const size_t size, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	Stats.Track(Core.GetCapacity());
 }
 
 void ConstraintBuffer::Release() {
-	delete Data;
-	Data = nullptr;
-	Size = 0;
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Release", Core.GetCapacity());
+
+	Core.Release();
+	Stats.Track(0);
 }
 
 bool ConstraintBuffer::Update(const size_t offset, const size_t size, const char* ptr) {
-	if (!Data || offset + size > Size)
-		return false;
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Update", size);
 
-	memcpy(Data + offset, ptr, size);
-	return true;
+	return Core.Update(offset, size, ptr);
 }
 
 void ConstraintBuffer::CopyTo(IBufferPtr buffer, const int length) const {
-	if (!Data || Size == 0)
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CopyTo", Core.GetLength());
+
+	const auto dataSize = Core.GetLength();
+	if (!Core.GetData() || dataSize == 0)
+		return;
+
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	const auto copySize = size < buffer->GetLength() ? size : buffer->GetLength();
+	if (!copySize)
 		return;
 
-	const auto size = length == -1 || length > Size ? Size : length;
-	buffer->Update(0, size < buffer->GetLength() ? size : buffer->GetLength(), Data);
+	// plain destination is bulk copied, other types keep their own write path
+	if (auto* target = GetDirectWriteData(*buffer)) {
+		if (target != Core.GetData())
+			BulkCopy(target, Core.GetData(), copySize);
+	} else {
+		buffer->Update(0, copySize, Core.GetData());
+	}
 }
 
 bool ConstraintBuffer::Append(const char& data) {
@@ -183,31 +186,33 @@ bool ConstraintBuffer::Insert(const int index, const char* data, const int lengt
 }
 
 void ConstraintBuffer::Clear(const int length) {
-	if (!Data || Size == 0)
-		return;
-
-	const auto clearSize = length == -1 || length > Size ? Size : length;
-	memset(Data, 0, clearSize);
+	if (Core.GetData())
+		BulkFill(Core.GetData(), 0, std::min<size_t>(length == -1 ? Core.GetLength() : length, Core.GetLength()));
 }
 
 size_t ConstraintBuffer::GetLength() const {
-	return Size;
+	return Core.GetLength();
 }
 
 size_t ConstraintBuffer::GetMemSize() const {
-	return sizeof(ConstraintBuffer) + Size + 1;
+	return sizeof(ConstraintBuffer) + Core.GetCapacity();
 }
 
 const char* ConstraintBuffer::GetData() const {
-	return Data;
+	return Core.GetData();
+}
+
+BufferAllocation ConstraintBuffer::GetAllocation() const {
+	return Core.GetAllocation();
 }
 
 IBufferPtr ConstraintBuffer::CreateBufferCopy(const BufferType type, const int length) const {
-	if (!Data || Size == 0)
+	const auto dataSize = Core.GetLength();
+	if (!Core.GetData() || dataSize == 0)
 		return CreateBuffer(type, length, 0);
 
-	const auto size = length == -1 || length > Size ? Size : length;
-	return CreateBuffer(type, Data, size);
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	return CreateBuffer(type, Core.GetData(), size, Core.GetAllocation());
 }
 
 IStreaming* ConstraintBuffer::GetStreaming() {
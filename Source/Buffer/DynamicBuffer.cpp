@@ -3,33 +3,30 @@
  * */
 
 #include "Buffer/DynamicBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BulkMemory.h"
+#include "Trace/Trace.h"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 using namespace std;
 using namespace VisCore::Buffer;
 using namespace VisCore::Streaming;
 
-DynamicBuffer::DynamicBuffer() : Data(0), Size(0) {
+DynamicBuffer::DynamicBuffer() : Stats(BufferType::Dynamic) {
 }
 
 DynamicBuffer::~DynamicBuffer() {
 	DynamicBuffer::Release();
 }
 
-DynamicBuffer::DynamicBuffer(DynamicBuffer&& other) noexcept {
-	// take buffer from other
-	Size = other.Size;
-	Data.swap(other.Data);
-
-	other.Size = 0;
-	other.Data.clear();
-}
+DynamicBuffer::DynamicBuffer(DynamicBuffer&& other) noexcept = default;
 
-DynamicBuffer::DynamicBuffer(const DynamicBuffer& other) noexcept {
+DynamicBuffer::DynamicBuffer(const DynamicBuffer& other) noexcept : Core(other.Core), Stats(other.Stats) {
 	// copy buffer
-	Size = other.Size;
-	Data = other.Data;
+	Stats.Track(Core.GetCapacity());
 }
 
 const DynamicBuffer& DynamicBuffer::operator=(DynamicBuffer&& other) noexcept {
@@ -37,15 +34,9 @@ const DynamicBuffer& DynamicBuffer::operator=(DynamicBuffer&& other) noexcept {
 	if (&other == this)
 		return *this;
 
-	// Release any resource we're holding
-	Release();
-
-	// Copy the resource
-	Size = other.Size;
-	Data.swap(other.Data);
-
-	other.Size = 0;
-	other.Data.clear();
+	// take buffer from other
+	Core  = std::move(other.Core);
+	Stats = std::move(other.Stats);
 
 	return *this;
 }
@@ -55,49 +46,39 @@ const DynamicBuffer& DynamicBuffer::operator=(const DynamicBuffer& other) noexce
 	if (&other == this)
 		return *this;
 
-	// Release any resource we're holding
-	Release();
-
 	// Copy the resource
-	Size = other.Size;
-	Data = other.Data;
+	Core = other.Core;
+	Stats.Track(Core.GetCapacity());
 
 	return *this;
 }
 
 char* DynamicBuffer::operator*() {
-	return Data.data();
+	return Core.GetData();
 }
 
 const char* DynamicBuffer::operator*() const {
-	return Data.data();
+	return Core.GetData();
 }
 
 char& DynamicBuffer::operator[](size_t position) {
-	if (position > Size) {
-		throw std::out_of_range("Access constraint buffer out of range!!!");
-	}
-
-	return Data[position];
+	return Core.At(position);
 }
 
 IBuffer* DynamicBuffer::operator+(char& value) {
-	Size += 1;
-	Data.resize(Size + 1);
-	Data[Size - 1] = value;
-	Data[Size] = '\0';
+	Append(value);
 	return this;
 }
 
 IBuffer* DynamicBuffer::operator+(IBuffer& buffer) {
-	Append(buffer.GetData(), buffer.GetLength());
+	Append(buffer.GetData(), static_cast<int>(buffer.GetLength()));
 	return this;
 }
 
 IBufferPtr DynamicBuffer::operator+(IBufferPtr& buffer) {
-	auto newBuffer = CreateBuffer(BufferType::Constraint, Size + buffer->GetLength(), 0);
-	memcpy(**newBuffer, Data.data(), Size);
-	memcpy(**newBuffer + Size, buffer->GetData(), buffer->GetLength());
+	auto newBuffer = CreateBuffer(BufferType::Constraint, Core.GetLength() + buffer->GetLength(), 0);
+	newBuffer->Update(0, Core.GetLength(), Core.GetData());
+	newBuffer->Update(Core.GetLength(), buffer->GetLength(), buffer->GetData());
 	return newBuffer;
 }
 
@@ -118,102 +99,150 @@ BufferType DynamicBuffer::GetType() {
 }
 
 void DynamicBuffer::InitBuffer(const size_t size, const char initData) {
-	// Release any resource we're holding
-	Release();
-
-	// init buffer
-	Size = size;
-	Data.resize(Size + 1, initData);
-	Data[Size] = '\0';
+	Core.Allocate(size);
+	BulkFill(Core.GetData(), initData, size);
+	Stats.Track(Core.GetCapacity());
 }
 
 void DynamicBuffer::InitBuffer(const char* ptr, const size_t size) {
-	// Release any resource we're holding
-	Release();
+	Core.Allocate(size);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Stats.Track(Core.GetCapacity());
+}
+
+void DynamicBuffer::InitBuffer(const size_t size, const char initData, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	BulkFill(Core.GetData(), initData, size);
+	Stats.Track(Core.GetCapacity());
+}
 
-	// init buffer
-	Size = size;
-	Data.resize(Size + 1);
-	memcpy(Data.data(), ptr, size);
-	Data[Size] = '\0';
+void DynamicBuffer::InitBuffer(const char* ptr, const size_t size, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Stats.Track(Core.GetCapacity());
+}
+
+void DynamicBuffer::Allocate(const size_t size, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	Stats.Track(Core.GetCapacity());
 }
 
 void DynamicBuffer::Release() {
-	decltype(Data)().swap(Data);
-	Size = 0;
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Release", Core.GetCapacity());
+
+	Core.Release();
+	Stats.Track(0);
 }
 
 bool DynamicBuffer::Update(const size_t offset, const size_t size, const char* ptr) {
-	if (offset + size > Size) {
-		Size = offset + size;
-		Data.resize(Size + 1);
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Update", size);
+
+	const auto result = Core.Update(offset, size, ptr);
+	Stats.Track(Core.GetCapacity());
+	return result;
+}
+
+bool DynamicBuffer::UpdateMany(const UpdateRegion* regions, const size_t count, const size_t threads) {
+	if (count == 0)
+		return true;
+
+	if (!regions)
+		return false;
+
+	// grow once for the whole batch
+	size_t end = Core.GetLength();
+	for (size_t index = 0; index < count; ++index) {
+		const auto& region = regions[index];
+		if (region.Size == 0)
+			continue;
+
+		if (!region.Ptr)
+			return false;
+
+		end = std::max(end, region.Offset + region.Size);
 	}
 
-	memcpy(Data.data() + offset, ptr, size);
-	return true;
+	Core.Resize(end);
+	Stats.Track(Core.GetCapacity());
+
+	return IBuffer::UpdateMany(regions, count, threads);
 }
 
 void DynamicBuffer::CopyTo(IBufferPtr buffer, const int length) const {
-	if (Size == 0)
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CopyTo", Core.GetLength());
+
+	const auto dataSize = Core.GetLength();
+	if (dataSize == 0)
 		return;
 
-	const auto size = length == -1 || length > Size ? Size : length;
-	buffer->Update(0, size < buffer->GetLength() ? size : buffer->GetLength(), Data.data());
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	const auto copySize = size < buffer->GetLength() ? size : buffer->GetLength();
+	if (!copySize)
+		return;
+
+	// plain destination is bulk copied, other types keep their own write path
+	if (auto* target = GetDirectWriteData(*buffer)) {
+		if (target != Core.GetData())
+			BulkCopy(target, Core.GetData(), copySize);
+	} else {
+		buffer->Update(0, copySize, Core.GetData());
+	}
 }
 
 bool DynamicBuffer::Append(const char& data) {
-	Size += 1;
-	Data.resize(Size + 1);
-	Data[Size - 1] = data;
-	Data[Size] = '\0';
-
-	return true;
+	const auto result = Core.Append(data);
+	Stats.Track(Core.GetCapacity());
+	return result;
 }
 
 bool DynamicBuffer::Append(const char* data, const int length) {
-	const auto oldSize = Size;
-
-	Size += length;
-	Data.resize(Size + 1);
-	memcpy(Data.data() + oldSize, data, length);
-	Data[Size] = '\0';
+	if (length < 0)
+		return false;
 
-	return true;
+	const auto result = Core.Append(data, length);
+	Stats.Track(Core.GetCapacity());
+	return result;
 }
 
 bool DynamicBuffer::Insert(int index, const char* data, const int length) {
-	Size += length;
-	Data.insert(Data.begin() + index, data, data + length);
+	if (index < 0 || length < 0)
+		return false;
 
-	return true;
+	const auto result = Core.Insert(index, data, length);
+	Stats.Track(Core.GetCapacity());
+	return result;
 }
 
 void DynamicBuffer::Clear(const int length) {
-	if (Size == 0)
-		return;
-
-	const auto clearSize = length == -1 || length > Size ? Size : length;
-	memset(Data.data(), 0, clearSize);
+	if (Core.GetData())
+		BulkFill(Core.GetData(), 0, std::min<size_t>(length == -1 ? Core.GetLength() : length, Core.GetLength()));
 }
 
 size_t DynamicBuffer::GetLength() const {
-	return Size;
+	return Core.GetLength();
 }
 
 size_t DynamicBuffer::GetMemSize() const {
-	return sizeof(DynamicBuffer) + Data.capacity();
+	return sizeof(DynamicBuffer) + Core.GetCapacity();
 }
 
 const char* DynamicBuffer::GetData() const {
-	return Data.data();
+	return Core.GetData();
+}
+
+BufferAllocation DynamicBuffer::GetAllocation() const {
+	return Core.GetAllocation();
 }
 
 IBufferPtr DynamicBuffer::CreateBufferCopy(const BufferType type, const int length) const {
-	if (Size == 0)
+	const auto dataSize = Core.GetLength();
+	if (dataSize == 0)
 		return CreateBuffer(type, length, 0);
 
-	const auto size = length == -1 || length > Size ? Size : length;
-	return CreateBuffer(type, Data.data(), size);
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	return CreateBuffer(type, Core.GetData(), size, Core.GetAllocation());
 }
 
 IStreaming* DynamicBuffer::GetStreaming() {
@@ -0,0 +1,638 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/ManagedBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BulkMemory.h"
+#include "Buffer/Compression.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+using namespace VisCore::Streaming;
+
+namespace {
+	int64_t Now() noexcept {
+		using namespace std::chrono;
+		return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	 * \brief Process wide counters behind MemoryBudgetStats
+	 */
+	struct BudgetCounters {
+		std::atomic<uint64_t> ManagedBuffers{0};
+		std::atomic<uint64_t> CompressedBuffers{0};
+		std::atomic<uint64_t> ResidentBytes{0};
+		std::atomic<uint64_t> CompressedBytes{0};
+		std::atomic<uint64_t> OriginalBytes{0};
+		std::atomic<uint64_t> Compressions{0};
+		std::atomic<uint64_t> Decompressions{0};
+		std::atomic<uint64_t> Rejected{0};
+	};
+
+	BudgetCounters Counters;
+
+	/**
+	 * \brief Registered buffers in CLOCK order and budget settings
+	 */
+	struct RegistryState {
+		std::mutex                 Mutex;
+		std::vector<ManagedBuffer*> Buffers;
+		size_t                     Hand = 0;
+		MemoryBudgetConfig         Config;
+
+		/**
+		 * \brief Copy of Config.Budget for check without lock
+		 */
+		std::atomic<size_t> Budget{SIZE_MAX};
+	};
+
+	/**
+	 * \brief Never destroyed, buffers with static lifetime unregister after other statics are gone
+	 */
+	RegistryState& GetRegistry() {
+		static auto* registry = new RegistryState();
+		return *registry;
+	}
+
+	uint64_t GetBudgetBytes() noexcept {
+		return Counters.ResidentBytes.load(std::memory_order_relaxed) +
+		       Counters.CompressedBytes.load(std::memory_order_relaxed);
+	}
+}
+
+namespace VisCore::Buffer {
+	/**
+	 * \brief Budget registry, lock order is registry mutex then buffer mutex and buffer mutex is
+	 *		  only try locked under registry, so a buffer busy restoring is skipped
+	 */
+	class ManagedRegistry {
+	public:
+		static void Add(ManagedBuffer* buffer) {
+			auto& registry = GetRegistry();
+			lock_guard lock(registry.Mutex);
+			buffer->RegistryIndex = registry.Buffers.size();
+			registry.Buffers.push_back(buffer);
+		}
+
+		static void Remove(ManagedBuffer* buffer) {
+			auto& registry = GetRegistry();
+			lock_guard lock(registry.Mutex);
+			const auto index = buffer->RegistryIndex;
+			registry.Buffers[index] = registry.Buffers.back();
+			registry.Buffers[index]->RegistryIndex = index;
+			registry.Buffers.pop_back();
+			buffer->RegistryIndex = -1;
+		}
+
+		/**
+		 * \brief Walk registry once from CLOCK hand compressing idle buffers
+		 * \param except buffer in use by caller, never compressed
+		 * \param trim ignore budget and visit every buffer
+		 * \return bytes saved
+		 */
+		static size_t Sweep(const ManagedBuffer* except, const bool trim) {
+			VIS_CORE_TRACE_SCOPE("Buffer::BudgetSweep");
+
+			auto& registry = GetRegistry();
+			lock_guard lock(registry.Mutex);
+
+			const auto now   = Now();
+			const auto count = registry.Buffers.size();
+			size_t     saved = 0;
+			for (size_t visited = 0; visited < count; ++visited) {
+				if (!trim && GetBudgetBytes() <= registry.Config.Budget)
+					break;
+
+				if (registry.Hand >= count)
+					registry.Hand = 0;
+				auto* buffer = registry.Buffers[registry.Hand++];
+				if (buffer != except)
+					saved += buffer->TryCompress(now, registry.Config);
+			}
+			return saved;
+		}
+
+		/**
+		 * \brief Sweep only when over budget
+		 */
+		static void Enforce(const ManagedBuffer* except) {
+			if (GetBudgetBytes() > GetRegistry().Budget.load(std::memory_order_relaxed))
+				Sweep(except, false);
+		}
+	};
+}
+
+ManagedBuffer::ManagedBuffer()
+	: Packed(nullptr), PackedSize(0), Length(0), Stats(BufferType::Managed), Position(0), DataState(State::Resident),
+	  Accessed(false), Incompressible(false), Pins(0), LastAccess(0), RegistryIndex(-1) {
+}
+
+ManagedBuffer::~ManagedBuffer() {
+	ManagedBuffer::Release();
+}
+
+char* ManagedBuffer::operator*() {
+	return Acquire(true);
+}
+
+const char* ManagedBuffer::operator*() const {
+	return Acquire(false);
+}
+
+char& ManagedBuffer::operator[](const size_t position) {
+	Acquire(true);
+	return Core.At(position);
+}
+
+IBuffer* ManagedBuffer::operator+(char& value) {
+	const auto buffer = new ManagedBuffer();
+	buffer->InitBuffer(Length + 1, 0);
+	const AccessScope access(*this, false);
+	buffer->Update(0, Length, access.Data);
+	buffer->Update(Length, 1, &value);
+	return buffer;
+}
+
+IBuffer* ManagedBuffer::operator+(IBuffer& buffer) {
+	const auto newBuffer = new ManagedBuffer();
+	newBuffer->InitBuffer(Length + buffer.GetLength(), 0);
+	const AccessScope access(*this, false);
+	newBuffer->Update(0, Length, access.Data);
+	newBuffer->Update(Length, buffer.GetLength(), buffer.GetData());
+	return newBuffer;
+}
+
+IBufferPtr ManagedBuffer::operator+(IBufferPtr& buffer) {
+	auto newBuffer = CreateBuffer(BufferType::Managed, Length + buffer->GetLength(), 0);
+	const AccessScope access(*this, false);
+	newBuffer->Update(0, Length, access.Data);
+	newBuffer->Update(Length, buffer->GetLength(), buffer->GetData());
+	return newBuffer;
+}
+
+IBuffer* ManagedBuffer::operator+=(char& value) {
+	return *this + value;
+}
+
+IBuffer* ManagedBuffer::operator+=(IBuffer& buffer) {
+	return *this + buffer;
+}
+
+IBufferPtr ManagedBuffer::operator+=(IBufferPtr& buffer) {
+	return *this + buffer;
+}
+
+BufferType ManagedBuffer::GetType() {
+	return BufferType::Managed;
+}
+
+void ManagedBuffer::InitBuffer(const size_t size, const char initData) {
+	Release();
+	Core.Allocate(size);
+	BulkFill(Core.GetData(), initData, size);
+	Length = size;
+	Register();
+}
+
+void ManagedBuffer::InitBuffer(const char* ptr, const size_t size) {
+	Release();
+	Core.Allocate(size);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Length = size;
+	Register();
+}
+
+void ManagedBuffer::InitBuffer(const size_t size, const char initData, const BufferAllocation& allocation) {
+	Release();
+	Core.Allocate(size, allocation);
+	BulkFill(Core.GetData(), initData, size);
+	Length = size;
+	Register();
+}
+
+void ManagedBuffer::InitBuffer(const char* ptr, const size_t size, const BufferAllocation& allocation) {
+	Release();
+	Core.Allocate(size, allocation);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Length = size;
+	Register();
+}
+
+void ManagedBuffer::Allocate(const size_t size, const BufferAllocation& allocation) {
+	Release();
+	Core.Allocate(size, allocation);
+	Length = size;
+	Register();
+}
+
+void ManagedBuffer::Pin() {
+	// count pin first so sweep after Acquire() sees it
+	Pins.fetch_add(1);
+	Acquire(false);
+}
+
+bool ManagedBuffer::Unpin() {
+	auto pins = Pins.load();
+	do {
+		if (pins == 0)
+			return false;
+	} while (!Pins.compare_exchange_weak(pins, pins - 1));
+	return true;
+}
+
+bool ManagedBuffer::IsCompressed() const {
+	return DataState.load() == State::Compressed;
+}
+
+size_t ManagedBuffer::TryCompress(const int64_t now, const MemoryBudgetConfig& config) {
+	unique_lock lock(Mutex, try_to_lock);
+	if (!lock.owns_lock())
+		return 0;
+
+	if (DataState.load() != State::Resident || Length == 0 || Length < config.MinBufferSize || Pins.load() ||
+	    Incompressible.load(std::memory_order_relaxed))
+		return 0;
+
+	// second chance, idle time counts from last sweep that saw an access
+	if (Accessed.exchange(false)) {
+		LastAccess = now;
+		return 0;
+	}
+	if (now - LastAccess < static_cast<int64_t>(config.MinIdleMs) * 1000000)
+		return 0;
+
+	// publish state before checking access again, pairs with store then load in Acquire()
+	DataState.store(State::Compressing);
+	if (Accessed.load()) {
+		DataState.store(State::Resident);
+		return 0;
+	}
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Managed::Compress", Length);
+
+	const auto limit  = Length - Length / 8;
+	auto*      packed = static_cast<char*>(malloc(limit));
+	if (!packed) {
+		DataState.store(State::Resident);
+		return 0;
+	}
+
+	const auto size = Compress(Core.GetData(), Length, packed, limit);
+	if (size == static_cast<size_t>(-1) || Accessed.load()) {
+		free(packed);
+		if (size == static_cast<size_t>(-1) && !Accessed.load()) {
+			Incompressible.store(true, std::memory_order_relaxed);
+			Counters.Rejected.fetch_add(1, std::memory_order_relaxed);
+		}
+		DataState.store(State::Resident);
+		return 0;
+	}
+
+	if (auto* shrunk = static_cast<char*>(realloc(packed, size ? size : 1)))
+		packed = shrunk;
+
+	Packed     = packed;
+	PackedSize = size;
+	Core.Release();
+	DataState.store(State::Compressed);
+	Stats.Track(PackedSize);
+
+	Counters.ResidentBytes.fetch_sub(Length, std::memory_order_relaxed);
+	Counters.CompressedBytes.fetch_add(PackedSize, std::memory_order_relaxed);
+	Counters.OriginalBytes.fetch_add(Length, std::memory_order_relaxed);
+	Counters.CompressedBuffers.fetch_add(1, std::memory_order_relaxed);
+	Counters.Compressions.fetch_add(1, std::memory_order_relaxed);
+
+	return Length - PackedSize;
+}
+
+ManagedBuffer::AccessScope::AccessScope(const ManagedBuffer& buffer, const bool write) : Data(nullptr), Owner(buffer) {
+	// count pin first so sweep after Acquire() sees it
+	Owner.Pins.fetch_add(1);
+	try {
+		Data = Owner.Acquire(write);
+	} catch (...) {
+		Owner.Pins.fetch_sub(1);
+		throw;
+	}
+}
+
+ManagedBuffer::AccessScope::~AccessScope() {
+	Owner.Pins.fetch_sub(1);
+}
+
+char* ManagedBuffer::Acquire(const bool write) const {
+	if (write)
+		Incompressible.store(false, std::memory_order_relaxed);
+
+	// store then load, pairs with TryCompress() so one side always sees the other
+	Accessed.store(true);
+	if (DataState.load() != State::Resident)
+		Restore();
+
+	return Core.GetData();
+}
+
+void ManagedBuffer::Restore() const {
+	{
+		lock_guard lock(Mutex);
+		if (DataState.load() != State::Compressed)
+			return;
+
+		VIS_CORE_TRACE_SCOPE_BYTES("Managed::Restore", Length);
+
+		Core.Allocate(Length);
+		if (Decompress(Packed, PackedSize, Core.GetData(), Length) != Length)
+			throw runtime_error("Managed buffer data corrupted");
+
+		Counters.CompressedBytes.fetch_sub(PackedSize, std::memory_order_relaxed);
+		Counters.OriginalBytes.fetch_sub(Length, std::memory_order_relaxed);
+		Counters.ResidentBytes.fetch_add(Length, std::memory_order_relaxed);
+		Counters.CompressedBuffers.fetch_sub(1, std::memory_order_relaxed);
+		Counters.Decompressions.fetch_add(1, std::memory_order_relaxed);
+
+		free(Packed);
+		Packed     = nullptr;
+		PackedSize = 0;
+		LastAccess = Now();
+		DataState.store(State::Resident);
+		Stats.Track(Core.GetCapacity());
+	}
+
+	ManagedRegistry::Enforce(this);
+}
+
+void ManagedBuffer::Register() {
+	LastAccess = Now();
+	Accessed.store(true);
+	Stats.Track(Core.GetCapacity());
+
+	Counters.ManagedBuffers.fetch_add(1, std::memory_order_relaxed);
+	Counters.ResidentBytes.fetch_add(Length, std::memory_order_relaxed);
+
+	ManagedRegistry::Add(this);
+	ManagedRegistry::Enforce(this);
+}
+
+void ManagedBuffer::Release() {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Release", Length);
+
+	if (RegistryIndex != static_cast<size_t>(-1)) {
+		// after remove no sweep can reach this buffer
+		ManagedRegistry::Remove(this);
+
+		Counters.ManagedBuffers.fetch_sub(1, std::memory_order_relaxed);
+		if (Packed) {
+			Counters.CompressedBuffers.fetch_sub(1, std::memory_order_relaxed);
+			Counters.CompressedBytes.fetch_sub(PackedSize, std::memory_order_relaxed);
+			Counters.OriginalBytes.fetch_sub(Length, std::memory_order_relaxed);
+		} else {
+			Counters.ResidentBytes.fetch_sub(Length, std::memory_order_relaxed);
+		}
+	}
+
+	free(Packed);
+	Packed     = nullptr;
+	PackedSize = 0;
+	Length     = 0;
+	Position   = 0;
+	Core.Release();
+	DataState.store(State::Resident);
+	Incompressible.store(false, std::memory_order_relaxed);
+	Stats.Track(0);
+}
+
+bool ManagedBuffer::Update(const size_t offset, const size_t size, const char* ptr) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Update", size);
+
+	if (offset > Length || size > Length - offset)
+		return false;
+
+	const AccessScope access(*this, true);
+	return Core.Update(offset, size, ptr);
+}
+
+bool ManagedBuffer::UpdateMany(const UpdateRegion* regions, const size_t count, const size_t threads) {
+	if (count == 0)
+		return true;
+
+	// workers write through raw pointer, sweep must not compress under them
+	const AccessScope access(*this, true);
+	return IBuffer::UpdateMany(regions, count, threads);
+}
+
+void ManagedBuffer::CopyTo(IBufferPtr buffer, const int length) const {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CopyTo", Length);
+
+	const auto dataSize = Length;
+	if (dataSize == 0 || buffer.get() == this)
+		return;
+
+	const AccessScope access(*this, false);
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	const auto copySize = size < buffer->GetLength() ? size : buffer->GetLength();
+	if (!copySize)
+		return;
+
+	if (auto* target = GetDirectWriteData(*buffer))
+		BulkCopy(target, access.Data, copySize);
+	else
+		buffer->Update(0, copySize, access.Data);
+}
+
+bool ManagedBuffer::Append(const char& data) {
+	// Do nothing
+	return false;
+}
+
+bool ManagedBuffer::Append(const char* data, const int length) {
+	// Do nothing
+	return false;
+}
+
+bool ManagedBuffer::Insert(const int index, const char* data, const int length) {
+	// Do nothing
+	return false;
+}
+
+void ManagedBuffer::Clear(const int length) {
+	if (Length) {
+		const AccessScope access(*this, true);
+		BulkFill(access.Data, 0, std::min<size_t>(length == -1 ? Length : length, Length));
+	}
+}
+
+size_t ManagedBuffer::GetLength() const {
+	return Length;
+}
+
+size_t ManagedBuffer::GetMemSize() const {
+	lock_guard lock(Mutex);
+	return sizeof(ManagedBuffer) + (Packed ? PackedSize : Core.GetCapacity());
+}
+
+const char* ManagedBuffer::GetData() const {
+	return Acquire(false);
+}
+
+BufferAllocation ManagedBuffer::GetAllocation() const {
+	return Core.GetAllocation();
+}
+
+IBufferPtr ManagedBuffer::CreateBufferCopy(const BufferType type, const int length) const {
+	const auto dataSize = Length;
+	if (dataSize == 0)
+		return CreateBuffer(type, length, 0);
+
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	const AccessScope access(*this, false);
+	return CreateBuffer(type, access.Data, size, Core.GetAllocation());
+}
+
+IStreaming* ManagedBuffer::GetStreaming() {
+	return this;
+}
+
+size_t ManagedBuffer::Tell() const {
+	return Position;
+}
+
+size_t ManagedBuffer::Read(IBuffer* buffer, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Managed::Read", length);
+
+	if (IsEof()) {
+		return 0;
+	}
+
+	const AccessScope access(*this, false);
+	const auto*       data = access.Data;
+	if (const size_t nextPosition = Position + length; nextPosition < Length) {
+		const size_t copySize = buffer->GetLength() < length ? buffer->GetLength() : length;
+		buffer->Update(0, copySize, data + Position);
+		Position += copySize;
+		return copySize;
+	}
+
+	const size_t delta = Length - Position;
+	const size_t copySize = buffer->GetLength() < delta ? buffer->GetLength() : delta;
+	buffer->Update(0, copySize, data + Position);
+	Position += copySize;
+	return copySize;
+}
+
+size_t ManagedBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
+	VIS_CORE_TRACE_SCOPE("Managed::Seek");
+
+	switch (seekMode) {
+		case SeekMode::SeekSet: {
+			if (offset <= Length && offset >= 0) {
+				Position = offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		case SeekMode::SeekCurrent: {
+			if (offset >= 0) {
+				const size_t delta = Position + offset;
+				if (delta > Length) {
+					return -1;
+				}
+
+				Position = delta;
+				return Position;
+			}
+
+			if (-offset > Position) {
+				return -1;
+			}
+
+			Position -= -offset;
+			return Position;
+		}
+		case SeekMode::SeekEnd: {
+			if (offset <= 0 && -offset <= Length) {
+				Position = Length - -offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		default:
+			return -1;
+	}
+}
+
+bool ManagedBuffer::IsEof() const {
+	return Position == Length;
+}
+
+void ManagedBuffer::Close() {
+	Release();
+}
+
+MemoryBudgetConfig Buffer::GetMemoryBudgetConfig() {
+	auto& registry = GetRegistry();
+	lock_guard lock(registry.Mutex);
+	return registry.Config;
+}
+
+void Buffer::SetMemoryBudgetConfig(const MemoryBudgetConfig& config) {
+	{
+		auto& registry = GetRegistry();
+		lock_guard lock(registry.Mutex);
+		registry.Config = config;
+		registry.Budget.store(config.Budget, std::memory_order_relaxed);
+	}
+
+	ManagedRegistry::Enforce(nullptr);
+}
+
+MemoryBudgetStats Buffer::GetMemoryBudgetStats() {
+	MemoryBudgetStats stats{};
+	stats.ManagedBuffers    = Counters.ManagedBuffers.load(std::memory_order_relaxed);
+	stats.CompressedBuffers = Counters.CompressedBuffers.load(std::memory_order_relaxed);
+	stats.ResidentBytes     = Counters.ResidentBytes.load(std::memory_order_relaxed);
+	stats.CompressedBytes   = Counters.CompressedBytes.load(std::memory_order_relaxed);
+	stats.OriginalBytes     = Counters.OriginalBytes.load(std::memory_order_relaxed);
+	stats.Compressions      = Counters.Compressions.load(std::memory_order_relaxed);
+	stats.Decompressions    = Counters.Decompressions.load(std::memory_order_relaxed);
+	stats.Rejected          = Counters.Rejected.load(std::memory_order_relaxed);
+	return stats;
+}
+
+size_t Buffer::TrimMemoryBudget() {
+	return ManagedRegistry::Sweep(nullptr, true);
+}
+
+bool Buffer::PinBuffer(IBuffer& buffer) {
+	if (buffer.GetType() != BufferType::Managed)
+		return false;
+
+	static_cast<ManagedBuffer&>(buffer).Pin();
+	return true;
+}
+
+bool Buffer::UnpinBuffer(IBuffer& buffer) {
+	if (buffer.GetType() != BufferType::Managed)
+		return false;
+
+	return static_cast<ManagedBuffer&>(buffer).Unpin();
+}
+
+bool Buffer::IsBufferCompressed(IBuffer& buffer) {
+	return buffer.GetType() == BufferType::Managed && static_cast<ManagedBuffer&>(buffer).IsCompressed();
+}
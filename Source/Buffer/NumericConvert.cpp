@@ -0,0 +1,523 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/NumericConvert.h"
+#include "Buffer/BufferFactory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIS_CORE_NUMERIC_SSE2 1
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VIS_CORE_NUMERIC_F16C 1
+#define VIS_CORE_TARGET_F16C __attribute__((target("avx,f16c")))
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define VIS_CORE_NUMERIC_NEON 1
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+
+namespace {
+	/**
+	 * \brief Elements converted through Float32 per step when neither side is Float32
+	 */
+	constexpr size_t StagingCount = 1024;
+
+	uint32_t FloatBits(const float value) {
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	float BitsFloat(const uint32_t bits) {
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	template<typename T>
+	T Load(const char* data) {
+		T value;
+		memcpy(&value, data, sizeof(T));
+		return value;
+	}
+
+	template<typename T>
+	void Store(char* data, const T value) {
+		memcpy(data, &value, sizeof(T));
+	}
+
+	/**
+	 * \brief Decode one element of format to float
+	 */
+	template<NumericFormat Format>
+	float Decode(const char* data) {
+		if constexpr (Format == NumericFormat::Float16) {
+			return HalfToFloat(Load<uint16_t>(data));
+		} else if constexpr (Format == NumericFormat::BFloat16) {
+			return BFloat16ToFloat(Load<uint16_t>(data));
+		} else if constexpr (Format == NumericFormat::Unorm8) {
+			return static_cast<float>(static_cast<uint8_t>(*data)) / 255.0f;
+		} else if constexpr (Format == NumericFormat::Snorm16) {
+			return std::max(static_cast<float>(Load<int16_t>(data)) / 32767.0f, -1.0f);
+		} else {
+			return Load<float>(data);
+		}
+	}
+
+	/**
+	 * \brief Encode one float to element of format, same rounding as SSE conversion
+	 */
+	template<NumericFormat Format>
+	void Encode(const float value, char* data) {
+		if constexpr (Format == NumericFormat::Float16) {
+			Store(data, FloatToHalf(value));
+		} else if constexpr (Format == NumericFormat::BFloat16) {
+			Store(data, FloatToBFloat16(value));
+		} else if constexpr (Format == NumericFormat::Unorm8) {
+			// NaN fails the compare and becomes 0
+			const auto clamped = value > 0.0f ? std::min(value, 1.0f) : 0.0f;
+			*data              = static_cast<char>(std::lrint(clamped * 255.0f));
+		} else if constexpr (Format == NumericFormat::Snorm16) {
+			const auto clamped = value == value ? std::min(std::max(value, -1.0f), 1.0f) : 0.0f;
+			Store(data, static_cast<int16_t>(std::lrint(clamped * 32767.0f)));
+		} else {
+			Store(data, value);
+		}
+	}
+
+	template<NumericFormat Format>
+	void DecodeScalar(const char* source, char* destination, const size_t count) {
+		for (size_t index = 0; index < count; ++index) {
+			Store(destination + index * sizeof(float), Decode<Format>(source + index * GetNumericSize(Format)));
+		}
+	}
+
+	template<NumericFormat Format>
+	void EncodeScalar(const char* source, char* destination, const size_t count) {
+		for (size_t index = 0; index < count; ++index) {
+			Encode<Format>(Load<float>(source + index * sizeof(float)), destination + index * GetNumericSize(Format));
+		}
+	}
+
+	#if defined(VIS_CORE_NUMERIC_F16C)
+	bool HasF16c() {
+		static const bool supported = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+		return supported;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	VIS_CORE_TARGET_F16C size_t EncodeHalfF16c(const char* source, char* destination, const size_t count) {
+		size_t index = 0;
+		for (; index + 16 <= count; index += 16) {
+			const auto low  = _mm256_loadu_ps(reinterpret_cast<const float*>(source + index * 4));
+			const auto high = _mm256_loadu_ps(reinterpret_cast<const float*>(source + index * 4 + 32));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index * 2), _mm256_cvtps_ph(low, _MM_FROUND_TO_NEAREST_INT));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index * 2 + 16), _mm256_cvtps_ph(high, _MM_FROUND_TO_NEAREST_INT));
+		}
+		for (; index + 8 <= count; index += 8) {
+			const auto value = _mm256_loadu_ps(reinterpret_cast<const float*>(source + index * 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index * 2), _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+		}
+		return index;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	VIS_CORE_TARGET_F16C size_t DecodeHalfF16c(const char* source, char* destination, const size_t count) {
+		size_t index = 0;
+		for (; index + 16 <= count; index += 16) {
+			const auto low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index * 2));
+			const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index * 2 + 16));
+			_mm256_storeu_ps(reinterpret_cast<float*>(destination + index * 4), _mm256_cvtph_ps(low));
+			_mm256_storeu_ps(reinterpret_cast<float*>(destination + index * 4 + 32), _mm256_cvtph_ps(high));
+		}
+		for (; index + 8 <= count; index += 8) {
+			const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index * 2));
+			_mm256_storeu_ps(reinterpret_cast<float*>(destination + index * 4), _mm256_cvtph_ps(value));
+		}
+		return index;
+	}
+	#endif
+
+	#if defined(VIS_CORE_NUMERIC_NEON)
+	/**
+	 * \return converted elements
+	 */
+	size_t EncodeHalfNeon(const char* source, char* destination, const size_t count) {
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4) {
+			const auto value = vld1q_f32(reinterpret_cast<const float*>(source + index * 4));
+			vst1_u16(reinterpret_cast<uint16_t*>(destination + index * 2), vreinterpret_u16_f16(vcvt_f16_f32(value)));
+		}
+		return index;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	size_t DecodeHalfNeon(const char* source, char* destination, const size_t count) {
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4) {
+			const auto value = vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const uint16_t*>(source + index * 2)));
+			vst1q_f32(reinterpret_cast<float*>(destination + index * 4), vcvt_f32_f16(value));
+		}
+		return index;
+	}
+	#endif
+
+	#if defined(VIS_CORE_NUMERIC_SSE2)
+	__m128 LoadFloats(const char* data) {
+		return _mm_loadu_ps(reinterpret_cast<const float*>(data));
+	}
+
+	void StoreFloats(char* data, const __m128 value) {
+		_mm_storeu_ps(reinterpret_cast<float*>(data), value);
+	}
+
+	/**
+	 * \brief Clamp to [low, high] with NaN mapped to 0, then scale and round to nearest even
+	 */
+	__m128i Quantize(__m128 value, const __m128 low, const __m128 high, const __m128 scale) {
+		value = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+		value = _mm_min_ps(_mm_max_ps(value, low), high);
+		return _mm_cvtps_epi32(_mm_mul_ps(value, scale));
+	}
+
+	/**
+	 * \brief Round high 16 bits to nearest even, NaN is kept quiet. Result is sign extended
+	 *		  so packs_epi32 keeps the bits
+	 */
+	__m128i RoundBFloat16(const __m128 value) {
+		const auto bits    = _mm_castps_si128(value);
+		const auto lsb     = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+		const auto rounded = _mm_add_epi32(bits, _mm_add_epi32(_mm_set1_epi32(0x7FFF), lsb));
+		const auto quiet   = _mm_or_si128(bits, _mm_set1_epi32(0x00400000));
+		const auto nan     = _mm_castps_si128(_mm_cmpunord_ps(value, value));
+		const auto result  = _mm_or_si128(_mm_and_si128(nan, quiet), _mm_andnot_si128(nan, rounded));
+		return _mm_srai_epi32(result, 16);
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	size_t EncodeBFloat16Sse2(const char* source, char* destination, const size_t count) {
+		size_t index = 0;
+		for (; index + 8 <= count; index += 8) {
+			const auto low  = RoundBFloat16(LoadFloats(source + index * 4));
+			const auto high = RoundBFloat16(LoadFloats(source + index * 4 + 16));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index * 2), _mm_packs_epi32(low, high));
+		}
+		return index;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	size_t DecodeBFloat16Sse2(const char* source, char* destination, const size_t count) {
+		const auto zero  = _mm_setzero_si128();
+		size_t     index = 0;
+		for (; index + 8 <= count; index += 8) {
+			const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index * 2));
+			StoreFloats(destination + index * 4, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, value)));
+			StoreFloats(destination + index * 4 + 16, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, value)));
+		}
+		return index;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	size_t EncodeUnorm8Sse2(const char* source, char* destination, const size_t count) {
+		const auto low   = _mm_setzero_ps();
+		const auto high  = _mm_set1_ps(1.0f);
+		const auto scale = _mm_set1_ps(255.0f);
+		size_t     index = 0;
+		for (; index + 16 <= count; index += 16) {
+			const auto* input = source + index * 4;
+			const auto  first = _mm_packs_epi32(Quantize(LoadFloats(input), low, high, scale),
+			                                    Quantize(LoadFloats(input + 16), low, high, scale));
+			const auto second = _mm_packs_epi32(Quantize(LoadFloats(input + 32), low, high, scale),
+			                                    Quantize(LoadFloats(input + 48), low, high, scale));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), _mm_packus_epi16(first, second));
+		}
+		return index;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	size_t DecodeUnorm8Sse2(const char* source, char* destination, const size_t count) {
+		const auto zero  = _mm_setzero_si128();
+		const auto scale = _mm_set1_ps(255.0f);
+		size_t     index = 0;
+		for (; index + 16 <= count; index += 16) {
+			const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+			const auto low   = _mm_unpacklo_epi8(value, zero);
+			const auto high  = _mm_unpackhi_epi8(value, zero);
+			const __m128i words[4] = {
+				_mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero),
+				_mm_unpacklo_epi16(high, zero), _mm_unpackhi_epi16(high, zero)
+			};
+			for (size_t lane = 0; lane < 4; ++lane) {
+				// divide, not multiply by reciprocal, to match scalar result
+				StoreFloats(destination + index * 4 + lane * 16, _mm_div_ps(_mm_cvtepi32_ps(words[lane]), scale));
+			}
+		}
+		return index;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	size_t EncodeSnorm16Sse2(const char* source, char* destination, const size_t count) {
+		const auto low   = _mm_set1_ps(-1.0f);
+		const auto high  = _mm_set1_ps(1.0f);
+		const auto scale = _mm_set1_ps(32767.0f);
+		size_t     index = 0;
+		for (; index + 8 <= count; index += 8) {
+			const auto* input = source + index * 4;
+			const auto  value = _mm_packs_epi32(Quantize(LoadFloats(input), low, high, scale),
+			                                    Quantize(LoadFloats(input + 16), low, high, scale));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index * 2), value);
+		}
+		return index;
+	}
+
+	/**
+	 * \return converted elements
+	 */
+	size_t DecodeSnorm16Sse2(const char* source, char* destination, const size_t count) {
+		const auto scale = _mm_set1_ps(32767.0f);
+		const auto low   = _mm_set1_ps(-1.0f);
+		size_t     index = 0;
+		for (; index + 8 <= count; index += 8) {
+			const auto value  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index * 2));
+			const auto first  = _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+			const auto second = _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16);
+			StoreFloats(destination + index * 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(first), scale), low));
+			StoreFloats(destination + index * 4 + 16, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(second), scale), low));
+		}
+		return index;
+	}
+	#endif
+
+	/**
+	 * \brief Convert count elements of format into floats
+	 */
+	void DecodeFloats(const char* source, const NumericFormat from, char* destination, const size_t count) {
+		size_t done = 0;
+		switch (from) {
+			case NumericFormat::Float16:
+				#if defined(VIS_CORE_NUMERIC_F16C)
+				if (HasF16c())
+					done = DecodeHalfF16c(source, destination, count);
+				#elif defined(VIS_CORE_NUMERIC_NEON)
+				done = DecodeHalfNeon(source, destination, count);
+				#endif
+				DecodeScalar<NumericFormat::Float16>(source + done * 2, destination + done * 4, count - done);
+				return;
+			case NumericFormat::BFloat16:
+				#if defined(VIS_CORE_NUMERIC_SSE2)
+				done = DecodeBFloat16Sse2(source, destination, count);
+				#endif
+				DecodeScalar<NumericFormat::BFloat16>(source + done * 2, destination + done * 4, count - done);
+				return;
+			case NumericFormat::Unorm8:
+				#if defined(VIS_CORE_NUMERIC_SSE2)
+				done = DecodeUnorm8Sse2(source, destination, count);
+				#endif
+				DecodeScalar<NumericFormat::Unorm8>(source + done, destination + done * 4, count - done);
+				return;
+			case NumericFormat::Snorm16:
+				#if defined(VIS_CORE_NUMERIC_SSE2)
+				done = DecodeSnorm16Sse2(source, destination, count);
+				#endif
+				DecodeScalar<NumericFormat::Snorm16>(source + done * 2, destination + done * 4, count - done);
+				return;
+			default:
+				memmove(destination, source, count * sizeof(float));
+		}
+	}
+
+	/**
+	 * \brief Convert count floats into elements of format
+	 */
+	void EncodeFloats(const char* source, char* destination, const NumericFormat to, const size_t count) {
+		size_t done = 0;
+		switch (to) {
+			case NumericFormat::Float16:
+				#if defined(VIS_CORE_NUMERIC_F16C)
+				if (HasF16c())
+					done = EncodeHalfF16c(source, destination, count);
+				#elif defined(VIS_CORE_NUMERIC_NEON)
+				done = EncodeHalfNeon(source, destination, count);
+				#endif
+				EncodeScalar<NumericFormat::Float16>(source + done * 4, destination + done * 2, count - done);
+				return;
+			case NumericFormat::BFloat16:
+				#if defined(VIS_CORE_NUMERIC_SSE2)
+				done = EncodeBFloat16Sse2(source, destination, count);
+				#endif
+				EncodeScalar<NumericFormat::BFloat16>(source + done * 4, destination + done * 2, count - done);
+				return;
+			case NumericFormat::Unorm8:
+				#if defined(VIS_CORE_NUMERIC_SSE2)
+				done = EncodeUnorm8Sse2(source, destination, count);
+				#endif
+				EncodeScalar<NumericFormat::Unorm8>(source + done * 4, destination + done, count - done);
+				return;
+			case NumericFormat::Snorm16:
+				#if defined(VIS_CORE_NUMERIC_SSE2)
+				done = EncodeSnorm16Sse2(source, destination, count);
+				#endif
+				EncodeScalar<NumericFormat::Snorm16>(source + done * 4, destination + done * 2, count - done);
+				return;
+			default:
+				memmove(destination, source, count * sizeof(float));
+		}
+	}
+
+	bool RegionInBuffer(const size_t length, const size_t offset, const size_t count, const size_t elementSize) {
+		if (count > (static_cast<size_t>(-1) - offset) / elementSize)
+			return false;
+		return offset <= length && count * elementSize <= length - offset;
+	}
+}
+
+uint16_t Buffer::FloatToHalf(const float value) {
+	// round to nearest even without FPU mode dependence, after ryg's float_to_half_fast3_rtne
+	constexpr uint32_t HalfOverflow = (127 + 16) << 23;
+	constexpr uint32_t HalfNormal   = 113 << 23;
+	constexpr uint32_t DenormMagic  = ((127 - 15) + (23 - 10) + 1) << 23;
+
+	auto       bits = FloatBits(value);
+	const auto sign = bits & 0x80000000u;
+	bits ^= sign;
+
+	uint16_t result;
+	if (bits >= HalfOverflow) {
+		// Inf stays Inf, NaN keeps top payload bits and is made quiet
+		result = bits > 0x7F800000u ? static_cast<uint16_t>(0x7E00 | (bits >> 13 & 0x3FF)) : static_cast<uint16_t>(0x7C00);
+	} else if (bits < HalfNormal) {
+		// float add rounds mantissa into place for subnormal half
+		result = static_cast<uint16_t>(FloatBits(BitsFloat(bits) + BitsFloat(DenormMagic)) - DenormMagic);
+	} else {
+		const auto odd = bits >> 13 & 1;
+		bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF + odd;
+		result = static_cast<uint16_t>(bits >> 13);
+	}
+	return static_cast<uint16_t>(result | sign >> 16);
+}
+
+float Buffer::HalfToFloat(const uint16_t value) {
+	constexpr uint32_t ExponentMask = 0x7C00u << 13;
+	constexpr uint32_t Magic        = 113u << 23;
+
+	auto       bits     = static_cast<uint32_t>(value & 0x7FFF) << 13;
+	const auto exponent = bits & ExponentMask;
+	bits += static_cast<uint32_t>(127 - 15) << 23;
+
+	if (exponent == ExponentMask) {
+		// Inf or NaN, NaN is made quiet like F16C does
+		bits += static_cast<uint32_t>(128 - 16) << 23;
+		if (value & 0x3FF)
+			bits |= 0x00400000u;
+	} else if (exponent == 0) {
+		// subnormal, renormalize by float subtract
+		bits = FloatBits(BitsFloat(bits + (1u << 23)) - BitsFloat(Magic));
+	}
+	return BitsFloat(bits | static_cast<uint32_t>(value & 0x8000) << 16);
+}
+
+uint16_t Buffer::FloatToBFloat16(const float value) {
+	const auto bits = FloatBits(value);
+	if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+		return static_cast<uint16_t>(bits >> 16 | 0x40);
+	return static_cast<uint16_t>((bits + 0x7FFF + (bits >> 16 & 1)) >> 16);
+}
+
+float Buffer::BFloat16ToFloat(const uint16_t value) {
+	return BitsFloat(static_cast<uint32_t>(value) << 16);
+}
+
+void Buffer::ConvertNumeric(const char* source, const NumericFormat from, char* destination, const NumericFormat to,
+                            const size_t count) {
+	if (count == 0)
+		return;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::ConvertNumeric", count * GetNumericSize(from));
+
+	if (from == to) {
+		if (source != destination)
+			memmove(destination, source, count * GetNumericSize(from));
+		return;
+	}
+
+	if (from == NumericFormat::Float32) {
+		EncodeFloats(source, destination, to, count);
+		return;
+	}
+
+	if (to == NumericFormat::Float32) {
+		DecodeFloats(source, from, destination, count);
+		return;
+	}
+
+	float staging[StagingCount];
+	auto* buffer = reinterpret_cast<char*>(staging);
+	for (size_t index = 0; index < count; index += StagingCount) {
+		const auto step = std::min(StagingCount, count - index);
+		DecodeFloats(source + index * GetNumericSize(from), from, buffer, step);
+		EncodeFloats(buffer, destination + index * GetNumericSize(to), to, step);
+	}
+}
+
+bool Buffer::ConvertNumericRegion(const IBuffer& source, const size_t sourceOffset, const NumericFormat from,
+                                  IBuffer& destination, const size_t destinationOffset, const NumericFormat to,
+                                  const size_t count) {
+	if (!RegionInBuffer(source.GetLength(), sourceOffset, count, GetNumericSize(from)) ||
+	    !RegionInBuffer(destination.GetLength(), destinationOffset, count, GetNumericSize(to)))
+		return false;
+
+	if (count == 0)
+		return true;
+
+	// sealed shared destination has no writable memory
+	auto* data = *destination;
+	if (!data)
+		return false;
+
+	ConvertNumeric(source.GetData() + sourceOffset, from, data + destinationOffset, to, count);
+	return true;
+}
+
+IBufferPtr Buffer::ConvertNumeric(const IBuffer& source, const NumericFormat from, const NumericFormat to,
+                                  const BufferType type) {
+	const auto length = source.GetLength();
+	if (length % GetNumericSize(from))
+		return nullptr;
+
+	const auto count  = length / GetNumericSize(from);
+	auto       result = CreateUninitializedBuffer(type, count * GetNumericSize(to), {});
+	if (result && count && !FillBuffer(*result, [&](char* output) {
+		ConvertNumeric(source.GetData(), from, output, to, count);
+		return true;
+	}))
+		return nullptr;
+	return result;
+}
@@ -0,0 +1,308 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/PitchedBuffer.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+
+namespace {
+	constexpr size_t MaxSize = static_cast<size_t>(-1);
+
+	/**
+	 * \brief Get a * b, false on overflow
+	 */
+	bool Multiply(const size_t a, const size_t b, size_t& result) {
+		if (b && a > MaxSize / b)
+			return false;
+		result = a * b;
+		return true;
+	}
+
+	/**
+	 * \brief Get bit count of smallest power of two not less than value
+	 */
+	uint8_t CeilLog2(const size_t value) {
+		uint8_t bits = 0;
+		while (bits < 63 && (static_cast<size_t>(1) << bits) < value) {
+			++bits;
+		}
+		return bits;
+	}
+
+	/**
+	 * \brief Spread low 32 bits of value to even bit positions
+	 */
+	uint64_t SpreadBits(uint64_t value) {
+		value &= 0xFFFFFFFFull;
+		value = (value | value << 16) & 0x0000FFFF0000FFFFull;
+		value = (value | value << 8) & 0x00FF00FF00FF00FFull;
+		value = (value | value << 4) & 0x0F0F0F0F0F0F0F0Full;
+		value = (value | value << 2) & 0x3333333333333333ull;
+		value = (value | value << 1) & 0x5555555555555555ull;
+		return value;
+	}
+
+	bool RectInGrid(const PitchedBuffer& grid, const size_t x, const size_t y, const size_t width, const size_t height) {
+		return x <= grid.GetWidth() && width <= grid.GetWidth() - x && y <= grid.GetHeight() && height <= grid.GetHeight() - y;
+	}
+
+	/**
+	 * \brief Grid or row major memory as copy end point
+	 */
+	struct Surface {
+		const PitchedBuffer* Grid;
+		char*                Base;
+		size_t               Pitch;
+		size_t               ElementSize;
+
+		char* GetAddress(const size_t x, const size_t y) const {
+			return Grid ? Base + Grid->GetOffset(x, y) : Base + y * Pitch + x * ElementSize;
+		}
+
+		size_t GetRun(const size_t x) const {
+			return Grid ? Grid->GetRun(x) : MaxSize;
+		}
+	};
+
+	Surface MakeSurface(const PitchedBuffer& grid) {
+		return {&grid, **grid.GetBuffer(), 0, grid.GetElementSize()};
+	}
+
+	void CopySurface(const Surface& destination, const size_t x, const size_t y, const Surface& source, const size_t sourceX,
+	                 const size_t sourceY, const size_t width, const size_t height) {
+		const auto elementSize = destination.ElementSize;
+		for (size_t row = 0; row < height; ++row) {
+			for (size_t column = 0; column < width;) {
+				const auto run = std::min({width - column, destination.GetRun(x + column), source.GetRun(sourceX + column)});
+				memcpy(destination.GetAddress(x + column, y + row), source.GetAddress(sourceX + column, sourceY + row),
+				       run * elementSize);
+				column += run;
+			}
+		}
+	}
+
+	/**
+	 * \brief Transpose one block of rows at fixed pitch, fixed size lets copy become a move
+	 */
+	template<size_t Size>
+	void TransposeBlock(char* destination, const size_t destinationPitch, const char* source, const size_t sourcePitch,
+	                    const size_t width, const size_t height) {
+		for (size_t row = 0; row < height; ++row) {
+			for (size_t column = 0; column < width; ++column) {
+				memcpy(destination + column * destinationPitch + row * Size, source + row * sourcePitch + column * Size, Size);
+			}
+		}
+	}
+
+	void TransposeBlock(char* destination, const size_t destinationPitch, const char* source, const size_t sourcePitch,
+	                    const size_t width, const size_t height, const size_t elementSize) {
+		switch (elementSize) {
+			case 1:
+				return TransposeBlock<1>(destination, destinationPitch, source, sourcePitch, width, height);
+			case 2:
+				return TransposeBlock<2>(destination, destinationPitch, source, sourcePitch, width, height);
+			case 4:
+				return TransposeBlock<4>(destination, destinationPitch, source, sourcePitch, width, height);
+			case 8:
+				return TransposeBlock<8>(destination, destinationPitch, source, sourcePitch, width, height);
+			default:
+				for (size_t row = 0; row < height; ++row) {
+					for (size_t column = 0; column < width; ++column) {
+						memcpy(destination + column * destinationPitch + row * elementSize,
+						       source + row * sourcePitch + column * elementSize, elementSize);
+					}
+				}
+		}
+	}
+}
+
+PitchedBuffer::PitchedBuffer(const size_t width, const size_t height, const size_t elementSize,
+                             const PitchedLayout layout, const size_t alignment)
+	: Width(width), Height(height), ElementSize(elementSize), Layout(layout) {
+	if (elementSize == 0)
+		throw std::invalid_argument("Pitched buffer element size is 0!!!");
+	if (alignment == 0 || (alignment & (alignment - 1)))
+		throw std::invalid_argument("Pitched buffer alignment is not power of two!!!");
+
+	size_t size = 0;
+	bool   fit  = false;
+	switch (layout) {
+		case PitchedLayout::Linear: {
+			size_t row = 0;
+			fit        = Multiply(width, elementSize, row) && row <= MaxSize - (alignment - 1);
+			Pitch      = (row + alignment - 1) & ~(alignment - 1);
+			fit        = fit && Multiply(Pitch, height, size);
+			break;
+		}
+		case PitchedLayout::Tiled: {
+			const auto tilesX = (width + PitchedTileEdge - 1) / PitchedTileEdge;
+			const auto tilesY = (height + PitchedTileEdge - 1) / PitchedTileEdge;
+			fit               = Multiply(tilesX, PitchedTileEdge * PitchedTileEdge * elementSize, Pitch) &&
+			                    Multiply(Pitch, tilesY, size);
+			break;
+		}
+		case PitchedLayout::Morton: {
+			const auto bitsX = CeilLog2(width);
+			const auto bitsY = CeilLog2(height);
+			MortonBits       = std::min(bitsX, bitsY);
+			MortonWideX      = bitsX > bitsY;
+			// interleaved part is spread from 32 bits
+			fit = MortonBits <= 32 && bitsX + bitsY < 63 &&
+			      Multiply(static_cast<size_t>(1) << (bitsX + bitsY), elementSize, size);
+			break;
+		}
+	}
+
+	if (!fit)
+		throw std::length_error("Pitched buffer size overflow!!!");
+
+	BufferAllocation allocation;
+	allocation.Alignment = alignment;
+	Storage              = CreateBuffer(BufferType::Constraint, size, 0, allocation);
+}
+
+size_t PitchedBuffer::GetOffset(const size_t x, const size_t y) const noexcept {
+	switch (Layout) {
+		case PitchedLayout::Tiled: {
+			const auto tile = y / PitchedTileEdge * Pitch + x / PitchedTileEdge * PitchedTileEdge * PitchedTileEdge * ElementSize;
+			return tile + (y % PitchedTileEdge * PitchedTileEdge + x % PitchedTileEdge) * ElementSize;
+		}
+		case PitchedLayout::Morton: {
+			const auto low  = (static_cast<size_t>(1) << MortonBits) - 1;
+			const auto high = (MortonWideX ? x : y) >> MortonBits;
+			const auto code = SpreadBits(x & low) | SpreadBits(y & low) << 1 | static_cast<uint64_t>(high) << (MortonBits * 2);
+			return static_cast<size_t>(code) * ElementSize;
+		}
+		default:
+			return y * Pitch + x * ElementSize;
+	}
+}
+
+size_t PitchedBuffer::GetRun(const size_t x) const noexcept {
+	switch (Layout) {
+		case PitchedLayout::Tiled:
+			return std::min(PitchedTileEdge - x % PitchedTileEdge, Width - x);
+		case PitchedLayout::Morton:
+			// x bit 0 is lowest code bit, single row grid is plain x order
+			if (MortonBits == 0)
+				return MortonWideX ? Width - x : 1;
+			return std::min(x % 2 ? static_cast<size_t>(1) : static_cast<size_t>(2), Width - x);
+		default:
+			return Width - x;
+	}
+}
+
+char* PitchedBuffer::GetElement(const size_t x, const size_t y) {
+	if (x >= Width || y >= Height)
+		return nullptr;
+	return **Storage + GetOffset(x, y);
+}
+
+const char* PitchedBuffer::GetElement(const size_t x, const size_t y) const {
+	if (x >= Width || y >= Height)
+		return nullptr;
+	return Storage->GetData() + GetOffset(x, y);
+}
+
+Span<char> PitchedBuffer::GetRow(const size_t y) {
+	if (Layout != PitchedLayout::Linear || y >= Height)
+		return {};
+	return Span<char>(**Storage + y * Pitch, Width * ElementSize);
+}
+
+Span<const char> PitchedBuffer::GetRow(const size_t y) const {
+	if (Layout != PitchedLayout::Linear || y >= Height)
+		return {};
+	return Span<const char>(Storage->GetData() + y * Pitch, Width * ElementSize);
+}
+
+bool PitchedBuffer::Update(const size_t x, const size_t y, const size_t width, const size_t height, const char* data,
+                           const size_t pitch) {
+	if (!RectInGrid(*this, x, y, width, height))
+		return false;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("PitchedBuffer::Update", width * height * ElementSize);
+
+	const Surface source{nullptr, const_cast<char*>(data), pitch, ElementSize};
+	CopySurface(MakeSurface(*this), x, y, source, 0, 0, width, height);
+	return true;
+}
+
+bool PitchedBuffer::Read(const size_t x, const size_t y, const size_t width, const size_t height, char* data,
+                         const size_t pitch) const {
+	if (!RectInGrid(*this, x, y, width, height))
+		return false;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("PitchedBuffer::Read", width * height * ElementSize);
+
+	const Surface destination{nullptr, data, pitch, ElementSize};
+	CopySurface(destination, 0, 0, MakeSurface(*this), x, y, width, height);
+	return true;
+}
+
+bool PitchedBuffer::CopyRect(const PitchedBuffer& source, const size_t sourceX, const size_t sourceY, const size_t width,
+                             const size_t height, const size_t x, const size_t y) {
+	if (source.ElementSize != ElementSize || !RectInGrid(source, sourceX, sourceY, width, height) ||
+	    !RectInGrid(*this, x, y, width, height))
+		return false;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("PitchedBuffer::CopyRect", width * height * ElementSize);
+
+	const auto overlap = &source == this && sourceX < x + width && x < sourceX + width && sourceY < y + height &&
+	                     y < sourceY + height;
+	if (overlap) {
+		// runs of tiled layouts may read what an earlier run wrote, go through row major copy
+		std::vector<char> staging(width * height * ElementSize);
+		source.Read(sourceX, sourceY, width, height, staging.data(), width * ElementSize);
+		return Update(x, y, width, height, staging.data(), width * ElementSize);
+	}
+
+	CopySurface(MakeSurface(*this), x, y, MakeSurface(source), sourceX, sourceY, width, height);
+	return true;
+}
+
+bool PitchedBuffer::Transpose(PitchedBuffer& destination) const {
+	if (&destination == this || destination.Width != Height || destination.Height != Width ||
+	    destination.ElementSize != ElementSize)
+		return false;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("PitchedBuffer::Transpose", Width * Height * ElementSize);
+
+	// blocks line up with tiles, so both linear and tiled blocks are rows at fixed pitch
+	const auto  blockPitch = [](const PitchedBuffer& grid) {
+		return grid.Layout == PitchedLayout::Linear ? grid.Pitch
+		       : grid.Layout == PitchedLayout::Tiled ? PitchedTileEdge * grid.ElementSize
+		       : 0;
+	};
+	const auto  fromPitch = blockPitch(*this);
+	const auto  toPitch   = blockPitch(destination);
+	const auto* from      = Storage->GetData();
+	auto*       to        = **destination.Storage;
+	for (size_t blockY = 0; blockY < Height; blockY += PitchedTileEdge) {
+		const auto rows = std::min(PitchedTileEdge, Height - blockY);
+		for (size_t blockX = 0; blockX < Width; blockX += PitchedTileEdge) {
+			const auto columns = std::min(PitchedTileEdge, Width - blockX);
+			if (fromPitch && toPitch) {
+				TransposeBlock(to + destination.GetOffset(blockY, blockX), toPitch, from + GetOffset(blockX, blockY), fromPitch,
+				               columns, rows, ElementSize);
+				continue;
+			}
+
+			for (size_t row = blockY; row < blockY + rows; ++row) {
+				for (size_t column = blockX; column < blockX + columns; ++column) {
+					memcpy(to + destination.GetOffset(row, column), from + GetOffset(column, row), ElementSize);
+				}
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,592 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/SharedBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BulkMemory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+using namespace VisCore::Streaming;
+
+namespace {
+	#if defined(_WIN32)
+	/**
+	 * \brief Session local object name
+	 */
+	std::string GetObjectName(const char* name) {
+		return std::string("Local\\") + name;
+	}
+	#else
+	/**
+	 * \brief shm_open() name must start with one slash
+	 */
+	std::string GetObjectName(const char* name) {
+		return name[0] == '/' ? std::string(name) : "/" + std::string(name);
+	}
+
+	void CloseHandle(const int handle) noexcept {
+		if (handle >= 0)
+			::close(handle);
+	}
+
+	/**
+	 * \brief Create shared memory object without name
+	 */
+	int CreateAnonymous() {
+		#if defined(__linux__) && defined(MFD_ALLOW_SEALING)
+		if (const auto handle = ::memfd_create("VisCore", MFD_CLOEXEC | MFD_ALLOW_SEALING); handle >= 0)
+			return handle;
+		#endif
+
+		// no memfd, create unique name and drop it at once
+		static std::atomic<uint32_t> counter{0};
+		for (int attempt = 0; attempt < 16; ++attempt) {
+			const auto name = "/VisCore." + std::to_string(::getpid()) + "." + std::to_string(counter++);
+			const auto handle = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+			if (handle >= 0) {
+				::shm_unlink(name.c_str());
+				::fcntl(handle, F_SETFD, FD_CLOEXEC);
+				return handle;
+			}
+			if (errno != EEXIST)
+				break;
+		}
+		return -1;
+	}
+	#endif
+}
+
+SharedBuffer::SharedBuffer() : Stats(BufferType::Shared) {
+}
+
+SharedBuffer::~SharedBuffer() {
+	SharedBuffer::Release();
+}
+
+bool SharedBuffer::Create(const char* name, const size_t size) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Shared::Create", size);
+
+	Release();
+	const auto named = name && *name;
+
+	#if defined(_WIN32)
+	// pagefile backed mapping can not be empty
+	const auto mappingSize = static_cast<uint64_t>(size ? size : 1);
+	const auto handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+	                                       static_cast<DWORD>(mappingSize >> 32), static_cast<DWORD>(mappingSize),
+	                                       named ? GetObjectName(name).c_str() : nullptr);
+	if (!handle)
+		return false;
+
+	if (GetLastError() == ERROR_ALREADY_EXISTS) {
+		::CloseHandle(handle);
+		return false;
+	}
+
+	if (!Map(handle, mappingSize, false))
+		return false;
+
+	Length = size;
+	Stats.Track(Length);
+	return true;
+	#else
+	const auto objectName = named ? GetObjectName(name) : std::string();
+	const auto handle = named ? ::shm_open(objectName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600) : CreateAnonymous();
+	if (handle < 0)
+		return false;
+
+	if (::ftruncate(handle, static_cast<off_t>(size)) != 0) {
+		CloseHandle(handle);
+		if (named)
+			::shm_unlink(objectName.c_str());
+		return false;
+	}
+
+	if (!Map(handle, size, false)) {
+		if (named)
+			::shm_unlink(objectName.c_str());
+		return false;
+	}
+	return true;
+	#endif
+}
+
+bool SharedBuffer::Open(const char* name, const bool readOnly) {
+	VIS_CORE_TRACE_SCOPE("Shared::Open");
+
+	Release();
+	if (!name || !*name)
+		return false;
+
+	#if defined(_WIN32)
+	const auto handle = OpenFileMappingA(readOnly ? FILE_MAP_READ : FILE_MAP_READ | FILE_MAP_WRITE, FALSE,
+	                                     GetObjectName(name).c_str());
+	if (!handle)
+		return false;
+
+	// size of named mapping is not known, whole mapping is viewed
+	return Map(handle, 0, readOnly);
+	#else
+	const auto handle = ::shm_open(GetObjectName(name).c_str(), readOnly ? O_RDONLY : O_RDWR, 0);
+	if (handle < 0)
+		return false;
+
+	struct stat status{};
+	if (::fstat(handle, &status) != 0) {
+		CloseHandle(handle);
+		return false;
+	}
+	::fcntl(handle, F_SETFD, FD_CLOEXEC);
+	return Map(handle, static_cast<size_t>(status.st_size), readOnly);
+	#endif
+}
+
+bool SharedBuffer::Open(const SharedMemoryHandle handle, bool readOnly) {
+	VIS_CORE_TRACE_SCOPE("Shared::Open");
+
+	Release();
+
+	#if defined(_WIN32)
+	HANDLE duplicate = nullptr;
+	if (!handle || !DuplicateHandle(GetCurrentProcess(), handle, GetCurrentProcess(), &duplicate,
+	                                readOnly ? FILE_MAP_READ : 0, FALSE, readOnly ? 0 : DUPLICATE_SAME_ACCESS))
+		return false;
+
+	return Map(duplicate, 0, readOnly);
+	#else
+	if (handle < 0)
+		return false;
+
+	const auto duplicate = ::fcntl(handle, F_DUPFD_CLOEXEC, 0);
+	if (duplicate < 0)
+		return false;
+
+	struct stat status{};
+	if (::fstat(duplicate, &status) != 0) {
+		CloseHandle(duplicate);
+		return false;
+	}
+
+	// descriptor without write access or with write seal can only be mapped read only
+	if ((::fcntl(duplicate, F_GETFL) & O_ACCMODE) == O_RDONLY)
+		readOnly = true;
+	#if defined(F_GET_SEALS)
+	if (const auto seals = ::fcntl(duplicate, F_GET_SEALS); seals > 0 && seals & F_SEAL_WRITE)
+		readOnly = true;
+	#endif
+
+	return Map(duplicate, static_cast<size_t>(status.st_size), readOnly);
+	#endif
+}
+
+bool SharedBuffer::Seal() {
+	VIS_CORE_TRACE_SCOPE_BYTES("Shared::Seal", Length);
+
+	#if defined(F_ADD_SEALS)
+	if (Handle < 0)
+		return false;
+
+	const auto seals = ::fcntl(Handle, F_GET_SEALS);
+	if (seals < 0)
+		return false;
+	if (seals & F_SEAL_WRITE)
+		return ReadOnly;
+
+	// write seal is refused while any writable shared mapping exists, own view included
+	const auto size = Length;
+	Unmap();
+	const auto sealed = ::fcntl(Handle, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == 0;
+
+	const auto handle = std::exchange(Handle, -1);
+	if (!Map(handle, size, sealed)) {
+		Release();
+		return false;
+	}
+	return sealed;
+	#else
+	return false;
+	#endif
+}
+
+char* SharedBuffer::operator*() {
+	// no raw write access to read only mapping, writers fall back to Update()
+	return ReadOnly ? nullptr : Data;
+}
+
+const char* SharedBuffer::operator*() const {
+	return Data;
+}
+
+char& SharedBuffer::operator[](const size_t position) {
+	if (position >= Length)
+		throw out_of_range("Access buffer out of range!!!");
+
+	if (ReadOnly)
+		throw out_of_range("Access read only buffer!!!");
+
+	return Data[position];
+}
+
+IBuffer* SharedBuffer::operator+(char& value) {
+	const auto buffer = new SharedBuffer();
+	buffer->InitBuffer(Length + 1, 0);
+	buffer->Update(0, Length, Data);
+	buffer->Update(Length, 1, &value);
+	return buffer;
+}
+
+IBuffer* SharedBuffer::operator+(IBuffer& buffer) {
+	const auto newBuffer = new SharedBuffer();
+	newBuffer->InitBuffer(Length + buffer.GetLength(), 0);
+	newBuffer->Update(0, Length, Data);
+	newBuffer->Update(Length, buffer.GetLength(), buffer.GetData());
+	return newBuffer;
+}
+
+IBufferPtr SharedBuffer::operator+(IBufferPtr& buffer) {
+	auto newBuffer = CreateBuffer(BufferType::Shared, Length + buffer->GetLength(), 0);
+	newBuffer->Update(0, Length, Data);
+	newBuffer->Update(Length, buffer->GetLength(), buffer->GetData());
+	return newBuffer;
+}
+
+IBuffer* SharedBuffer::operator+=(char& value) {
+	return *this + value;
+}
+
+IBuffer* SharedBuffer::operator+=(IBuffer& buffer) {
+	return *this + buffer;
+}
+
+IBufferPtr SharedBuffer::operator+=(IBufferPtr& buffer) {
+	return *this + buffer;
+}
+
+BufferType SharedBuffer::GetType() {
+	return BufferType::Shared;
+}
+
+void SharedBuffer::InitBuffer(const size_t size, const char initData) {
+	Allocate(size, {});
+	if (initData)
+		BulkFill(Data, initData, size);
+}
+
+void SharedBuffer::InitBuffer(const char* ptr, const size_t size) {
+	Allocate(size, {});
+	if (size)
+		BulkCopy(Data, ptr, size);
+}
+
+void SharedBuffer::InitBuffer(const size_t size, const char initData, const BufferAllocation&) {
+	InitBuffer(size, initData);
+}
+
+void SharedBuffer::InitBuffer(const char* ptr, const size_t size, const BufferAllocation&) {
+	InitBuffer(ptr, size);
+}
+
+void SharedBuffer::Allocate(const size_t size, const BufferAllocation&) {
+	// new shared memory is zero filled by OS
+	if (!Create(nullptr, size))
+		throw bad_alloc();
+}
+
+void SharedBuffer::Release() {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Release", Length);
+
+	Unmap();
+	#if defined(_WIN32)
+	if (Handle)
+		::CloseHandle(Handle);
+	#else
+	CloseHandle(Handle);
+	#endif
+	Handle   = InvalidSharedMemoryHandle;
+	Length   = 0;
+	ReadOnly = false;
+	Position = 0;
+	Stats.Track(0);
+}
+
+bool SharedBuffer::Update(const size_t offset, const size_t size, const char* ptr) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Update", size);
+
+	if (ReadOnly || offset > Length || size > Length - offset)
+		return false;
+
+	if (size)
+		BulkCopy(Data + offset, ptr, size);
+	return true;
+}
+
+bool SharedBuffer::UpdateMany(const UpdateRegion* regions, const size_t count, const size_t threads) {
+	if (ReadOnly)
+		return count == 0;
+
+	return IBuffer::UpdateMany(regions, count, threads);
+}
+
+void SharedBuffer::CopyTo(IBufferPtr buffer, const int length) const {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CopyTo", Length);
+
+	const auto dataSize = Length;
+	if (!Data || dataSize == 0)
+		return;
+
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	const auto copySize = size < buffer->GetLength() ? size : buffer->GetLength();
+	if (!copySize || buffer.get() == this)
+		return;
+
+	if (auto* target = GetDirectWriteData(*buffer))
+		BulkCopy(target, Data, copySize);
+	else
+		buffer->Update(0, copySize, Data);
+}
+
+bool SharedBuffer::Append(const char& data) {
+	// Do nothing
+	return false;
+}
+
+bool SharedBuffer::Append(const char* data, const int length) {
+	// Do nothing
+	return false;
+}
+
+bool SharedBuffer::Insert(const int index, const char* data, const int length) {
+	// Do nothing
+	return false;
+}
+
+void SharedBuffer::Clear(const int length) {
+	if (Data && !ReadOnly)
+		BulkFill(Data, 0, std::min<size_t>(length == -1 ? Length : length, Length));
+}
+
+size_t SharedBuffer::GetLength() const {
+	return Length;
+}
+
+size_t SharedBuffer::GetMemSize() const {
+	return sizeof(SharedBuffer) + Length;
+}
+
+const char* SharedBuffer::GetData() const {
+	return Data;
+}
+
+BufferAllocation SharedBuffer::GetAllocation() const {
+	return {};
+}
+
+IBufferPtr SharedBuffer::CreateBufferCopy(const BufferType type, const int length) const {
+	const auto dataSize = Length;
+	if (!Data || dataSize == 0)
+		return CreateBuffer(type, length == -1 ? 0 : length, 0);
+
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	return CreateBuffer(type, Data, size);
+}
+
+IStreaming* SharedBuffer::GetStreaming() {
+	return this;
+}
+
+size_t SharedBuffer::Tell() const {
+	return Position;
+}
+
+size_t SharedBuffer::Read(IBuffer* buffer, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Shared::Read", length);
+
+	if (IsEof()) {
+		return 0;
+	}
+
+	const auto copySize = std::min({length, Length - Position, buffer->GetLength()});
+	buffer->Update(0, copySize, Data + Position);
+	Position += copySize;
+	return copySize;
+}
+
+size_t SharedBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
+	VIS_CORE_TRACE_SCOPE("Shared::Seek");
+
+	switch (seekMode) {
+		case SeekMode::SeekSet: {
+			if (offset <= Length && offset >= 0) {
+				Position = offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		case SeekMode::SeekCurrent: {
+			if (offset >= 0) {
+				const size_t delta = Position + offset;
+				if (delta > Length) {
+					return -1;
+				}
+
+				Position = delta;
+				return Position;
+			}
+
+			if (-offset > Position) {
+				return -1;
+			}
+
+			Position -= -offset;
+			return Position;
+		}
+		case SeekMode::SeekEnd: {
+			if (offset <= 0 && -offset <= Length) {
+				Position = Length - -offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		default:
+			return -1;
+	}
+}
+
+bool SharedBuffer::IsEof() const {
+	return Position == Length;
+}
+
+void SharedBuffer::Close() {
+	Release();
+}
+
+bool SharedBuffer::Map(const SharedMemoryHandle handle, size_t size, const bool readOnly) {
+	#if defined(_WIN32)
+	auto* view = MapViewOfFile(handle, readOnly ? FILE_MAP_READ : FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, size);
+	if (!view) {
+		::CloseHandle(handle);
+		return false;
+	}
+
+	// opened mapping reports its page rounded size
+	if (size == 0) {
+		MEMORY_BASIC_INFORMATION information{};
+		if (VirtualQuery(view, &information, sizeof(information)))
+			size = information.RegionSize;
+	}
+	Data = static_cast<char*>(view);
+	#else
+	if (size) {
+		auto* view = ::mmap(nullptr, size, readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0);
+		if (view == MAP_FAILED) {
+			CloseHandle(handle);
+			return false;
+		}
+		Data = static_cast<char*>(view);
+	}
+	#endif
+
+	Handle   = handle;
+	Length   = size;
+	ReadOnly = readOnly;
+	Position = 0;
+	Stats.Track(Length);
+	return true;
+}
+
+void SharedBuffer::Unmap() noexcept {
+	if (!Data)
+		return;
+
+	#if defined(_WIN32)
+	UnmapViewOfFile(Data);
+	#else
+	::munmap(Data, Length);
+	#endif
+	Data = nullptr;
+}
+
+IBufferPtr Buffer::CreateSharedBuffer(const char* name, const size_t size) {
+	auto buffer = make_shared<SharedBuffer>();
+	if (!buffer->Create(name, size))
+		return nullptr;
+
+	return buffer;
+}
+
+IBufferPtr Buffer::OpenSharedBuffer(const char* name, const bool readOnly) {
+	auto buffer = make_shared<SharedBuffer>();
+	if (!buffer->Open(name, readOnly))
+		return nullptr;
+
+	return buffer;
+}
+
+IBufferPtr Buffer::OpenSharedBuffer(const SharedMemoryHandle handle, const bool readOnly) {
+	auto buffer = make_shared<SharedBuffer>();
+	if (!buffer->Open(handle, readOnly))
+		return nullptr;
+
+	return buffer;
+}
+
+SharedMemoryHandle Buffer::GetSharedBufferHandle(IBuffer& buffer) {
+	if (buffer.GetType() != BufferType::Shared)
+		return InvalidSharedMemoryHandle;
+
+	return static_cast<SharedBuffer&>(buffer).GetHandle();
+}
+
+bool Buffer::SealSharedBuffer(IBuffer& buffer) {
+	if (buffer.GetType() != BufferType::Shared)
+		return false;
+
+	return static_cast<SharedBuffer&>(buffer).Seal();
+}
+
+bool Buffer::IsSharedBufferReadOnly(IBuffer& buffer) {
+	if (buffer.GetType() != BufferType::Shared)
+		return false;
+
+	return static_cast<SharedBuffer&>(buffer).IsReadOnly();
+}
+
+bool Buffer::RemoveSharedBuffer(const char* name) {
+	if (!name || !*name)
+		return false;
+
+	#if defined(_WIN32)
+	const auto handle = OpenFileMappingA(FILE_MAP_READ, FALSE, GetObjectName(name).c_str());
+	if (!handle)
+		return false;
+
+	::CloseHandle(handle);
+	return true;
+	#else
+	return ::shm_unlink(GetObjectName(name).c_str()) == 0;
+	#endif
+}
@@ -0,0 +1,747 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/SpillBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BulkMemory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+using namespace VisCore::Streaming;
+
+namespace {
+	/**
+	 * \brief Smallest segment, one page of temporary file
+	 */
+	constexpr size_t MinSegmentSize = 4096;
+
+	/**
+	 * \brief First capacity of growing segment
+	 */
+	constexpr size_t MinSegmentCapacity = 64;
+
+	std::mutex& GetDefaultMutex() {
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	SpillOptions& GetDefaultOptions() {
+		static SpillOptions options;
+		return options;
+	}
+}
+
+SpillOptions Buffer::GetDefaultSpillOptions() {
+	lock_guard lock(GetDefaultMutex());
+	return GetDefaultOptions();
+}
+
+void Buffer::SetDefaultSpillOptions(const SpillOptions& options) {
+	lock_guard lock(GetDefaultMutex());
+	GetDefaultOptions() = options;
+}
+
+IBufferPtr Buffer::CreateSpillBuffer(const SpillOptions& options) {
+	return make_shared<SpillBuffer>(options);
+}
+
+SpillBuffer::SpillBuffer() : SpillBuffer(GetDefaultSpillOptions()) {
+}
+
+SpillBuffer::SpillBuffer(const SpillOptions& options)
+	: Options(options), ResidentBytes(0), Tick(0), Cursor(0), SlotCount(0), Length(0), Stats(BufferType::Spill),
+	  Position(0) {
+	Options.SegmentSize = std::max(Options.SegmentSize, MinSegmentSize);
+}
+
+SpillBuffer::~SpillBuffer() {
+	SpillBuffer::Release();
+}
+
+char* SpillBuffer::operator*() {
+	return Flatten();
+}
+
+const char* SpillBuffer::operator*() const {
+	return Flatten();
+}
+
+char& SpillBuffer::operator[](const size_t position) {
+	if (position >= Length)
+		throw out_of_range("Access buffer out of range!!!");
+
+	auto& segment = *Segments[Find(position)];
+	auto* data    = Load(segment);
+	segment.Dirty = true;
+	Balance(&segment);
+	return data[position - segment.Offset];
+}
+
+IBuffer* SpillBuffer::operator+(char& value) {
+	Append(value);
+	return this;
+}
+
+IBuffer* SpillBuffer::operator+(IBuffer& buffer) {
+	if (&buffer == this) {
+		const auto copy = CreateBufferCopy(BufferType::Spill);
+		return *this + *copy;
+	}
+
+	if (buffer.GetType() == BufferType::Spill) {
+		// copy other spill buffer segment by segment, its data is never merged
+		const auto& other = static_cast<const SpillBuffer&>(buffer);
+		vector<char> chunk(std::min(other.Length, other.Options.SegmentSize));
+		for (size_t position = 0; position < other.Length; position += chunk.size()) {
+			const auto count = std::min(chunk.size(), other.Length - position);
+			other.ReadRange(position, chunk.data(), count);
+			Grow(chunk.data(), count, 0);
+		}
+		return this;
+	}
+
+	Grow(buffer.GetData(), buffer.GetLength(), 0);
+	return this;
+}
+
+IBufferPtr SpillBuffer::operator+(IBufferPtr& buffer) {
+	auto newBuffer = CreateBuffer(BufferType::Constraint, Length + buffer->GetLength(), 0);
+	ReadRange(0, **newBuffer, Length);
+	newBuffer->Update(Length, buffer->GetLength(), buffer->GetData());
+	return newBuffer;
+}
+
+IBuffer* SpillBuffer::operator+=(char& value) {
+	return *this + value;
+}
+
+IBuffer* SpillBuffer::operator+=(IBuffer& buffer) {
+	return *this + buffer;
+}
+
+IBufferPtr SpillBuffer::operator+=(IBufferPtr& buffer) {
+	return *this + buffer;
+}
+
+BufferType SpillBuffer::GetType() {
+	return BufferType::Spill;
+}
+
+void SpillBuffer::InitBuffer(const size_t size, const char initData) {
+	Release();
+	Grow(nullptr, size, initData);
+}
+
+void SpillBuffer::InitBuffer(const char* ptr, const size_t size) {
+	Release();
+	Grow(ptr, size, 0);
+}
+
+void SpillBuffer::InitBuffer(const size_t size, const char initData, const BufferAllocation& allocation) {
+	Release();
+	Allocation = allocation;
+	Grow(nullptr, size, initData);
+}
+
+void SpillBuffer::InitBuffer(const char* ptr, const size_t size, const BufferAllocation& allocation) {
+	Release();
+	Allocation = allocation;
+	Grow(ptr, size, 0);
+}
+
+void SpillBuffer::Allocate(const size_t size, const BufferAllocation& allocation) {
+	Release();
+	Allocation = allocation;
+	if (size == 0)
+		return;
+
+	// full segments left uninitialized, those past memory limit are spilled as Grow() does
+	while (Length < size) {
+		auto segment    = make_unique<Segment>();
+		segment->Offset = Length;
+		segment->Length = std::min(Options.SegmentSize, size - Length);
+		Segments.push_back(std::move(segment));
+
+		auto& last = *Segments.back();
+		Load(last, false);
+		Length += last.Length;
+		Balance(&last);
+	}
+}
+
+void SpillBuffer::Release() {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Release", ResidentBytes);
+
+	Reset();
+	Length   = 0;
+	Position = 0;
+	Stats.Track(0);
+}
+
+bool SpillBuffer::Update(const size_t offset, const size_t size, const char* ptr) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Update", size);
+
+	if (size && !ptr)
+		return false;
+
+	// gap after current end is zero filled, same as dynamic buffer
+	if (offset > Length)
+		Grow(nullptr, offset - Length, 0);
+
+	const auto inside = std::min(size, Length - offset);
+	WriteRange(offset, ptr, inside);
+	if (size > inside)
+		Grow(ptr + inside, size - inside, 0);
+	return true;
+}
+
+bool SpillBuffer::UpdateMany(const UpdateRegion* regions, const size_t count, const size_t) {
+	if (count == 0)
+		return true;
+
+	if (!regions)
+		return false;
+
+	for (size_t index = 0; index < count; ++index) {
+		if (regions[index].Size && !regions[index].Ptr)
+			return false;
+	}
+
+	for (size_t index = 0; index < count; ++index) {
+		const auto& region = regions[index];
+		if (region.Size)
+			Update(region.Offset, region.Size, region.Ptr);
+	}
+	return true;
+}
+
+void SpillBuffer::CopyTo(IBufferPtr buffer, const int length) const {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CopyTo", Length);
+
+	const auto dataSize = Length;
+	if (dataSize == 0 || buffer.get() == this)
+		return;
+
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	const auto copySize = size < buffer->GetLength() ? size : buffer->GetLength();
+	if (copySize)
+		CopyRange(0, *buffer, copySize);
+}
+
+bool SpillBuffer::Append(const char& data) {
+	Grow(&data, 1, 0);
+	return true;
+}
+
+bool SpillBuffer::Append(const char* data, const int length) {
+	if (length < 0)
+		return false;
+
+	Grow(data, length, 0);
+	return true;
+}
+
+bool SpillBuffer::Insert(const int index, const char* data, const int length) {
+	if (index < 0 || length < 0 || static_cast<size_t>(index) > Length)
+		return false;
+
+	if (length == 0)
+		return true;
+
+	if (static_cast<size_t>(index) == Length) {
+		Grow(data, length, 0);
+		return true;
+	}
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Spill::Insert", length);
+
+	auto  segmentIndex = Find(index);
+	auto* segment      = Segments[segmentIndex].get();
+	auto  local        = index - segment->Offset;
+
+	// insert at segment start extends previous segment
+	if (local == 0 && segmentIndex > 0) {
+		segment = Segments[--segmentIndex].get();
+		local   = segment->Length;
+	}
+
+	const size_t size = length;
+	if (segment->Length + size <= std::max(Options.SegmentSize, segment->Capacity)) {
+		Load(*segment);
+		Reserve(*segment, segment->Length + size);
+		memmove(segment->Data + local + size, segment->Data + local, segment->Length - local);
+		memcpy(segment->Data + local, data, size);
+		segment->Length += size;
+		segment->Dirty = true;
+	} else {
+		// split segment, inserted data and suffix become new resident segments
+		auto makeSegment = [this](const char* source, const size_t bytes) {
+			auto result      = make_unique<Segment>();
+			result->Data     = AllocateMemory(bytes, Allocation);
+			result->Length   = bytes;
+			result->Capacity = bytes;
+			result->Dirty    = true;
+			result->LastUse  = ++Tick;
+			memcpy(result->Data, source, bytes);
+			Resident.push_back(result.get());
+			ResidentBytes += bytes;
+			return result;
+		};
+
+		vector<unique_ptr<Segment>> added;
+		for (size_t done = 0; done < size; done += Options.SegmentSize) {
+			added.push_back(makeSegment(data + done, std::min(Options.SegmentSize, size - done)));
+		}
+
+		if (local == 0) {
+			// first segment of buffer, data goes in front of it
+			Segments.insert(Segments.begin() + segmentIndex, make_move_iterator(added.begin()),
+			                make_move_iterator(added.end()));
+		} else {
+			if (local < segment->Length) {
+				Load(*segment);
+				added.push_back(makeSegment(segment->Data + local, segment->Length - local));
+				segment->Length = local;
+				segment->Dirty  = true;
+			}
+			Segments.insert(Segments.begin() + segmentIndex + 1, make_move_iterator(added.begin()),
+			                make_move_iterator(added.end()));
+		}
+	}
+
+	// later segments move back by inserted size
+	auto offset = Segments[segmentIndex]->Offset;
+	for (auto next = segmentIndex; next < Segments.size(); ++next) {
+		Segments[next]->Offset = offset;
+		offset += Segments[next]->Length;
+	}
+
+	Length += size;
+	Cursor = segmentIndex;
+	Balance(nullptr);
+	return true;
+}
+
+void SpillBuffer::Clear(const int length) {
+	WriteRange(0, nullptr, std::min<size_t>(length == -1 ? Length : length, Length));
+}
+
+size_t SpillBuffer::GetLength() const {
+	return Length;
+}
+
+size_t SpillBuffer::GetMemSize() const {
+	return sizeof(SpillBuffer) + ResidentBytes;
+}
+
+const char* SpillBuffer::GetData() const {
+	return Flatten();
+}
+
+BufferAllocation SpillBuffer::GetAllocation() const {
+	return Allocation;
+}
+
+IBufferPtr SpillBuffer::CreateBufferCopy(const BufferType type, const int length) const {
+	const auto dataSize = Length;
+	if (dataSize == 0)
+		return CreateBuffer(type, length == -1 ? 0 : length, 0);
+
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	if (type == BufferType::Spill) {
+		// copy spills while it grows, never needs whole data in memory
+		auto copy        = make_shared<SpillBuffer>(Options);
+		copy->Allocation = Allocation;
+
+		vector<char> chunk(std::min(size, Options.SegmentSize));
+		for (size_t position = 0; position < size; position += chunk.size()) {
+			const auto count = std::min(chunk.size(), size - position);
+			ReadRange(position, chunk.data(), count);
+			copy->Grow(chunk.data(), count, 0);
+		}
+		return copy;
+	}
+
+	auto copy = CreateUninitializedBuffer(type, size, Allocation);
+	if (copy)
+		ReadRange(0, **copy, size);
+	return copy;
+}
+
+IStreaming* SpillBuffer::GetStreaming() {
+	return this;
+}
+
+size_t SpillBuffer::GetSpilledSize() const {
+	size_t size = 0;
+	for (const auto& segment : Segments) {
+		if (!segment->Data)
+			size += segment->Length;
+	}
+	return size;
+}
+
+size_t SpillBuffer::Tell() const {
+	return Position;
+}
+
+size_t SpillBuffer::Read(IBuffer* buffer, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Spill::Read", length);
+
+	if (IsEof()) {
+		return 0;
+	}
+
+	const auto copySize = std::min({length, Length - Position, buffer->GetLength()});
+	if (copySize)
+		CopyRange(Position, *buffer, copySize);
+	Position += copySize;
+	return copySize;
+}
+
+size_t SpillBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
+	VIS_CORE_TRACE_SCOPE("Spill::Seek");
+
+	switch (seekMode) {
+		case SeekMode::SeekSet: {
+			if (offset <= Length && offset >= 0) {
+				Position = offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		case SeekMode::SeekCurrent: {
+			if (offset >= 0) {
+				const size_t delta = Position + offset;
+				if (delta > Length) {
+					return -1;
+				}
+
+				Position = delta;
+				return Position;
+			}
+
+			if (-offset > Position) {
+				return -1;
+			}
+
+			Position -= -offset;
+			return Position;
+		}
+		case SeekMode::SeekEnd: {
+			if (offset <= 0 && -offset <= Length) {
+				Position = Length - -offset;
+				return Position;
+			}
+
+			return -1;
+		}
+		default:
+			return -1;
+	}
+}
+
+bool SpillBuffer::IsEof() const {
+	return Position == Length;
+}
+
+void SpillBuffer::Close() {
+	Release();
+}
+
+size_t SpillBuffer::Find(const size_t position) const {
+	// sequential access hits cursor or its next segment, unsigned difference rejects positions before offset
+	if (Cursor < Segments.size()) {
+		if (const auto& segment = *Segments[Cursor]; position - segment.Offset < segment.Length)
+			return Cursor;
+
+		if (Cursor + 1 < Segments.size()) {
+			if (const auto& next = *Segments[Cursor + 1]; position - next.Offset < next.Length)
+				return ++Cursor;
+		}
+	}
+
+	const auto found = upper_bound(Segments.begin(), Segments.end(), position,
+	                               [](const size_t value, const unique_ptr<Segment>& segment) {
+		                               return value < segment->Offset;
+	                               });
+	Cursor = found - Segments.begin() - 1;
+	return Cursor;
+}
+
+char* SpillBuffer::Load(Segment& segment, const bool read) const {
+	segment.LastUse = ++Tick;
+	if (segment.Data || segment.Length == 0)
+		return segment.Data;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Spill::Load", segment.Length);
+
+	auto* data = AllocateMemory(segment.Length, Allocation);
+	if (read &&
+	    SpillFile.ReadAt(static_cast<uint64_t>(segment.Slot) * Options.SegmentSize, data, segment.Length) != segment.Length) {
+		FreeMemory(data, Allocation);
+		throw runtime_error("Read spilled segment failed!!!");
+	}
+
+	segment.Data     = data;
+	segment.Capacity = segment.Length;
+	segment.Dirty    = !read;
+	Resident.push_back(&segment);
+	ResidentBytes += segment.Capacity;
+	return data;
+}
+
+void SpillBuffer::Reserve(Segment& segment, const size_t capacity) const {
+	if (capacity <= segment.Capacity)
+		return;
+
+	const auto grown = std::max(capacity, std::min(std::max(segment.Capacity * 2, MinSegmentCapacity), Options.SegmentSize));
+	if (segment.Data) {
+		segment.Data = ReallocateMemory(segment.Data, segment.Length, grown, Allocation);
+	} else {
+		segment.Data = AllocateMemory(grown, Allocation);
+		Resident.push_back(&segment);
+	}
+
+	ResidentBytes += grown - segment.Capacity;
+	segment.Capacity = grown;
+}
+
+bool SpillBuffer::Spill(Segment& segment) const {
+	if (!SpillFile.IsOpen() && !SpillFile.OpenTemporary(Options.Directory.c_str()))
+		return false;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Spill::Write", segment.Length);
+
+	const auto slotSize = Options.SegmentSize;
+	if (segment.Length > slotSize) {
+		// merged or allocated segment is written as slot sized pieces
+		vector<unique_ptr<Segment>> pieces;
+		for (size_t done = 0; done < segment.Length; done += slotSize) {
+			auto piece     = make_unique<Segment>();
+			piece->Offset  = segment.Offset + done;
+			piece->Length  = std::min(slotSize, segment.Length - done);
+			piece->Slot    = AllocateSlot();
+			piece->LastUse = segment.LastUse;
+			const auto written = SpillFile.WriteAt(static_cast<uint64_t>(piece->Slot) * slotSize, segment.Data + done,
+			                                       piece->Length);
+			pieces.push_back(std::move(piece));
+
+			if (written != pieces.back()->Length) {
+				for (const auto& failed : pieces) {
+					FreeSlots.push_back(failed->Slot);
+				}
+				return false;
+			}
+		}
+
+		if (segment.Slot != static_cast<size_t>(-1))
+			FreeSlots.push_back(segment.Slot);
+
+		const auto index = Find(segment.Offset);
+		Unload(segment);
+		Segments.erase(Segments.begin() + index);
+		Segments.insert(Segments.begin() + index, make_move_iterator(pieces.begin()), make_move_iterator(pieces.end()));
+		Cursor = index;
+		return true;
+	}
+
+	if (segment.Dirty || segment.Slot == static_cast<size_t>(-1)) {
+		if (segment.Slot == static_cast<size_t>(-1))
+			segment.Slot = AllocateSlot();
+
+		if (SpillFile.WriteAt(static_cast<uint64_t>(segment.Slot) * slotSize, segment.Data, segment.Length) != segment.Length)
+			return false;
+	}
+
+	Unload(segment);
+	return true;
+}
+
+void SpillBuffer::Unload(Segment& segment) const {
+	if (!segment.Data)
+		return;
+
+	Resident.erase(find(Resident.begin(), Resident.end(), &segment));
+	ResidentBytes -= segment.Capacity;
+	FreeMemory(segment.Data, Allocation);
+	segment.Data     = nullptr;
+	segment.Capacity = 0;
+	segment.Dirty    = false;
+}
+
+size_t SpillBuffer::AllocateSlot() const {
+	if (FreeSlots.empty())
+		return SlotCount++;
+
+	const auto slot = FreeSlots.back();
+	FreeSlots.pop_back();
+	return slot;
+}
+
+void SpillBuffer::Balance(const Segment* keep) const {
+	while (ResidentBytes > Options.MemoryLimit) {
+		Segment* victim = nullptr;
+		for (auto* segment : Resident) {
+			if (segment != keep && (!victim || segment->LastUse < victim->LastUse))
+				victim = segment;
+		}
+
+		// data stays in memory if temporary file is not usable
+		if (!victim || !Spill(*victim))
+			break;
+	}
+
+	Stats.Track(ResidentBytes);
+}
+
+void SpillBuffer::ReadRange(size_t position, char* data, size_t size) const {
+	while (size) {
+		const auto& segment = *Segments[Find(position)];
+		const auto  local   = position - segment.Offset;
+		const auto  count   = std::min(size, segment.Length - local);
+
+		if (segment.Data) {
+			BulkCopy(data, segment.Data + local, count);
+		} else if (SpillFile.ReadAt(static_cast<uint64_t>(segment.Slot) * Options.SegmentSize + local, data, count) != count) {
+			throw runtime_error("Read spilled segment failed!!!");
+		}
+
+		position += count;
+		data += count;
+		size -= count;
+	}
+}
+
+void SpillBuffer::CopyRange(const size_t position, IBuffer& buffer, const size_t size) const {
+	if (auto* target = GetDirectWriteData(buffer)) {
+		ReadRange(position, target, size);
+		return;
+	}
+
+	// other types keep their write path, each segment part goes through Update()
+	vector<char> chunk;
+	for (size_t done = 0; done < size;) {
+		const auto& segment = *Segments[Find(position + done)];
+		const auto  local   = position + done - segment.Offset;
+		const auto  count   = std::min(size - done, segment.Length - local);
+
+		if (segment.Data) {
+			buffer.Update(done, count, segment.Data + local);
+		} else {
+			chunk.resize(count);
+			ReadRange(position + done, chunk.data(), count);
+			buffer.Update(done, count, chunk.data());
+		}
+		done += count;
+	}
+}
+
+void SpillBuffer::WriteRange(size_t position, const char* data, size_t size) {
+	while (size) {
+		auto&      segment = *Segments[Find(position)];
+		const auto local   = position - segment.Offset;
+		const auto count   = std::min(size, segment.Length - local);
+
+		// segment overwritten as a whole is not read back
+		auto* target = Load(segment, count < segment.Length);
+		if (data) {
+			memcpy(target + local, data, count);
+			data += count;
+		} else {
+			memset(target + local, 0, count);
+		}
+		segment.Dirty = true;
+		Balance(&segment);
+
+		position += count;
+		size -= count;
+	}
+}
+
+void SpillBuffer::Grow(const char* data, size_t size, const char fill) {
+	while (size) {
+		auto* segment = Segments.empty() ? nullptr : Segments.back().get();
+		if (!segment || segment->Length >= Options.SegmentSize) {
+			Segments.push_back(make_unique<Segment>());
+			segment         = Segments.back().get();
+			segment->Offset = Length;
+		}
+
+		Load(*segment);
+		const auto count = std::min(size, Options.SegmentSize - segment->Length);
+		Reserve(*segment, segment->Length + count);
+		if (data) {
+			memcpy(segment->Data + segment->Length, data, count);
+			data += count;
+		} else {
+			memset(segment->Data + segment->Length, fill, count);
+		}
+
+		segment->Length += count;
+		segment->Dirty = true;
+		Length += count;
+		size -= count;
+		Balance(segment);
+	}
+}
+
+char* SpillBuffer::Flatten() const {
+	if (Segments.empty())
+		return nullptr;
+
+	if (Segments.size() == 1) {
+		auto& segment = *Segments.front();
+		auto* data    = Load(segment);
+		segment.Dirty = true;
+		return data;
+	}
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Spill::Flatten", Length);
+
+	auto* data = AllocateMemory(Length, Allocation);
+	try {
+		ReadRange(0, data, Length);
+	} catch (...) {
+		FreeMemory(data, Allocation);
+		throw;
+	}
+
+	// single segment replaces everything, temporary file is dropped
+	Reset();
+	auto segment      = make_unique<Segment>();
+	segment->Data     = data;
+	segment->Length   = Length;
+	segment->Capacity = Length;
+	segment->Dirty    = true;
+	segment->LastUse  = ++Tick;
+	Resident.push_back(segment.get());
+	Segments.push_back(std::move(segment));
+
+	ResidentBytes = Length;
+	Stats.Track(ResidentBytes);
+	return data;
+}
+
+void SpillBuffer::Reset() const {
+	for (auto* segment : Resident) {
+		FreeMemory(segment->Data, Allocation);
+	}
+
+	Segments.clear();
+	Resident.clear();
+	FreeSlots.clear();
+	ResidentBytes = 0;
+	SlotCount     = 0;
+	Cursor        = 0;
+	SpillFile.Close();
+}
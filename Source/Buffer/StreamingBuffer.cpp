@@ -3,35 +3,34 @@
  * */
 
 #include "Buffer/StreamingBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "Buffer/BulkMemory.h"
+#include "Trace/Trace.h"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 using namespace std;
 using namespace VisCore::Buffer;
 using namespace VisCore::Streaming;
 
-StreamingBuffer::StreamingBuffer() : Data(nullptr), Size(0), Position(0) {
+StreamingBuffer::StreamingBuffer() : Position(0) {
 }
 
 StreamingBuffer::~StreamingBuffer() {
 	StreamingBuffer::Release();
 }
 
-StreamingBuffer::StreamingBuffer(StreamingBuffer&& other) noexcept {
+StreamingBuffer::StreamingBuffer(StreamingBuffer&& other) noexcept
+	: Core(std::move(other.Core)), Stats(std::move(other.Stats)), Position(other.Position) {
 	// take buffer from other
-	Size = other.Size;
-	Data = other.Data;
-	Position = other.Position;
-
-	other.Size = 0;
-	other.Data = nullptr;
+	other.Position = 0;
 }
 
-StreamingBuffer::StreamingBuffer(const StreamingBuffer& other) noexcept {
-	// share buffer by shared_ptr
-	Size = other.Size;
-	Data = other.Data;
-	Position = other.Position;
+StreamingBuffer::StreamingBuffer(const StreamingBuffer& other) noexcept
+	: Core(other.Core), Stats(other.Stats), Position(other.Position) {
+	// share buffer and its accounting by shared storage
 }
 
 const StreamingBuffer& StreamingBuffer::operator=(StreamingBuffer&& other) noexcept {
@@ -39,16 +38,12 @@ const StreamingBuffer& StreamingBuffer::operator=(StreamingBuffer&& other) noexc
 	if (&other == this)
 		return *this;
 
-	// Release any resource we're holding
-	Release();
-
 	// take buffer from other
-	Size = other.Size;
-	Data = other.Data;
+	Core     = std::move(other.Core);
+	Stats    = std::move(other.Stats);
 	Position = other.Position;
 
-	other.Size = 0;
-	other.Data.reset();
+	other.Position = 0;
 
 	return *this;
 }
@@ -58,51 +53,46 @@ const StreamingBuffer& StreamingBuffer::operator=(const StreamingBuffer& other)
 	if (&other == this)
 		return *this;
 
-	// Release any resource we're holding
-	Release();
-
-	// Copy the resource
-	Size = other.Size;
-	Data = other.Data;
+	// Share the resource
+	Core     = other.Core;
+	Stats    = other.Stats;
 	Position = other.Position;
 
 	return *this;
 }
 
 char* StreamingBuffer::operator*() {
-	return Data.get();
+	return Core.GetData();
 }
 
 const char* StreamingBuffer::operator*() const {
-	return Data.get();
+	return Core.GetData();
 }
 
 char& StreamingBuffer::operator[](const size_t position) {
-	if (position > Size) {
-		throw std::out_of_range("Access constraint buffer out of range!!!");
-	}
-
-	return Data[position];
+	return Core.At(position);
 }
 
 IBuffer* StreamingBuffer::operator+(char& value) {
 	const auto buffer = new StreamingBuffer();
-	buffer->InitBuffer(Data.get(), Size + 1);
-	(*buffer)[Size] = value;
+	buffer->InitBuffer(Core.GetLength() + 1, 0);
+	buffer->Update(0, Core.GetLength(), Core.GetData());
+	buffer->Update(Core.GetLength(), 1, &value);
 	return buffer;
 }
 
 IBuffer* StreamingBuffer::operator+(IBuffer& buffer) {
 	const auto newBuffer = new StreamingBuffer();
-	memcpy(**newBuffer, Data.get(), Size);
-	memcpy(**newBuffer + Size, buffer.GetData(), buffer.GetLength());
+	newBuffer->InitBuffer(Core.GetLength() + buffer.GetLength(), 0);
+	newBuffer->Update(0, Core.GetLength(), Core.GetData());
+	newBuffer->Update(Core.GetLength(), buffer.GetLength(), buffer.GetData());
 	return newBuffer;
 }
 
 IBufferPtr StreamingBuffer::operator+(IBufferPtr& buffer) {
-	auto newBuffer = CreateBuffer(BufferType::Constraint, Size + buffer->GetLength(), 0);
-	memcpy(**newBuffer, Data.get(), Size);
-	memcpy(**newBuffer + Size, buffer->GetData(), buffer->GetLength());
+	auto newBuffer = CreateBuffer(BufferType::Constraint, Core.GetLength() + buffer->GetLength(), 0);
+	newBuffer->Update(0, Core.GetLength(), Core.GetData());
+	newBuffer->Update(Core.GetLength(), buffer->GetLength(), buffer->GetData());
 	return newBuffer;
 }
 
@@ -119,50 +109,90 @@ IBufferPtr StreamingBuffer::operator+=(IBufferPtr& buffer) {
 }
 
 BufferType StreamingBuffer::GetType() {
-	return BufferType::Constraint;
+	return BufferType::Streaming;
 }
 
 void StreamingBuffer::InitBuffer(const size_t size, const char initData) {
-	// Release any resource we're holding
-	Release();
-
-	// init buffer
-	Size = size;
-	Data = std::shared_ptr<char[]>(new char[Size + 1]);
-	memset(Data.get(), initData, Size);
-	Data[Size] = '\0';
+	Core.Allocate(size);
+	BulkFill(Core.GetData(), initData, size);
+	Track(Core.GetCapacity());
+	Position = 0;
 }
 
 void StreamingBuffer::InitBuffer(const char* ptr, const size_t size) {
-	// Release any resource we're holding
-	Release();
+	Core.Allocate(size);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Track(Core.GetCapacity());
+	Position = 0;
+}
+
+void StreamingBuffer::InitBuffer(const size_t size, const char initData, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	BulkFill(Core.GetData(), initData, size);
+	Track(Core.GetCapacity());
+	Position = 0;
+}
+
+void StreamingBuffer::InitBuffer(const char* ptr, const size_t size, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	if (size)
+		BulkCopy(Core.GetData(), ptr, size);
+	Track(Core.GetCapacity());
+	Position = 0;
+}
 
-	// init buffer
-	Size = size;
-	Data = std::shared_ptr<char[]>(new char[Size + 1]);
-	memcpy(Data.get(), ptr, Size);
-	Data[Size] = '\0';
+void StreamingBuffer::Allocate(const size_t size, const BufferAllocation& allocation) {
+	Core.Allocate(size, allocation);
+	Track(Core.GetCapacity());
+	Position = 0;
 }
 
 void StreamingBuffer::Release() {
-	Data.reset();
-	Size = 0;
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Release", Core.GetCapacity());
+
+	Core.Release();
+	Track(0);
+	Position = 0;
+}
+
+void StreamingBuffer::Track(const size_t bytes) {
+	// old storage is still held by copies, leave its accounting to them
+	if (!Stats || Stats.use_count() > 1) {
+		Stats.reset();
+		if (bytes == 0)
+			return;
+
+		Stats = make_shared<BufferStatsTracker>(BufferType::Streaming);
+	}
+	Stats->Track(bytes);
 }
 
 bool StreamingBuffer::Update(const size_t offset, const size_t size, const char* ptr) {
-	if (!Data || offset + size > Size)
-		return false;
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Update", size);
 
-	memcpy(Data.get() + offset, ptr, size);
-	return true;
+	return Core.Update(offset, size, ptr);
 }
 
 void StreamingBuffer::CopyTo(IBufferPtr buffer, const int length) const {
-	if (!Data || Size == 0)
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::CopyTo", Core.GetLength());
+
+	const auto dataSize = Core.GetLength();
+	if (!Core.GetData() || dataSize == 0)
+		return;
+
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	const auto copySize = size < buffer->GetLength() ? size : buffer->GetLength();
+	if (!copySize)
 		return;
 
-	const auto size = length == -1 || length > Size ? Size : length;
-	buffer->Update(0, size < buffer->GetLength() ? size : buffer->GetLength(), Data.get());
+	// plain destination is bulk copied, other types keep their own write path
+	if (auto* target = GetDirectWriteData(*buffer)) {
+		if (target != Core.GetData())
+			BulkCopy(target, Core.GetData(), copySize);
+	} else {
+		buffer->Update(0, copySize, Core.GetData());
+	}
 }
 
 bool StreamingBuffer::Append(const char& data) {
@@ -181,31 +211,33 @@ bool StreamingBuffer::Insert(const int index, const char* data, const int length
 }
 
 void StreamingBuffer::Clear(const int length) {
-	if (!Data || Size == 0)
-		return;
-
-	const auto clearSize = length == -1 || length > Size ? Size : length;
-	memset(Data.get(), 0, clearSize);
+	if (Core.GetData())
+		BulkFill(Core.GetData(), 0, std::min<size_t>(length == -1 ? Core.GetLength() : length, Core.GetLength()));
 }
 
 size_t StreamingBuffer::GetLength() const {
-	return Size;
+	return Core.GetLength();
 }
 
 size_t StreamingBuffer::GetMemSize() const {
-	return sizeof(StreamingBuffer) + Size + 1;
+	return sizeof(StreamingBuffer) + Core.GetCapacity();
 }
 
 const char* StreamingBuffer::GetData() const {
-	return Data.get();
+	return Core.GetData();
+}
+
+BufferAllocation StreamingBuffer::GetAllocation() const {
+	return Core.GetAllocation();
 }
 
 IBufferPtr StreamingBuffer::CreateBufferCopy(const BufferType type, const int length) const {
-	if (!Data || Size == 0)
+	const auto dataSize = Core.GetLength();
+	if (!Core.GetData() || dataSize == 0)
 		return CreateBuffer(type, length, 0);
 
-	const auto size = length == -1 || length > Size ? Size : length;
-	return CreateBuffer(type, Data.get(), size);
+	const auto size = length == -1 || length > dataSize ? dataSize : length;
+	return CreateBuffer(type, Core.GetData(), size, Core.GetAllocation());
 }
 
 IStreaming* StreamingBuffer::GetStreaming() {
@@ -217,28 +249,32 @@ size_t StreamingBuffer::Tell() const {
 }
 
 size_t StreamingBuffer::Read(IBuffer* buffer, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::Read", length);
+
 	if (IsEof()) {
 		return 0;
 	}
 
-	if (const size_t nextPosition = Position + length; nextPosition < Size) {
+	if (const size_t nextPosition = Position + length; nextPosition < Core.GetLength()) {
 		const size_t copySize = buffer->GetLength() < length ? buffer->GetLength() : length;
-		buffer->Update(0, copySize, Data.get() + Position);
+		buffer->Update(0, copySize, Core.GetData() + Position);
 		Position += copySize;
 		return copySize;
 	}
 
-	const size_t delta = Size - Position;
+	const size_t delta = Core.GetLength() - Position;
 	const size_t copySize = buffer->GetLength() < delta ? buffer->GetLength() : delta;
-	buffer->Update(0, copySize, Data.get() + Position);
+	buffer->Update(0, copySize, Core.GetData() + Position);
 	Position += copySize;
 	return delta;
 }
 
 size_t StreamingBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
+	VIS_CORE_TRACE_SCOPE("Streaming::Seek");
+
 	switch (seekMode) {
 		case SeekMode::SeekSet: {
-			if (offset <= Size && offset >= 0) {
+			if (offset <= Core.GetLength() && offset >= 0) {
 				Position = offset;
 				return Position;
 			}
@@ -248,7 +284,7 @@ size_t StreamingBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
 		case SeekMode::SeekCurrent: {
 			if (offset >= 0) {
 				const size_t delta = Position + offset;
-				if (delta > Size) {
+				if (delta > Core.GetLength()) {
 					return -1;
 				}
 
@@ -264,8 +300,8 @@ size_t StreamingBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
 			return Position;
 		}
 		case SeekMode::SeekEnd: {
-			if (offset <= 0 && -offset <= Size) {
-				Position = Size - -offset;
+			if (offset <= 0 && -offset <= Core.GetLength()) {
+				Position = Core.GetLength() - -offset;
 				return Position;
 			}
 
@@ -277,7 +313,7 @@ size_t StreamingBuffer::Seek(const int64_t offset, const SeekMode seekMode) {
 }
 
 bool StreamingBuffer::IsEof() const {
-	return Position == Size;
+	return Position == Core.GetLength();
 }
 
 void StreamingBuffer::Close() {
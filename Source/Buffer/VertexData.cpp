@@ -0,0 +1,368 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Buffer/VertexData.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIS_CORE_VERTEX_SSE2 1
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Buffer;
+
+namespace {
+	/**
+	 * \brief Records handled per stream before moving to next stream, keeps block in L1
+	 */
+	constexpr size_t BlockBytes = 16 * 1024;
+
+	template<typename Stream>
+	bool CheckStreams(const size_t stride, const Stream* streams, const size_t streamCount) {
+		for (size_t index = 0; index < streamCount; ++index) {
+			const auto& stream = streams[index];
+			if (stream.Offset > stride || stream.Size > stride - stream.Offset || (stream.Size && !stream.Data))
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Copy count elements of Size bytes, fixed size lets memcpy become plain moves
+	 */
+	template<size_t Size>
+	void CopyStrided(char* destination, const size_t destinationStride, const char* source, const size_t sourceStride,
+	                 const size_t count) {
+		for (size_t index = 0; index < count; ++index) {
+			memcpy(destination + index * destinationStride, source + index * sourceStride, Size);
+		}
+	}
+
+	void CopyStrided(char* destination, const size_t destinationStride, const char* source, const size_t sourceStride,
+	                 const size_t count, const size_t size) {
+		switch (size) {
+			case 0:
+				return;
+			case 1:
+				return CopyStrided<1>(destination, destinationStride, source, sourceStride, count);
+			case 2:
+				return CopyStrided<2>(destination, destinationStride, source, sourceStride, count);
+			case 4:
+				return CopyStrided<4>(destination, destinationStride, source, sourceStride, count);
+			case 8:
+				return CopyStrided<8>(destination, destinationStride, source, sourceStride, count);
+			case 12:
+				return CopyStrided<12>(destination, destinationStride, source, sourceStride, count);
+			case 16:
+				return CopyStrided<16>(destination, destinationStride, source, sourceStride, count);
+			default:
+				for (size_t index = 0; index < count; ++index) {
+					memcpy(destination + index * destinationStride, source + index * sourceStride, size);
+				}
+		}
+	}
+
+	/**
+	 * \brief Get component streams in offset order when record is 2 to 4 packed 4 byte components
+	 * \return component count, 0 if layout does not match
+	 */
+	template<typename Stream>
+	size_t MatchComponents(const size_t stride, const Stream* streams, const size_t streamCount, const Stream** ordered) {
+		if (stride % 4 || stride / 4 != streamCount || streamCount < 2 || streamCount > 4)
+			return 0;
+
+		for (size_t index = 0; index < streamCount; ++index) {
+			ordered[index] = nullptr;
+		}
+		for (size_t index = 0; index < streamCount; ++index) {
+			const auto& stream = streams[index];
+			if (stream.Size != 4 || stream.Offset % 4 || ordered[stream.Offset / 4])
+				return 0;
+			ordered[stream.Offset / 4] = &stream;
+		}
+		return streamCount;
+	}
+
+	#if defined(VIS_CORE_VERTEX_SSE2)
+	/**
+	 * \brief Transpose 4 records per step
+	 * \return records done
+	 */
+	size_t SplitComponentsSse2(const char* records, const size_t count, const size_t components, char* const* output) {
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4) {
+			const auto* source = reinterpret_cast<const float*>(records + index * components * 4);
+			__m128      lanes[4];
+			if (components == 2) {
+				// a0 a1 b0 b1 | c0 c1 d0 d1
+				const auto v0 = _mm_loadu_ps(source);
+				const auto v1 = _mm_loadu_ps(source + 4);
+				lanes[0]      = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+				lanes[1]      = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+			} else if (components == 3) {
+				// ax ay az bx | by bz cx cy | cz dx dy dz
+				const auto v0 = _mm_loadu_ps(source);
+				const auto v1 = _mm_loadu_ps(source + 4);
+				const auto v2 = _mm_loadu_ps(source + 8);
+				const auto cd = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));
+				const auto ab = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 1, 1));
+				const auto az = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 1, 2, 2));
+				const auto cz = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 0, 0));
+				lanes[0]      = _mm_shuffle_ps(v0, cd, _MM_SHUFFLE(2, 0, 3, 0));
+				lanes[1]      = _mm_shuffle_ps(ab, cd, _MM_SHUFFLE(3, 1, 2, 0));
+				lanes[2]      = _mm_shuffle_ps(az, cz, _MM_SHUFFLE(2, 0, 2, 0));
+			} else {
+				lanes[0] = _mm_loadu_ps(source);
+				lanes[1] = _mm_loadu_ps(source + 4);
+				lanes[2] = _mm_loadu_ps(source + 8);
+				lanes[3] = _mm_loadu_ps(source + 12);
+				_MM_TRANSPOSE4_PS(lanes[0], lanes[1], lanes[2], lanes[3]);
+			}
+
+			for (size_t component = 0; component < components; ++component) {
+				_mm_storeu_ps(reinterpret_cast<float*>(output[component] + index * 4), lanes[component]);
+			}
+		}
+		return index;
+	}
+
+	/**
+	 * \brief Reverse of SplitComponentsSse2
+	 * \return records done
+	 */
+	size_t MergeComponentsSse2(char* records, const size_t count, const size_t components, const char* const* input) {
+		size_t index = 0;
+		for (; index + 4 <= count; index += 4) {
+			auto* destination = reinterpret_cast<float*>(records + index * components * 4);
+			__m128 lanes[4];
+			for (size_t component = 0; component < components; ++component) {
+				lanes[component] = _mm_loadu_ps(reinterpret_cast<const float*>(input[component] + index * 4));
+			}
+
+			if (components == 2) {
+				_mm_storeu_ps(destination, _mm_unpacklo_ps(lanes[0], lanes[1]));
+				_mm_storeu_ps(destination + 4, _mm_unpackhi_ps(lanes[0], lanes[1]));
+			} else if (components == 3) {
+				const auto& x  = lanes[0];
+				const auto& y  = lanes[1];
+				const auto& z  = lanes[2];
+				const auto  lo = _mm_unpacklo_ps(x, y);
+				const auto  hi = _mm_unpackhi_ps(x, y);
+				const auto  zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+				const auto  yz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+				const auto  zh = _mm_shuffle_ps(z, hi, _MM_SHUFFLE(3, 2, 2, 2));
+				const auto  hz = _mm_shuffle_ps(hi, z, _MM_SHUFFLE(3, 3, 3, 3));
+				_mm_storeu_ps(destination, _mm_shuffle_ps(lo, zx, _MM_SHUFFLE(2, 0, 1, 0)));
+				_mm_storeu_ps(destination + 4, _mm_shuffle_ps(yz, hi, _MM_SHUFFLE(1, 0, 2, 0)));
+				_mm_storeu_ps(destination + 8, _mm_shuffle_ps(zh, hz, _MM_SHUFFLE(2, 0, 2, 0)));
+			} else {
+				_MM_TRANSPOSE4_PS(lanes[0], lanes[1], lanes[2], lanes[3]);
+				_mm_storeu_ps(destination, lanes[0]);
+				_mm_storeu_ps(destination + 4, lanes[1]);
+				_mm_storeu_ps(destination + 8, lanes[2]);
+				_mm_storeu_ps(destination + 12, lanes[3]);
+			}
+		}
+		return index;
+	}
+	#endif
+
+	bool RegionInBuffer(const size_t length, const size_t offset, const size_t count, const size_t stride) {
+		if (stride && count > (static_cast<size_t>(-1) - offset) / stride)
+			return false;
+		return offset <= length && count * stride <= length - offset;
+	}
+}
+
+bool Buffer::Deinterleave(const char* records, const size_t count, const size_t stride, const AttributeStream* streams,
+                          const size_t streamCount) {
+	if (!CheckStreams(stride, streams, streamCount))
+		return false;
+	if (count == 0)
+		return true;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Deinterleave", count * stride);
+
+	size_t done = 0;
+	#if defined(VIS_CORE_VERTEX_SSE2)
+	const AttributeStream* ordered[4];
+	if (const auto components = MatchComponents(stride, streams, streamCount, ordered)) {
+		char* output[4];
+		for (size_t component = 0; component < components; ++component) {
+			output[component] = ordered[component]->Data;
+		}
+		done = SplitComponentsSse2(records, count, components, output);
+	}
+	#endif
+
+	const auto block = std::max<size_t>(1, BlockBytes / std::max<size_t>(stride, 1));
+	for (auto start = done; start < count; start += block) {
+		const auto blockCount = std::min(block, count - start);
+		for (size_t index = 0; index < streamCount; ++index) {
+			const auto& stream = streams[index];
+			CopyStrided(stream.Data + start * stream.Size, stream.Size, records + start * stride + stream.Offset, stride,
+			            blockCount, stream.Size);
+		}
+	}
+	return true;
+}
+
+bool Buffer::Interleave(char* records, const size_t count, const size_t stride, const ConstAttributeStream* streams,
+                        const size_t streamCount) {
+	if (!CheckStreams(stride, streams, streamCount))
+		return false;
+	if (count == 0)
+		return true;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::Interleave", count * stride);
+
+	size_t done = 0;
+	#if defined(VIS_CORE_VERTEX_SSE2)
+	const ConstAttributeStream* ordered[4];
+	if (const auto components = MatchComponents(stride, streams, streamCount, ordered)) {
+		const char* input[4];
+		for (size_t component = 0; component < components; ++component) {
+			input[component] = ordered[component]->Data;
+		}
+		done = MergeComponentsSse2(records, count, components, input);
+	}
+	#endif
+
+	const auto block = std::max<size_t>(1, BlockBytes / std::max<size_t>(stride, 1));
+	for (auto start = done; start < count; start += block) {
+		const auto blockCount = std::min(block, count - start);
+		for (size_t index = 0; index < streamCount; ++index) {
+			const auto& stream = streams[index];
+			CopyStrided(records + start * stride + stream.Offset, stride, stream.Data + start * stream.Size, stream.Size,
+			            blockCount, stream.Size);
+		}
+	}
+	return true;
+}
+
+bool Buffer::DeinterleaveRegion(const IBuffer& buffer, const size_t offset, const size_t count, const size_t stride,
+                                const AttributeStream* streams, const size_t streamCount) {
+	if (!RegionInBuffer(buffer.GetLength(), offset, count, stride))
+		return false;
+	return Deinterleave(buffer.GetData() + offset, count, stride, streams, streamCount);
+}
+
+bool Buffer::InterleaveRegion(IBuffer& buffer, const size_t offset, const size_t count, const size_t stride,
+                              const ConstAttributeStream* streams, const size_t streamCount) {
+	if (!RegionInBuffer(buffer.GetLength(), offset, count, stride))
+		return false;
+
+	// nothing to write into when buffer is read only
+	auto* data = *buffer;
+	if (!data && count)
+		return false;
+	return Interleave(data ? data + offset : nullptr, count, stride, streams, streamCount);
+}
+
+bool Buffer::ComputeMinMax(const float* data, const size_t count, float& min, float& max) {
+	return ComputeBounds(reinterpret_cast<const char*>(data), count, sizeof(float), 1, &min, &max);
+}
+
+double Buffer::ComputeSum(const float* data, const size_t count) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::ComputeSum", count * sizeof(float));
+
+	size_t index = 0;
+	double sum   = 0;
+	#if defined(VIS_CORE_VERTEX_SSE2)
+	auto first  = _mm_setzero_pd();
+	auto second = _mm_setzero_pd();
+	auto third  = _mm_setzero_pd();
+	auto fourth = _mm_setzero_pd();
+	for (; index + 8 <= count; index += 8) {
+		const auto low  = _mm_loadu_ps(data + index);
+		const auto high = _mm_loadu_ps(data + index + 4);
+		first           = _mm_add_pd(first, _mm_cvtps_pd(low));
+		second          = _mm_add_pd(second, _mm_cvtps_pd(_mm_movehl_ps(low, low)));
+		third           = _mm_add_pd(third, _mm_cvtps_pd(high));
+		fourth          = _mm_add_pd(fourth, _mm_cvtps_pd(_mm_movehl_ps(high, high)));
+	}
+
+	double lanes[2];
+	_mm_storeu_pd(lanes, _mm_add_pd(_mm_add_pd(first, second), _mm_add_pd(third, fourth)));
+	sum = lanes[0] + lanes[1];
+	#endif
+
+	for (; index < count; ++index) {
+		sum += data[index];
+	}
+	return sum;
+}
+
+bool Buffer::ComputeBounds(const char* data, const size_t count, const size_t stride, const size_t components,
+                           float* min, float* max) {
+	if (count == 0 || components == 0 || stride < components * sizeof(float))
+		return false;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Buffer::ComputeBounds", count * stride);
+
+	for (size_t component = 0; component < components; ++component) {
+		min[component] = std::numeric_limits<float>::infinity();
+		max[component] = -std::numeric_limits<float>::infinity();
+	}
+
+	size_t index = 0;
+	#if defined(VIS_CORE_VERTEX_SSE2)
+	if (stride == components * sizeof(float) && components <= 4) {
+		// 12 floats hold whole vectors of 1 to 4 components, lane j of vector k is component (4k + j) % components
+		const auto* values = reinterpret_cast<const float*>(data);
+		const auto  total  = count * components;
+		const auto  high   = _mm_set1_ps(std::numeric_limits<float>::infinity());
+		const auto  low    = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+		__m128      mins[3]{high, high, high};
+		__m128      maxs[3]{low, low, low};
+
+		size_t offset = 0;
+		for (; offset + 12 <= total; offset += 12) {
+			for (size_t lane = 0; lane < 3; ++lane) {
+				const auto value = _mm_loadu_ps(values + offset + lane * 4);
+				// second operand is returned when either is NaN
+				mins[lane] = _mm_min_ps(value, mins[lane]);
+				maxs[lane] = _mm_max_ps(value, maxs[lane]);
+			}
+		}
+
+		float laneMin[12];
+		float laneMax[12];
+		for (size_t lane = 0; lane < 3; ++lane) {
+			_mm_storeu_ps(laneMin + lane * 4, mins[lane]);
+			_mm_storeu_ps(laneMax + lane * 4, maxs[lane]);
+		}
+		for (size_t lane = 0; lane < 12; ++lane) {
+			const auto component = lane % components;
+			min[component]       = std::min(min[component], laneMin[lane]);
+			max[component]       = std::max(max[component], laneMax[lane]);
+		}
+		index = offset / components;
+	}
+	#endif
+
+	for (; index < count; ++index) {
+		for (size_t component = 0; component < components; ++component) {
+			float value;
+			memcpy(&value, data + index * stride + component * sizeof(float), sizeof(float));
+			// comparisons with NaN are false so NaN is skipped
+			if (value < min[component])
+				min[component] = value;
+			if (value > max[component])
+				max[component] = value;
+		}
+	}
+
+	bool found = false;
+	for (size_t component = 0; component < components; ++component) {
+		found |= min[component] <= max[component];
+	}
+	return found;
+}
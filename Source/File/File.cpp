@@ -0,0 +1,133 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "File/File.h"
+
+#include "Buffer/BasicBuffer.h"
+#include "Buffer/BufferFactory.h"
+#include "File/FileStream.h"
+#include "File/NativeFile.h"
+#include "File/WriteBehindFile.h"
+#include "Thread/Parallel.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+using namespace std;
+using namespace VisCore;
+
+namespace {
+	/**
+	 * \brief LoadFile() gives each reader at least this many bytes
+	 */
+	constexpr size_t MinLoadChunkSize = 8 * 1024 * 1024;
+
+	/**
+	 * \brief LoadFile() range boundaries are multiple of this
+	 */
+	constexpr size_t LoadChunkAlignment = 1024 * 1024;
+}
+
+File::IFilePtr File::OpenFile(const char* path, const FileMode mode, const FileAccess access, const FileType type,
+                              const FileOptions& options) {
+	if (!path)
+		return nullptr;
+
+	NativeFile file;
+	if (!file.Open(path, mode, access, options.Direct))
+		return nullptr;
+
+	auto stream = std::make_unique<FileStream>(std::move(file), mode, access, type);
+	if (options.WriteBehind && static_cast<uint8_t>(access) & static_cast<uint8_t>(FileAccess::Write))
+		return std::make_shared<WriteBehindFile>(std::move(stream), options);
+
+	return stream;
+}
+
+Buffer::IBufferPtr File::LoadFile(const char* path, const Buffer::BufferType type, const size_t threads,
+                                  const FileOptions& options) {
+	VIS_CORE_TRACE_SCOPE("File::LoadFile");
+
+	if (!path)
+		return nullptr;
+
+	NativeFile file;
+	if (!file.Open(path, FileMode::Open, FileAccess::Read, options.Direct))
+		return nullptr;
+
+	const auto size = file.GetSize();
+	if (size == static_cast<uint64_t>(-1))
+		return nullptr;
+
+	// direct reads land in place, so buffer must meet direct I/O alignment
+	Buffer::BufferAllocation allocation;
+	if (file.IsDirect())
+		allocation.Alignment = NativeFile::DirectAlignment;
+
+	auto buffer = Buffer::CreateUninitializedBuffer(type, static_cast<size_t>(size), allocation);
+	if (!buffer || size == 0)
+		return buffer;
+
+	// other types keep their write path, file is read in order through aligned bounce block
+	auto* data = Buffer::GetDirectWriteData(*buffer);
+	if (!data) {
+		Buffer::BasicConstraintBuffer bounce;
+		bounce.Allocate(std::min<size_t>(LoadChunkAlignment, (static_cast<size_t>(size) + NativeFile::DirectAlignment - 1) &
+		                                                         ~(NativeFile::DirectAlignment - 1)), allocation);
+
+		// whole bounce block is requested so direct reads stay aligned, short read marks end of file
+		for (size_t position = 0; position < size;) {
+			const auto read = file.ReadAt(position, bounce.GetData(), bounce.GetLength());
+			if (read == static_cast<size_t>(-1) || read == 0)
+				return nullptr;
+
+			const auto bytes = std::min<size_t>(read, static_cast<size_t>(size) - position);
+			if (!buffer->Update(position, bytes, bounce.GetData()))
+				return nullptr;
+
+			position += bytes;
+		}
+		return buffer;
+	}
+
+	// direct body stops at last full block, the tail goes through an aligned block
+	const auto body = file.IsDirect() ? static_cast<size_t>(size) & ~(NativeFile::DirectAlignment - 1) : static_cast<size_t>(size);
+
+	auto count = threads == 0 ? Thread::GetDefaultThreadCount() : threads;
+	count      = std::max<size_t>(1, std::min(count, body / MinLoadChunkSize));
+
+	// round up, count chunks must cover whole body
+	const auto chunk = ((body + count - 1) / count + LoadChunkAlignment - 1) & ~(LoadChunkAlignment - 1);
+
+	std::atomic<bool> failed{false};
+	Thread::ParallelInvoke(count, [&](const size_t index) {
+		const auto begin = index * chunk;
+		if (begin >= body)
+			return;
+
+		const auto bytes = std::min(chunk, body - begin);
+		VIS_CORE_TRACE_SCOPE_BYTES("File::LoadChunk", bytes);
+		if (file.ReadAt(begin, data + begin, bytes) != bytes)
+			failed.store(true, std::memory_order_relaxed);
+	});
+
+	if (body < size) {
+		Buffer::BasicConstraintBuffer tail;
+		tail.Allocate(NativeFile::DirectAlignment, allocation);
+
+		const auto bytes = static_cast<size_t>(size) - body;
+		const auto read  = file.ReadAt(body, tail.GetData(), NativeFile::DirectAlignment);
+		if (read == static_cast<size_t>(-1) || read < bytes)
+			return nullptr;
+
+		memcpy(data + body, tail.GetData(), bytes);
+	}
+
+	if (failed.load())
+		return nullptr;
+
+	return buffer;
+}
@@ -0,0 +1,329 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "File/FileStream.h"
+#include "Buffer/BufferFactory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::File;
+using namespace VisCore::Streaming;
+
+namespace {
+	constexpr size_t Alignment = NativeFile::DirectAlignment;
+
+	/**
+	 * \brief Staging block size used by unaligned direct I/O
+	 */
+	constexpr size_t StagingSize = 4 * 1024 * 1024;
+
+	/**
+	 * \brief Bounce block size of ReadToBuffer()
+	 */
+	constexpr size_t BounceSize = 1024 * 1024;
+
+	constexpr uint64_t AlignDown(const uint64_t value) noexcept {
+		return value & ~static_cast<uint64_t>(Alignment - 1);
+	}
+
+	constexpr uint64_t AlignUp(const uint64_t value) noexcept {
+		return AlignDown(value + Alignment - 1);
+	}
+
+	bool IsAligned(const void* ptr) noexcept {
+		return reinterpret_cast<uintptr_t>(ptr) % Alignment == 0;
+	}
+
+	/**
+	 * \brief Get if memory and file offset reach alignment at same time, so aligned middle can skip staging
+	 */
+	bool IsCongruent(const void* ptr, const uint64_t offset) noexcept {
+		return (reinterpret_cast<uintptr_t>(ptr) - offset) % Alignment == 0;
+	}
+}
+
+FileStream::FileStream(NativeFile&& file, const FileMode mode, const FileAccess access, const FileType type)
+	: Native(std::move(file)), Mode(mode), Access(access), Type(type) {
+	if (Mode == FileMode::Append) {
+		const auto size = Native.GetSize();
+		Position        = size == static_cast<uint64_t>(-1) ? 0 : static_cast<size_t>(size);
+	}
+}
+
+FileStream::~FileStream() {
+	FileStream::Close();
+}
+
+size_t FileStream::Tell() const {
+	return Position;
+}
+
+size_t FileStream::Read(Buffer::IBuffer* buffer, const size_t length) {
+	if (!buffer)
+		return -1;
+
+	const auto size = buffer->GetLength() < length ? buffer->GetLength() : length;
+	const auto read = ReadToBuffer(*this, Position, *buffer, size);
+	if (read != static_cast<size_t>(-1))
+		Position += read;
+
+	return read;
+}
+
+size_t FileStream::Seek(const int64_t offset, const SeekMode seekMode) {
+	int64_t base = 0;
+	switch (seekMode) {
+		case SeekMode::SeekSet:
+			break;
+		case SeekMode::SeekCurrent:
+			base = static_cast<int64_t>(Position);
+			break;
+		case SeekMode::SeekEnd: {
+			const auto size = Native.GetSize();
+			if (size == static_cast<uint64_t>(-1))
+				return -1;
+
+			base = static_cast<int64_t>(size);
+			break;
+		}
+		default:
+			return -1;
+	}
+
+	if (base + offset < 0)
+		return -1;
+
+	Position = static_cast<size_t>(base + offset);
+	return Position;
+}
+
+bool FileStream::IsEof() const {
+	return !Native.IsOpen() || Position >= GetSize();
+}
+
+void FileStream::Close() {
+	Native.Close();
+	Staging.Release();
+	Position = 0;
+}
+
+size_t FileStream::Write(const char* data, const size_t length) {
+	const auto written = WriteAt(Position, data, length);
+	if (written != static_cast<size_t>(-1))
+		Position += written;
+
+	return written;
+}
+
+size_t FileStream::Write(const Buffer::IBuffer* buffer, const size_t length) {
+	if (!buffer)
+		return -1;
+
+	return Write(buffer->GetData(), buffer->GetLength() < length ? buffer->GetLength() : length);
+}
+
+size_t FileStream::ReadAt(const uint64_t offset, char* data, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("File::Read", length);
+
+	if (!CanRead() || (!data && length))
+		return -1;
+
+	if (length == 0)
+		return 0;
+
+	return Native.IsDirect() ? DirectRead(offset, data, length) : Native.ReadAt(offset, data, length);
+}
+
+size_t FileStream::WriteAt(const uint64_t offset, const char* data, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("File::Write", length);
+
+	if (!CanWrite() || (!data && length))
+		return -1;
+
+	if (length == 0)
+		return 0;
+
+	return Native.IsDirect() ? DirectWrite(offset, data, length) : Native.WriteAt(offset, data, length);
+}
+
+size_t FileStream::GetSize() const {
+	if (!Native.IsOpen())
+		return -1;
+
+	return static_cast<size_t>(Native.GetSize());
+}
+
+bool FileStream::Flush() {
+	// nothing buffered in user space
+	return Native.IsOpen();
+}
+
+bool FileStream::Sync() {
+	return Native.IsOpen() && Native.Sync();
+}
+
+bool FileStream::IsDirect() const {
+	return Native.IsDirect();
+}
+
+FileMode FileStream::GetMode() const {
+	return Mode;
+}
+
+FileAccess FileStream::GetAccess() const {
+	return Access;
+}
+
+FileType FileStream::GetType() const {
+	return Type;
+}
+
+size_t FileStream::DirectRead(const uint64_t offset, char* data, const size_t length) {
+	size_t done = 0;
+	while (done < length) {
+		const auto position = offset + done;
+		const auto remain   = length - done;
+		auto*      target   = data + done;
+
+		// aligned middle goes straight into caller memory
+		if (position % Alignment == 0 && IsAligned(target) && remain >= Alignment) {
+			const auto bytes = static_cast<size_t>(AlignDown(remain));
+			const auto read  = Native.ReadAt(position, target, bytes);
+			if (read == static_cast<size_t>(-1))
+				return done ? done : static_cast<size_t>(-1);
+
+			done += read;
+			if (read < bytes)
+				break;
+			continue;
+		}
+
+		// unaligned head, tail or memory through staging, only one block if rest can go direct
+		const auto blockStart = AlignDown(position);
+		const auto skip       = static_cast<size_t>(position - blockStart);
+		const auto capacity   = IsCongruent(target, position) ? Alignment : StagingSize;
+		const auto bytes      = std::min(remain, capacity - skip);
+		const auto window     = static_cast<size_t>(AlignUp(skip + bytes));
+
+		auto*      staging = GetStaging();
+		const auto read    = Native.ReadAt(blockStart, staging, window);
+		if (read == static_cast<size_t>(-1))
+			return done ? done : static_cast<size_t>(-1);
+
+		if (read <= skip)
+			break;
+
+		const auto copied = std::min(read - skip, bytes);
+		memcpy(target, staging + skip, copied);
+		done += copied;
+		if (copied < bytes)
+			break;
+	}
+
+	return done;
+}
+
+size_t FileStream::DirectWrite(const uint64_t offset, const char* data, const size_t length) {
+	const auto oldSize = Native.GetSize();
+	if (oldSize == static_cast<uint64_t>(-1))
+		return -1;
+
+	size_t done = 0;
+	while (done < length) {
+		const auto position = offset + done;
+		const auto remain   = length - done;
+		const auto* source  = data + done;
+
+		// aligned middle goes straight from caller memory
+		if (position % Alignment == 0 && IsAligned(source) && remain >= Alignment) {
+			const auto bytes = static_cast<size_t>(AlignDown(remain));
+			if (Native.WriteAt(position, source, bytes) != bytes)
+				return -1;
+
+			done += bytes;
+			continue;
+		}
+
+		const auto blockStart = AlignDown(position);
+		const auto skip       = static_cast<size_t>(position - blockStart);
+		const auto capacity   = IsCongruent(source, position) ? Alignment : StagingSize;
+		const auto bytes      = std::min(remain, capacity - skip);
+		const auto window     = static_cast<size_t>(AlignUp(skip + bytes));
+		auto*      staging    = GetStaging();
+
+		// partial first and last block keep file content, beyond end of file reads as zero
+		if (skip != 0) {
+			memset(staging, 0, Alignment);
+			if (Native.ReadAt(blockStart, staging, Alignment) == static_cast<size_t>(-1))
+				return -1;
+		}
+
+		if ((skip + bytes) % Alignment != 0 && (window > Alignment || skip == 0)) {
+			auto* last = staging + window - Alignment;
+			memset(last, 0, Alignment);
+			if (Native.ReadAt(blockStart + window - Alignment, last, Alignment) == static_cast<size_t>(-1))
+				return -1;
+		}
+
+		memcpy(staging + skip, source, bytes);
+		if (Native.WriteAt(blockStart, staging, window) != window)
+			return -1;
+
+		done += bytes;
+	}
+
+	// drop zero padding written after real end of file
+	const auto end = std::max<uint64_t>(oldSize, offset + length);
+	if (Native.GetSize() > end && !Native.SetSize(end))
+		return -1;
+
+	return done;
+}
+
+char* FileStream::GetStaging() {
+	if (!Staging.GetData()) {
+		Buffer::BufferAllocation allocation;
+		allocation.Alignment = Alignment;
+		Staging.Allocate(StagingSize, allocation);
+	}
+
+	return Staging.GetData();
+}
+
+bool FileStream::CanRead() const noexcept {
+	return Native.IsOpen() && static_cast<uint8_t>(Access) & static_cast<uint8_t>(FileAccess::Read);
+}
+
+bool FileStream::CanWrite() const noexcept {
+	return Native.IsOpen() && static_cast<uint8_t>(Access) & static_cast<uint8_t>(FileAccess::Write);
+}
+
+size_t File::ReadToBuffer(IFile& file, const uint64_t offset, Buffer::IBuffer& buffer, const size_t length) {
+	if (auto* target = Buffer::GetDirectWriteData(buffer))
+		return file.ReadAt(offset, target, length);
+
+	// other types keep their write path, read goes through aligned bounce block
+	Buffer::BufferAllocation allocation;
+	allocation.Alignment = Alignment;
+
+	Buffer::BasicConstraintBuffer bounce;
+	bounce.Allocate(std::min(static_cast<size_t>(AlignUp(length)), BounceSize), allocation);
+
+	size_t done = 0;
+	while (done < length) {
+		const auto want = std::min(length - done, bounce.GetLength());
+		const auto read = file.ReadAt(offset + done, bounce.GetData(), want);
+		if (read == static_cast<size_t>(-1) || (read && !buffer.Update(done, read, bounce.GetData())))
+			return done ? done : static_cast<size_t>(-1);
+
+		done += read;
+		if (read < want)
+			break;
+	}
+	return done;
+}
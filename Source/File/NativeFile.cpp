@@ -0,0 +1,436 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "File/NativeFile.h"
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace VisCore::File;
+
+namespace {
+	/**
+	 * \brief Max bytes of one OS read/write call
+	 */
+	constexpr size_t MaxChunkSize = 1u << 30;
+}
+
+NativeFile::~NativeFile() {
+	Close();
+}
+
+NativeFile::NativeFile(NativeFile&& other) noexcept
+	: Handle(std::exchange(other.Handle, NativeFile().Handle)), Access(other.Access),
+	  Direct(other.Direct.exchange(false)) {
+}
+
+NativeFile& NativeFile::operator=(NativeFile&& other) noexcept {
+	if (&other == this)
+		return *this;
+
+	Close();
+	Handle = std::exchange(other.Handle, NativeFile().Handle);
+	Access = other.Access;
+	Direct = other.Direct.exchange(false);
+	return *this;
+}
+
+#if defined(_WIN32)
+
+bool NativeFile::Open(const char* path, const FileMode mode, const FileAccess access, const bool direct) {
+	Close();
+
+	DWORD disposition = OPEN_EXISTING;
+	switch (mode) {
+		case FileMode::Create:
+			disposition = CREATE_ALWAYS;
+			break;
+		case FileMode::Open:
+			disposition = OPEN_EXISTING;
+			break;
+		case FileMode::OpenCreate:
+		case FileMode::Append:
+			disposition = OPEN_ALWAYS;
+			break;
+		case FileMode::Truncate:
+			disposition = TRUNCATE_EXISTING;
+			break;
+		default:
+			return false;
+	}
+
+	// direct write merge unaligned head and tail with existing content, need read access
+	const auto openAccess = direct && access == FileAccess::Write ? FileAccess::ReadWrite : access;
+
+	const auto desired = [](const FileAccess value) {
+		DWORD result = 0;
+		if (static_cast<uint8_t>(value) & static_cast<uint8_t>(FileAccess::Read))
+			result |= GENERIC_READ;
+		if (static_cast<uint8_t>(value) & static_cast<uint8_t>(FileAccess::Write))
+			result |= GENERIC_WRITE;
+		return result;
+	};
+
+	auto handle = INVALID_HANDLE_VALUE;
+	if (direct) {
+		handle = CreateFileA(path, desired(openAccess), FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, disposition,
+		                     FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING, nullptr);
+		Access = openAccess;
+		Direct = handle != INVALID_HANDLE_VALUE;
+	}
+
+	if (handle == INVALID_HANDLE_VALUE) {
+		handle = CreateFileA(path, desired(access), FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, disposition,
+		                     FILE_ATTRIBUTE_NORMAL, nullptr);
+		Access = access;
+	}
+
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	Handle = handle;
+	return true;
+}
+
+bool NativeFile::OpenTemporary(const char* directory) {
+	Close();
+
+	char tempDirectory[MAX_PATH + 1];
+	if (!directory || !*directory) {
+		if (!GetTempPathA(sizeof(tempDirectory), tempDirectory))
+			return false;
+		directory = tempDirectory;
+	}
+
+	char path[MAX_PATH];
+	if (!GetTempFileNameA(directory, "vis", 0, path))
+		return false;
+
+	const auto handle = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+	                                FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+	if (handle == INVALID_HANDLE_VALUE) {
+		DeleteFileA(path);
+		return false;
+	}
+
+	Handle = handle;
+	Access = FileAccess::ReadWrite;
+	return true;
+}
+
+void NativeFile::Close() noexcept {
+	if (Handle)
+		CloseHandle(Handle);
+	Handle = nullptr;
+	Direct = false;
+}
+
+bool NativeFile::IsOpen() const noexcept {
+	return Handle != nullptr;
+}
+
+size_t NativeFile::ReadAt(const uint64_t offset, char* data, const size_t length) noexcept {
+	size_t done = 0;
+	while (done < length) {
+		const auto chunk    = static_cast<DWORD>(length - done < MaxChunkSize ? length - done : MaxChunkSize);
+		const auto position = offset + done;
+
+		OVERLAPPED overlapped{};
+		overlapped.Offset     = static_cast<DWORD>(position);
+		overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+
+		DWORD read = 0;
+		if (!ReadFile(Handle, data + done, chunk, &read, &overlapped)) {
+			const auto error = GetLastError();
+			if (error == ERROR_HANDLE_EOF)
+				break;
+			if (error == ERROR_INVALID_PARAMETER && Direct && DisableDirect())
+				continue;
+			return done ? done : static_cast<size_t>(-1);
+		}
+
+		done += read;
+
+		// direct read ends at last block, next offset is not aligned
+		if (read == 0 || (Direct && read < chunk))
+			break;
+	}
+
+	return done;
+}
+
+size_t NativeFile::WriteAt(const uint64_t offset, const char* data, const size_t length) noexcept {
+	size_t done = 0;
+	while (done < length) {
+		const auto chunk    = static_cast<DWORD>(length - done < MaxChunkSize ? length - done : MaxChunkSize);
+		const auto position = offset + done;
+
+		OVERLAPPED overlapped{};
+		overlapped.Offset     = static_cast<DWORD>(position);
+		overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+
+		DWORD written = 0;
+		if (!WriteFile(Handle, data + done, chunk, &written, &overlapped)) {
+			if (GetLastError() == ERROR_INVALID_PARAMETER && Direct && DisableDirect())
+				continue;
+			return static_cast<size_t>(-1);
+		}
+
+		// no progress on non-empty request, retry would loop forever
+		if (written == 0)
+			return static_cast<size_t>(-1);
+
+		done += written;
+	}
+
+	return done;
+}
+
+uint64_t NativeFile::GetSize() const noexcept {
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(Handle, &size))
+		return static_cast<uint64_t>(-1);
+
+	return static_cast<uint64_t>(size.QuadPart);
+}
+
+bool NativeFile::SetSize(const uint64_t size) noexcept {
+	FILE_END_OF_FILE_INFO info;
+	info.EndOfFile.QuadPart = static_cast<LONGLONG>(size);
+	return SetFileInformationByHandle(Handle, FileEndOfFileInfo, &info, sizeof(info)) != 0;
+}
+
+bool NativeFile::Sync() noexcept {
+	return FlushFileBuffers(Handle) != 0;
+}
+
+bool NativeFile::DisableDirect() noexcept {
+	DWORD desired = 0;
+	if (static_cast<uint8_t>(Access) & static_cast<uint8_t>(FileAccess::Read))
+		desired |= GENERIC_READ;
+	if (static_cast<uint8_t>(Access) & static_cast<uint8_t>(FileAccess::Write))
+		desired |= GENERIC_WRITE;
+
+	const auto handle = ReOpenFile(Handle, desired, FILE_SHARE_READ | FILE_SHARE_WRITE, FILE_ATTRIBUTE_NORMAL);
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	CloseHandle(Handle);
+	Handle = handle;
+	Direct = false;
+	return true;
+}
+
+#else
+
+bool NativeFile::Open(const char* path, const FileMode mode, const FileAccess access, const bool direct) {
+	Close();
+
+	int flags = 0;
+	switch (mode) {
+		case FileMode::Create:
+			flags = O_CREAT | O_TRUNC;
+			break;
+		case FileMode::Open:
+			break;
+		case FileMode::OpenCreate:
+		case FileMode::Append:
+			flags = O_CREAT;
+			break;
+		case FileMode::Truncate:
+			flags = O_TRUNC;
+			break;
+		default:
+			return false;
+	}
+
+	const auto accessFlags = [](const FileAccess value) {
+		switch (value) {
+			case FileAccess::Write:
+				return O_WRONLY;
+			case FileAccess::ReadWrite:
+				return O_RDWR;
+			default:
+				return O_RDONLY;
+		}
+	};
+
+	#if defined(O_CLOEXEC)
+	flags |= O_CLOEXEC;
+	#endif
+
+	int handle = -1;
+	#if defined(O_DIRECT)
+	if (direct) {
+		// direct write merge unaligned head and tail with existing content, need read access
+		const auto openAccess = access == FileAccess::Write ? FileAccess::ReadWrite : access;
+		do {
+			handle = ::open(path, flags | accessFlags(openAccess) | O_DIRECT, 0644);
+		} while (handle < 0 && errno == EINTR);
+
+		Access = openAccess;
+		Direct = handle >= 0;
+	}
+	#endif
+
+	if (handle < 0) {
+		do {
+			handle = ::open(path, flags | accessFlags(access), 0644);
+		} while (handle < 0 && errno == EINTR);
+
+		Access = access;
+	}
+
+	if (handle < 0)
+		return false;
+
+	#if defined(__APPLE__)
+	// no O_DIRECT on darwin, F_NOCACHE keeps data out of unified buffer cache
+	if (direct) {
+		fcntl(handle, F_NOCACHE, 1);
+	}
+	#endif
+
+	Handle = handle;
+	return true;
+}
+
+bool NativeFile::OpenTemporary(const char* directory) {
+	Close();
+
+	std::string parent = directory && *directory ? directory : "";
+	if (parent.empty()) {
+		const auto* temp = std::getenv("TMPDIR");
+		parent           = temp && *temp ? temp : "/tmp";
+	}
+
+	int handle = -1;
+	#if defined(O_TMPFILE)
+	do {
+		handle = ::open(parent.c_str(), O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	} while (handle < 0 && errno == EINTR);
+	#endif
+
+	// file system without O_TMPFILE, name only exists between create and unlink
+	if (handle < 0) {
+		auto path = parent + "/VisCore.XXXXXX";
+		handle    = ::mkstemp(path.data());
+		if (handle < 0)
+			return false;
+
+		::unlink(path.c_str());
+		::fcntl(handle, F_SETFD, FD_CLOEXEC);
+	}
+
+	Handle = handle;
+	Access = FileAccess::ReadWrite;
+	return true;
+}
+
+void NativeFile::Close() noexcept {
+	if (Handle >= 0)
+		::close(Handle);
+	Handle = -1;
+	Direct = false;
+}
+
+bool NativeFile::IsOpen() const noexcept {
+	return Handle >= 0;
+}
+
+size_t NativeFile::ReadAt(const uint64_t offset, char* data, const size_t length) noexcept {
+	size_t done = 0;
+	while (done < length) {
+		const auto chunk = length - done < MaxChunkSize ? length - done : MaxChunkSize;
+		const auto read  = ::pread(Handle, data + done, chunk, static_cast<off_t>(offset + done));
+		if (read < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EINVAL && Direct && DisableDirect())
+				continue;
+			return done ? done : static_cast<size_t>(-1);
+		}
+
+		done += static_cast<size_t>(read);
+
+		// direct read ends at last block, next offset is not aligned
+		if (read == 0 || (Direct && static_cast<size_t>(read) < chunk))
+			break;
+	}
+
+	return done;
+}
+
+size_t NativeFile::WriteAt(const uint64_t offset, const char* data, const size_t length) noexcept {
+	size_t done = 0;
+	while (done < length) {
+		const auto chunk   = length - done < MaxChunkSize ? length - done : MaxChunkSize;
+		const auto written = ::pwrite(Handle, data + done, chunk, static_cast<off_t>(offset + done));
+		if (written < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EINVAL && Direct && DisableDirect())
+				continue;
+			return static_cast<size_t>(-1);
+		}
+
+		// no progress on non-empty request, retry would loop forever
+		if (written == 0)
+			return static_cast<size_t>(-1);
+
+		done += static_cast<size_t>(written);
+	}
+
+	return done;
+}
+
+uint64_t NativeFile::GetSize() const noexcept {
+	struct stat info {};
+	if (::fstat(Handle, &info) != 0)
+		return static_cast<uint64_t>(-1);
+
+	return static_cast<uint64_t>(info.st_size);
+}
+
+bool NativeFile::SetSize(const uint64_t size) noexcept {
+	int result;
+	do {
+		result = ::ftruncate(Handle, static_cast<off_t>(size));
+	} while (result != 0 && errno == EINTR);
+
+	return result == 0;
+}
+
+bool NativeFile::Sync() noexcept {
+	#if defined(__APPLE__)
+	return ::fcntl(Handle, F_FULLFSYNC) == 0 || ::fsync(Handle) == 0;
+	#else
+	return ::fdatasync(Handle) == 0;
+	#endif
+}
+
+bool NativeFile::DisableDirect() noexcept {
+	#if defined(O_DIRECT)
+	const auto flags = ::fcntl(Handle, F_GETFL);
+	if (flags < 0 || ::fcntl(Handle, F_SETFL, flags & ~O_DIRECT) != 0)
+		return false;
+	#endif
+
+	Direct = false;
+	return true;
+}
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "File/File.h"
+
+#include "Buffer/BufferFactory.h"
+#include "File/FileStream.h"
+#include "File/NativeFile.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::File;
+
+namespace {
+	/**
+	 * \brief Bounce buffer size, multiple of direct I/O alignment
+	 */
+	constexpr size_t BounceSize = 1024 * 1024;
+
+	/**
+	 * \brief Max bytes of one OS call
+	 */
+	constexpr size_t MaxChunkSize = 1u << 30;
+
+	/**
+	 * \brief Bounce buffer of calling thread, kept for later transfers. Aligned so direct files
+	 *		  read and write it without staging
+	 */
+	Buffer::IBuffer& GetBounceBuffer() {
+		thread_local Buffer::IBufferPtr buffer;
+		if (!buffer) {
+			Buffer::BufferAllocation allocation;
+			allocation.Alignment = NativeFile::DirectAlignment;
+			buffer = Buffer::CreateUninitializedBuffer(Buffer::BufferType::Constraint, BounceSize, allocation);
+		}
+		return *buffer;
+	}
+
+	/**
+	 * \brief Write whole data at handle position
+	 * \return false if failed
+	 */
+	bool WriteHandle(const FileHandle handle, const char* data, size_t length) noexcept {
+		while (length) {
+			const auto chunk = std::min(length, MaxChunkSize);
+			#if defined(_WIN32)
+			DWORD written = 0;
+			if (!WriteFile(handle, data, static_cast<DWORD>(chunk), &written, nullptr) || written == 0)
+				return false;
+			#else
+			const auto written = ::write(handle, data, chunk);
+			if (written < 0 && errno == EINTR)
+				continue;
+			if (written <= 0)
+				return false;
+			#endif
+
+			data += written;
+			length -= written;
+		}
+		return true;
+	}
+
+	#if defined(__linux__)
+	/**
+	 * \brief Copy inside kernel, copy_file_range first, then sendfile, then splice into pipe.
+	 *		  Stop at first call kernel refuses, bounce buffer continues from there and reports
+	 *		  real I/O errors
+	 * \param sinkOffset sink file offset, -1 writes at handle position
+	 * \param end set when source has no more data
+	 * \return bytes copied
+	 */
+	size_t KernelCopy(const int source, const uint64_t sourceOffset, const int sink, const uint64_t sinkOffset,
+	                  const size_t length, bool& end) noexcept {
+		const auto positioned = sinkOffset != static_cast<uint64_t>(-1);
+		size_t     done       = 0;
+
+		#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+		// file to file, may share extents or copy on server side
+		while (done < length) {
+			auto       input  = static_cast<loff_t>(sourceOffset + done);
+			auto       output = static_cast<loff_t>(sinkOffset + done);
+			const auto copied = ::copy_file_range(source, &input, sink, positioned ? &output : nullptr,
+			                                      std::min(length - done, MaxChunkSize), 0);
+			if (copied > 0) {
+				done += copied;
+				continue;
+			}
+			if (copied == 0) {
+				end = true;
+				return done;
+			}
+			if (errno != EINTR)
+				break;
+		}
+		#endif
+
+		// sendfile writes at handle position
+		if (done < length && (!positioned || ::lseek(sink, static_cast<off_t>(sinkOffset + done), SEEK_SET) >= 0)) {
+			while (done < length) {
+				auto       input = static_cast<off_t>(sourceOffset + done);
+				const auto sent  = ::sendfile(sink, source, &input, std::min(length - done, MaxChunkSize));
+				if (sent > 0) {
+					done += sent;
+					continue;
+				}
+				if (sent == 0) {
+					end = true;
+					return done;
+				}
+				if (errno != EINTR)
+					break;
+			}
+		}
+
+		// pipe sink on kernels where sendfile refuses pipes
+		while (!positioned && done < length) {
+			auto       input   = static_cast<loff_t>(sourceOffset + done);
+			const auto spliced = ::splice(source, &input, sink, nullptr, std::min(length - done, MaxChunkSize),
+			                              SPLICE_F_MOVE);
+			if (spliced > 0) {
+				done += spliced;
+				continue;
+			}
+			if (spliced == 0) {
+				end = true;
+				return done;
+			}
+			if (errno != EINTR)
+				break;
+		}
+
+		return done;
+	}
+	#endif
+
+	/**
+	 * \brief Copy rest of transfer in user space
+	 * \param done bytes already copied
+	 * \param write writes whole chunk to sink, false if failed
+	 */
+	template <typename Write>
+	size_t CopyStream(Streaming::IStreaming& source, const size_t length, size_t done, Write&& write) {
+		const auto failed = [&done] {
+			return done ? done : static_cast<size_t>(-1);
+		};
+
+		// contiguous streaming buffers are written from their own memory
+		if (auto* buffer = dynamic_cast<Buffer::IBuffer*>(&source);
+		    buffer && (buffer->GetType() == Buffer::BufferType::Streaming ||
+		               buffer->GetType() == Buffer::BufferType::Shared)) {
+			const auto position  = source.Tell();
+			const auto available = buffer->GetLength() > position ? buffer->GetLength() - position : 0;
+			const auto size      = std::min(length - done, available);
+			if (size && !write(buffer->GetData() + position, size))
+				return failed();
+
+			source.Seek(static_cast<int64_t>(size), Streaming::SeekMode::SeekCurrent);
+			return done + size;
+		}
+
+		auto& bounce = GetBounceBuffer();
+		while (done < length) {
+			const auto want = std::min(length - done, bounce.GetLength());
+			const auto read = source.Read(&bounce, want);
+			if (read == static_cast<size_t>(-1))
+				return failed();
+			if (read == 0)
+				break;
+
+			const auto size = std::min(read, want);
+			if (!write(bounce.GetData(), size))
+				return failed();
+
+			done += size;
+			if (size < want)
+				break;
+		}
+		return done;
+	}
+}
+
+size_t File::Transfer(Streaming::IStreaming& source, IFile& sink, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("File::Transfer", length);
+
+	size_t done = 0;
+	bool   end  = false;
+
+	#if defined(__linux__)
+	auto* input  = dynamic_cast<FileStream*>(&source);
+	auto* output = dynamic_cast<FileStream*>(&sink);
+	if (input && output && input->GetHandle() >= 0 && output->GetHandle() >= 0) {
+		done = KernelCopy(input->GetHandle(), input->Tell(), output->GetHandle(), output->Tell(), length, end);
+		input->Seek(static_cast<int64_t>(done), Streaming::SeekMode::SeekCurrent);
+		output->Seek(static_cast<int64_t>(done), Streaming::SeekMode::SeekCurrent);
+	}
+	#endif
+
+	if (end)
+		return done;
+
+	return CopyStream(source, length, done, [&sink](const char* data, const size_t size) {
+		return sink.Write(data, size) == size;
+	});
+}
+
+size_t File::Transfer(Streaming::IStreaming& source, const FileHandle sink, const size_t length) {
+	VIS_CORE_TRACE_SCOPE_BYTES("File::Transfer", length);
+
+	size_t done = 0;
+	bool   end  = false;
+
+	#if defined(__linux__)
+	auto* input = dynamic_cast<FileStream*>(&source);
+	if (input && input->GetHandle() >= 0 && sink >= 0) {
+		done = KernelCopy(input->GetHandle(), input->Tell(), sink, -1, length, end);
+		input->Seek(static_cast<int64_t>(done), Streaming::SeekMode::SeekCurrent);
+	}
+	#endif
+
+	if (end)
+		return done;
+
+	return CopyStream(source, length, done, [sink](const char* data, const size_t size) {
+		return WriteHandle(sink, data, size);
+	});
+}
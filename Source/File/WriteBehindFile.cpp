@@ -0,0 +1,270 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "File/WriteBehindFile.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::File;
+using namespace VisCore::Streaming;
+
+WriteBehindFile::WriteBehindFile(std::unique_ptr<FileStream> stream, const FileOptions& options)
+	: Stream(std::move(stream)), Blocks(std::max<size_t>(options.BlockCount, 2)),
+	  BlockSize((std::max<size_t>(options.BlockSize, 1) + NativeFile::DirectAlignment - 1) &
+	            ~(NativeFile::DirectAlignment - 1)) {
+	Position = Stream->Tell();
+	End      = Position;
+
+	for (size_t index = Blocks.size(); index > 0; --index) {
+		Free.push_back(index - 1);
+	}
+
+	Worker = std::thread(&WriteBehindFile::Run, this);
+}
+
+WriteBehindFile::~WriteBehindFile() {
+	WriteBehindFile::Close();
+}
+
+size_t WriteBehindFile::Tell() const {
+	return Position;
+}
+
+size_t WriteBehindFile::Read(Buffer::IBuffer* buffer, const size_t length) {
+	if (!buffer)
+		return -1;
+
+	const auto read = ReadToBuffer(*this, Position, *buffer, buffer->GetLength() < length ? buffer->GetLength() : length);
+	if (read != static_cast<size_t>(-1))
+		Position += read;
+
+	return read;
+}
+
+size_t WriteBehindFile::Seek(const int64_t offset, const SeekMode seekMode) {
+	int64_t base = 0;
+	switch (seekMode) {
+		case SeekMode::SeekSet:
+			break;
+		case SeekMode::SeekCurrent:
+			base = static_cast<int64_t>(Position);
+			break;
+		case SeekMode::SeekEnd: {
+			const auto size = GetSize();
+			if (size == static_cast<size_t>(-1))
+				return -1;
+
+			base = static_cast<int64_t>(size);
+			break;
+		}
+		default:
+			return -1;
+	}
+
+	if (base + offset < 0)
+		return -1;
+
+	// next Write() starts a new block when position leaves current one
+	Position = static_cast<size_t>(base + offset);
+	return Position;
+}
+
+bool WriteBehindFile::IsEof() const {
+	return Position >= GetSize();
+}
+
+void WriteBehindFile::Close() {
+	if (!Worker.joinable())
+		return;
+
+	Flush();
+	{
+		std::lock_guard<std::mutex> lock(Mutex);
+		Stopping = true;
+	}
+	WorkReady.notify_all();
+	Worker.join();
+
+	for (auto& block : Blocks) {
+		block.Data.Release();
+	}
+	Stream->Close();
+	Position = 0;
+}
+
+size_t WriteBehindFile::Write(const char* data, const size_t length) {
+	if (!Worker.joinable() || (!data && length))
+		return -1;
+
+	{
+		std::lock_guard<std::mutex> lock(Mutex);
+		if (Failed)
+			return -1;
+	}
+
+	size_t done = 0;
+	while (done < length) {
+		if (Current != NoBlock && Blocks[Current].Offset + Blocks[Current].Used != Position)
+			Submit();
+
+		if (Current == NoBlock)
+			Acquire(Position);
+
+		auto&      block = Blocks[Current];
+		const auto bytes = std::min(BlockSize - block.Used, length - done);
+		memcpy(block.Data.GetData() + block.Used, data + done, bytes);
+		block.Used += bytes;
+		Position += bytes;
+		done += bytes;
+
+		if (block.Used == BlockSize)
+			Submit();
+	}
+
+	End = std::max<uint64_t>(End, Position);
+	return done;
+}
+
+size_t WriteBehindFile::Write(const Buffer::IBuffer* buffer, const size_t length) {
+	if (!buffer)
+		return -1;
+
+	return Write(buffer->GetData(), buffer->GetLength() < length ? buffer->GetLength() : length);
+}
+
+size_t WriteBehindFile::ReadAt(const uint64_t offset, char* data, const size_t length) {
+	if (!Worker.joinable())
+		return -1;
+
+	Flush();
+	return Stream->ReadAt(offset, data, length);
+}
+
+size_t WriteBehindFile::WriteAt(const uint64_t offset, const char* data, const size_t length) {
+	if (!Worker.joinable())
+		return -1;
+
+	// keep order with pending blocks
+	if (!Flush())
+		return -1;
+
+	const auto written = Stream->WriteAt(offset, data, length);
+	if (written != static_cast<size_t>(-1))
+		End = std::max<uint64_t>(End, offset + written);
+
+	return written;
+}
+
+size_t WriteBehindFile::GetSize() const {
+	const auto size = Stream->GetSize();
+	if (size == static_cast<size_t>(-1))
+		return -1;
+
+	return std::max<size_t>(size, static_cast<size_t>(End));
+}
+
+bool WriteBehindFile::Flush() {
+	if (!Worker.joinable())
+		return false;
+
+	Submit();
+
+	std::unique_lock<std::mutex> lock(Mutex);
+	BlockDone.wait(lock, [this] {
+		return Pending.empty() && !Busy;
+	});
+	return !Failed;
+}
+
+bool WriteBehindFile::Sync() {
+	return Flush() && Stream->Sync();
+}
+
+bool WriteBehindFile::IsDirect() const {
+	return Stream->IsDirect();
+}
+
+FileMode WriteBehindFile::GetMode() const {
+	return Stream->GetMode();
+}
+
+FileAccess WriteBehindFile::GetAccess() const {
+	return Stream->GetAccess();
+}
+
+FileType WriteBehindFile::GetType() const {
+	return Stream->GetType();
+}
+
+void WriteBehindFile::Submit() {
+	if (Current == NoBlock)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(Mutex);
+		if (Blocks[Current].Used)
+			Pending.push_back(Current);
+		else
+			Free.push_back(Current);
+	}
+
+	Current = NoBlock;
+	WorkReady.notify_one();
+}
+
+void WriteBehindFile::Acquire(const uint64_t offset) {
+	{
+		// backpressure, wait background thread release one block
+		std::unique_lock<std::mutex> lock(Mutex);
+		BlockDone.wait(lock, [this] {
+			return !Free.empty();
+		});
+
+		Current = Free.back();
+		Free.pop_back();
+	}
+
+	auto& block = Blocks[Current];
+	if (!block.Data.GetData()) {
+		// aligned so direct file can write full blocks without staging
+		Buffer::BufferAllocation allocation;
+		allocation.Alignment = NativeFile::DirectAlignment;
+		block.Data.Allocate(BlockSize, allocation);
+	}
+
+	block.Offset = offset;
+	block.Used   = 0;
+}
+
+void WriteBehindFile::Run() {
+	std::unique_lock<std::mutex> lock(Mutex);
+	for (;;) {
+		WorkReady.wait(lock, [this] {
+			return Stopping || !Pending.empty();
+		});
+
+		if (Pending.empty())
+			return;
+
+		const auto index = Pending.front();
+		Pending.pop_front();
+		Busy = true;
+		lock.unlock();
+
+		auto&      block   = Blocks[index];
+		const auto written = Stream->WriteAt(block.Offset, block.Data.GetData(), block.Used);
+
+		lock.lock();
+		if (written != block.Used)
+			Failed = true;
+
+		block.Used = 0;
+		Free.push_back(index);
+		Busy = false;
+		BlockDone.notify_all();
+	}
+}
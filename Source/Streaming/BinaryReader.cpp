@@ -0,0 +1,166 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Streaming/BinaryReader.h"
+#include "Buffer/BufferFactory.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Streaming;
+
+namespace {
+	/**
+	 * \brief Longest LEB128 encoding of 64 bit value
+	 */
+	constexpr size_t MaxVarintSize = 10;
+}
+
+BinaryReader::BinaryReader(IStreaming* stream, const size_t chunkSize)
+	: Stream(stream), ChunkSize(std::max<size_t>(chunkSize, MaxVarintSize)) {
+	Chunk = Buffer::CreateUninitializedBuffer(Buffer::BufferType::Constraint, ChunkSize, {});
+}
+
+BinaryReader::BinaryReader(const Buffer::IBuffer& buffer, size_t offset) : Stream(nullptr), ChunkSize(0) {
+	const auto length = buffer.GetLength();
+	offset            = std::min(offset, length);
+	if (length) {
+		Base   = buffer.GetData() + offset;
+		Cursor = Base;
+		End    = buffer.GetData() + length;
+	}
+}
+
+bool BinaryReader::ReadBytes(char* data, size_t size) {
+	while (size) {
+		if (Cursor == End && !Fill()) {
+			Failed = true;
+			return false;
+		}
+
+		const auto bytes = std::min(size, static_cast<size_t>(End - Cursor));
+		memcpy(data, Cursor, bytes);
+		Cursor += bytes;
+		data += bytes;
+		size -= bytes;
+	}
+	return true;
+}
+
+bool BinaryReader::ReadVarint(uint64_t& value) {
+	uint64_t result = 0;
+	if (static_cast<size_t>(End - Cursor) >= MaxVarintSize) {
+		// whole encoding is in chunk, decode without bound checks
+		const auto* data = reinterpret_cast<const uint8_t*>(Cursor);
+		for (size_t index = 0; index < MaxVarintSize; ++index) {
+			result |= static_cast<uint64_t>(data[index] & 0x7F) << (index * 7);
+			if (!(data[index] & 0x80)) {
+				Cursor += index + 1;
+				value = result;
+				return true;
+			}
+		}
+
+		Failed = true;
+		return false;
+	}
+
+	for (size_t index = 0; index < MaxVarintSize; ++index) {
+		uint8_t byte;
+		if (!Read(byte))
+			return false;
+
+		result |= static_cast<uint64_t>(byte & 0x7F) << (index * 7);
+		if (!(byte & 0x80)) {
+			value = result;
+			return true;
+		}
+	}
+
+	Failed = true;
+	return false;
+}
+
+bool BinaryReader::ReadSignedVarint(int64_t& value) {
+	uint64_t result = 0;
+	for (size_t index = 0; index < MaxVarintSize; ++index) {
+		uint8_t byte;
+		if (!Read(byte))
+			return false;
+
+		const auto shift = index * 7;
+		result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			// sign bit of last group fills the rest
+			if (shift + 7 < 64 && (byte & 0x40))
+				result |= ~static_cast<uint64_t>(0) << (shift + 7);
+
+			value = static_cast<int64_t>(result);
+			return true;
+		}
+	}
+
+	Failed = true;
+	return false;
+}
+
+bool BinaryReader::Skip(size_t size) {
+	const auto bytes = std::min(size, static_cast<size_t>(End - Cursor));
+	Cursor += bytes;
+	size -= bytes;
+	if (size == 0)
+		return true;
+
+	if (!Stream) {
+		Failed = true;
+		return false;
+	}
+
+	// chunk is used up, move source instead of reading through
+	const auto position = Stream->Tell();
+	const auto target   = Stream->Seek(static_cast<int64_t>(size), SeekMode::SeekCurrent);
+	if (target != static_cast<size_t>(-1) && target == position + size) {
+		Consumed += Cursor - Base + size;
+		Base = Cursor;
+		return true;
+	}
+
+	while (size) {
+		if (!Fill()) {
+			Failed = true;
+			return false;
+		}
+
+		const auto skipped = std::min(size, static_cast<size_t>(End - Cursor));
+		Cursor += skipped;
+		size -= skipped;
+	}
+	return true;
+}
+
+uint64_t BinaryReader::Tell() const {
+	return Consumed + (Cursor - Base);
+}
+
+bool BinaryReader::IsFailed() const {
+	return Failed;
+}
+
+bool BinaryReader::Fill() {
+	if (!Stream)
+		return false;
+
+	Consumed += Cursor - Base;
+	Base = Cursor;
+
+	const auto read = Stream->Read(Chunk.get(), ChunkSize);
+	if (read == 0 || read == static_cast<size_t>(-1))
+		return false;
+
+	Base   = Chunk->GetData();
+	Cursor = Base;
+	End    = Base + std::min(read, Chunk->GetLength());
+	return true;
+}
@@ -0,0 +1,129 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Streaming/BinaryWriter.h"
+#include "Buffer/BufferFactory.h"
+
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Streaming;
+
+namespace {
+	/**
+	 * \brief Longest LEB128 encoding of 64 bit value
+	 */
+	constexpr size_t MaxVarintSize = 10;
+}
+
+BinaryWriter::BinaryWriter(File::IFile* file, const size_t chunkSize) : Sink(file) {
+	Chunk  = Buffer::CreateUninitializedBuffer(Buffer::BufferType::Constraint, std::max(chunkSize, MaxVarintSize), {});
+	Cursor = **Chunk;
+	End    = Cursor + Chunk->GetLength();
+}
+
+BinaryWriter::BinaryWriter(Buffer::IBuffer& buffer, const size_t offset, const size_t chunkSize)
+	: Target(&buffer), Offset(offset) {
+	Chunk  = Buffer::CreateUninitializedBuffer(Buffer::BufferType::Constraint, std::max(chunkSize, MaxVarintSize), {});
+	Cursor = **Chunk;
+	End    = Cursor + Chunk->GetLength();
+}
+
+BinaryWriter::~BinaryWriter() {
+	Flush();
+}
+
+bool BinaryWriter::WriteBytes(const char* data, size_t size) {
+	if (Failed)
+		return false;
+
+	if (size >= Chunk->GetLength()) {
+		// large block skips staging
+		return Flush() && WriteSink(data, size);
+	}
+
+	while (size) {
+		if (Cursor == End && !Flush())
+			return false;
+
+		const auto bytes = std::min(size, static_cast<size_t>(End - Cursor));
+		memcpy(Cursor, data, bytes);
+		Cursor += bytes;
+		data += bytes;
+		size -= bytes;
+	}
+	return true;
+}
+
+bool BinaryWriter::WriteVarint(uint64_t value) {
+	char   encoded[MaxVarintSize];
+	size_t size = 0;
+	do {
+		const auto byte = static_cast<uint8_t>(value & 0x7F);
+		value >>= 7;
+		encoded[size++] = static_cast<char>(value ? byte | 0x80 : byte);
+	} while (value);
+
+	return WriteBytes(encoded, size);
+}
+
+bool BinaryWriter::WriteSignedVarint(int64_t value) {
+	char   encoded[MaxVarintSize];
+	size_t size = 0;
+	for (;;) {
+		const auto byte = static_cast<uint8_t>(value & 0x7F);
+		// arithmetic shift keeps sign
+		value >>= 7;
+		const auto done = (value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40));
+		encoded[size++] = static_cast<char>(done ? byte : byte | 0x80);
+		if (done)
+			break;
+	}
+
+	return WriteBytes(encoded, size);
+}
+
+bool BinaryWriter::Flush() {
+	if (Failed)
+		return false;
+
+	auto*      begin = **Chunk;
+	const auto size  = static_cast<size_t>(Cursor - begin);
+	Cursor           = begin;
+	return size == 0 || WriteSink(begin, size);
+}
+
+uint64_t BinaryWriter::Tell() const {
+	return Written + (Cursor - Chunk->GetData());
+}
+
+bool BinaryWriter::IsFailed() const {
+	return Failed;
+}
+
+bool BinaryWriter::WriteSink(const char* data, const size_t size) {
+	if (Sink) {
+		Failed = Sink->Write(data, size) != size;
+	} else if (Target) {
+		// overwrite inside buffer, append what is past its end
+		const auto length = Target->GetLength();
+		const auto inside = Offset < length ? std::min(size, length - Offset) : 0;
+		Failed            = Offset > length || (inside && !Target->Update(Offset, inside, data));
+
+		for (auto rest = inside; !Failed && rest < size;) {
+			const auto bytes = std::min(size - rest, static_cast<size_t>(INT_MAX));
+			Failed           = !Target->Append(data + rest, static_cast<int>(bytes));
+			rest += bytes;
+		}
+		Offset += size;
+	} else {
+		Failed = true;
+	}
+
+	if (!Failed)
+		Written += size;
+	return !Failed;
+}
@@ -0,0 +1,298 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Streaming/Varint.h"
+#include "Streaming/ByteOrder.h"
+#include "Trace/Trace.h"
+
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define VIS_CORE_VARINT_SSSE3 1
+#define VIS_CORE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Streaming;
+
+namespace {
+	constexpr uint64_t StopBits = 0x8080808080808080ull;
+
+	/**
+	 * \brief Shuffle pattern and data length of each group varint tag
+	 */
+	struct GroupVarintTable {
+		uint8_t Shuffle[256][16];
+		uint8_t Length[256];
+	};
+
+	constexpr GroupVarintTable MakeGroupVarintTable() {
+		GroupVarintTable table{};
+		for (size_t tag = 0; tag < 256; ++tag) {
+			uint8_t offset = 0;
+			for (size_t value = 0; value < 4; ++value) {
+				const auto length = static_cast<uint8_t>((tag >> (value * 2) & 3) + 1);
+				for (uint8_t byte = 0; byte < 4; ++byte) {
+					// index with high bit set makes pshufb write 0
+					table.Shuffle[tag][value * 4 + byte] = byte < length ? static_cast<uint8_t>(offset + byte) : 0x80;
+				}
+				offset = static_cast<uint8_t>(offset + length);
+			}
+			table.Length[tag] = offset;
+		}
+		return table;
+	}
+
+	constexpr auto GroupTable = MakeGroupVarintTable();
+
+	/**
+	 * \brief Index of lowest set bit, mask must not be 0
+	 */
+	size_t LowestBit(const uint64_t mask) {
+		#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, mask);
+		return index;
+		#else
+		return static_cast<size_t>(__builtin_ctzll(mask));
+		#endif
+	}
+
+	/**
+	 * \brief Pack 7 bit groups held in the low bits of each byte into one value
+	 */
+	uint64_t Compact7(uint64_t value) {
+		value = (value & 0x7F007F007F007F00ull) >> 1 | (value & 0x007F007F007F007Full);
+		value = (value & 0x3FFF00003FFF0000ull) >> 2 | (value & 0x00003FFF00003FFFull);
+		value = (value & 0x0FFFFFFF00000000ull) >> 4 | (value & 0x000000000FFFFFFFull);
+		return value;
+	}
+
+	template<typename T>
+	size_t EncodeLeb128(const T* values, const size_t count, char* destination) {
+		auto* output = destination;
+		for (size_t index = 0; index < count; ++index) {
+			auto value = values[index];
+			while (value >= 0x80) {
+				*output++ = static_cast<char>(value | 0x80);
+				value >>= 7;
+			}
+			*output++ = static_cast<char>(value);
+		}
+		return output - destination;
+	}
+
+	template<typename T>
+	size_t DecodeLeb128(const uint8_t* data, const size_t size, T* values, const size_t count, size_t& consumed) {
+		constexpr uint64_t Limit = static_cast<T>(-1);
+
+		size_t offset  = 0;
+		size_t decoded = 0;
+		while (decoded < count) {
+			if (size - offset >= 8) {
+				uint64_t word;
+				memcpy(&word, data + offset, sizeof(word));
+				word = ConvertByteOrder<ByteOrder::Little>(word);
+
+				const auto stops = ~word & StopBits;
+				if (stops == StopBits && count - decoded >= 8) {
+					// 8 one byte values, common for small indices and deltas
+					for (size_t index = 0; index < 8; ++index) {
+						values[decoded + index] = data[offset + index];
+					}
+					offset += 8;
+					decoded += 8;
+					continue;
+				}
+
+				if (stops && count - decoded >= 8) {
+					// every value ending in this word, only shifts depend on previous length
+					size_t start = 0;
+					auto   bits  = stops;
+					do {
+						const auto stop   = LowestBit(bits) / 8;
+						const auto length = stop + 1 - start;
+						const auto mask   = length == 8 ? ~static_cast<uint64_t>(0) : (static_cast<uint64_t>(1) << length * 8) - 1;
+						const auto value  = Compact7(word >> start * 8 & mask & ~StopBits);
+						if (value > Limit)
+							return -1;
+
+						values[decoded++] = static_cast<T>(value);
+						start             = stop + 1;
+						bits &= bits - 1;
+					} while (bits);
+
+					offset += start;
+					continue;
+				}
+
+				if (stops) {
+					const auto length = LowestBit(stops) / 8 + 1;
+					const auto mask   = length == 8 ? ~static_cast<uint64_t>(0) : (static_cast<uint64_t>(1) << length * 8) - 1;
+					const auto value  = Compact7(word & mask & ~StopBits);
+					if (value > Limit)
+						return -1;
+
+					values[decoded++] = static_cast<T>(value);
+					offset += length;
+					continue;
+				}
+			}
+
+			// 9 or 10 byte value, or near end of data
+			uint64_t value = 0;
+			size_t   index = 0;
+			bool     done  = false;
+			for (; index < 10 && offset + index < size; ++index) {
+				const auto byte = data[offset + index];
+				value |= static_cast<uint64_t>(byte & 0x7F) << (index * 7);
+				if (!(byte & 0x80)) {
+					done = true;
+					break;
+				}
+			}
+
+			if (!done) {
+				if (index == 10)
+					return -1;
+				break;
+			}
+
+			if (value > Limit)
+				return -1;
+
+			values[decoded++] = static_cast<T>(value);
+			offset += index + 1;
+		}
+
+		consumed = offset;
+		return decoded;
+	}
+
+	#if defined(VIS_CORE_VARINT_SSSE3)
+	bool HasSsse3() {
+		static const bool supported = __builtin_cpu_supports("ssse3");
+		return supported;
+	}
+
+	/**
+	 * \brief Decode whole groups while 16 data bytes can be loaded after tag
+	 */
+	VIS_CORE_TARGET_SSSE3 void DecodeGroupsSsse3(const uint8_t* data, const size_t size, uint32_t* values,
+	                                             const size_t count, size_t& offset, size_t& decoded) {
+		while (count - decoded >= 4 && size - offset >= 17) {
+			const auto tag     = data[offset];
+			const auto input   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset + 1));
+			const auto pattern = _mm_loadu_si128(reinterpret_cast<const __m128i*>(GroupTable.Shuffle[tag]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(values + decoded), _mm_shuffle_epi8(input, pattern));
+			offset += 1 + GroupTable.Length[tag];
+			decoded += 4;
+		}
+	}
+	#endif
+}
+
+size_t Streaming::GetVarintSize(uint64_t value) {
+	size_t size = 1;
+	while (value >= 0x80) {
+		value >>= 7;
+		++size;
+	}
+	return size;
+}
+
+size_t Streaming::EncodeVarints(const uint64_t* values, const size_t count, char* destination) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::EncodeVarints", count * sizeof(uint64_t));
+
+	return EncodeLeb128(values, count, destination);
+}
+
+size_t Streaming::EncodeVarints(const uint32_t* values, const size_t count, char* destination) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::EncodeVarints", count * sizeof(uint32_t));
+
+	return EncodeLeb128(values, count, destination);
+}
+
+size_t Streaming::DecodeVarints(const char* data, const size_t size, uint64_t* values, const size_t count,
+                                size_t& consumed) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::DecodeVarints", size);
+
+	consumed = 0;
+	return DecodeLeb128(reinterpret_cast<const uint8_t*>(data), size, values, count, consumed);
+}
+
+size_t Streaming::DecodeVarints(const char* data, const size_t size, uint32_t* values, const size_t count,
+                                size_t& consumed) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::DecodeVarints", size);
+
+	consumed = 0;
+	return DecodeLeb128(reinterpret_cast<const uint8_t*>(data), size, values, count, consumed);
+}
+
+size_t Streaming::GetGroupVarintMaxSize(const size_t count) {
+	return (count + 3) / 4 * 17;
+}
+
+size_t Streaming::EncodeGroupVarint(const uint32_t* values, const size_t count, char* destination) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::EncodeGroupVarint", count * sizeof(uint32_t));
+
+	auto* output = reinterpret_cast<uint8_t*>(destination);
+	for (size_t group = 0; group < count; group += 4) {
+		auto*   tag   = output++;
+		uint8_t flags = 0;
+		for (size_t index = 0; index < 4; ++index) {
+			auto       value  = group + index < count ? values[group + index] : 0;
+			const auto length = value < 1u << 8 ? 1 : value < 1u << 16 ? 2 : value < 1u << 24 ? 3 : 4;
+			flags |= static_cast<uint8_t>((length - 1) << (index * 2));
+			for (auto byte = 0; byte < length; ++byte, value >>= 8) {
+				*output++ = static_cast<uint8_t>(value);
+			}
+		}
+		*tag = flags;
+	}
+	return output - reinterpret_cast<uint8_t*>(destination);
+}
+
+size_t Streaming::DecodeGroupVarint(const char* data, const size_t size, uint32_t* values, const size_t count,
+                                    size_t& consumed) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Streaming::DecodeGroupVarint", size);
+
+	const auto* bytes   = reinterpret_cast<const uint8_t*>(data);
+	size_t      offset  = 0;
+	size_t      decoded = 0;
+	#if defined(VIS_CORE_VARINT_SSSE3) && (!defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	if (HasSsse3())
+		DecodeGroupsSsse3(bytes, size, values, count, offset, decoded);
+	#endif
+
+	while (decoded < count && offset < size) {
+		const auto tag = bytes[offset];
+		if (size - offset - 1 < GroupTable.Length[tag])
+			break;
+
+		auto position = offset + 1;
+		for (size_t index = 0; index < 4; ++index) {
+			const auto length = (tag >> (index * 2) & 3) + 1;
+			uint32_t   value  = 0;
+			for (size_t byte = 0; byte < length; ++byte) {
+				value |= static_cast<uint32_t>(bytes[position + byte]) << (byte * 8);
+			}
+			position += length;
+
+			// padding of last group is consumed but not returned
+			if (decoded < count)
+				values[decoded++] = value;
+		}
+		offset = position;
+	}
+
+	consumed = offset;
+	return decoded;
+}
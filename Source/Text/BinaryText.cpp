@@ -0,0 +1,597 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Text/BinaryText.h"
+#include "Buffer/BufferFactory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIS_CORE_BINARY_TEXT_SSE2 1
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define VIS_CORE_BINARY_TEXT_SSSE3 1
+#define VIS_CORE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Text;
+
+namespace {
+	constexpr char    Base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	constexpr char    HexLower[]       = "0123456789abcdef";
+	constexpr char    HexUpper[]       = "0123456789ABCDEF";
+	constexpr uint8_t Invalid          = 0xFF;
+
+	constexpr std::array<uint8_t, 256> MakeBase64Table() {
+		std::array<uint8_t, 256> table{};
+		for (auto& value : table) {
+			value = Invalid;
+		}
+		for (uint8_t index = 0; index < 64; ++index) {
+			table[static_cast<uint8_t>(Base64Alphabet[index])] = index;
+		}
+		return table;
+	}
+
+	constexpr std::array<uint8_t, 256> MakeHexTable() {
+		std::array<uint8_t, 256> table{};
+		for (auto& value : table) {
+			value = Invalid;
+		}
+		for (uint8_t index = 0; index < 16; ++index) {
+			table[static_cast<uint8_t>(HexLower[index])] = index;
+			table[static_cast<uint8_t>(HexUpper[index])] = index;
+		}
+		return table;
+	}
+
+	constexpr auto Base64Table = MakeBase64Table();
+	constexpr auto HexTable    = MakeHexTable();
+
+	#if defined(VIS_CORE_BINARY_TEXT_SSE2)
+	/**
+	 * \brief 0xFF where lower <= value <= upper, value is taken as signed so bytes above 0x7F never match
+	 */
+	__m128i InRange(const __m128i value, const char lower, const char upper) {
+		return _mm_and_si128(_mm_cmpgt_epi8(value, _mm_set1_epi8(static_cast<char>(lower - 1))),
+		                     _mm_cmplt_epi8(value, _mm_set1_epi8(static_cast<char>(upper + 1))));
+	}
+	#endif
+
+	#if defined(VIS_CORE_BINARY_TEXT_SSSE3)
+	bool HasSsse3() {
+		static const bool supported = __builtin_cpu_supports("ssse3");
+		return supported;
+	}
+
+	/**
+	 * \brief Encode 12 bytes of each 16 byte load to 16 characters, Mula and Lemire,
+	 *		  "Faster Base64 Encoding and Decoding Using AVX2 Instructions"
+	 * \return consumed bytes
+	 */
+	VIS_CORE_TARGET_SSSE3 size_t EncodeBase64Ssse3(const uint8_t* data, const size_t size, char* destination) {
+		size_t index = 0;
+		for (; index + 16 <= size; index += 12) {
+			auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+			input      = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+			// split each 24 bits into four 6 bit indices, one per byte
+			const auto high    = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+			const auto low     = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+			const auto indices = _mm_or_si128(high, low);
+
+			// 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12, then add per range offset
+			auto range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+			range      = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+			const auto offset = _mm_shuffle_epi8(_mm_setr_epi8(
+				'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				'0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), range);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index / 3 * 4), _mm_add_epi8(offset, indices));
+		}
+		return index;
+	}
+
+	/**
+	 * \brief Decode 16 characters to 12 bytes per step, each step stores 16 bytes
+	 * \return consumed characters, -1 if text is invalid
+	 */
+	VIS_CORE_TARGET_SSSE3 size_t DecodeBase64Ssse3(const char* data, const size_t size, char* destination) {
+		size_t index = 0;
+		for (; index + 16 <= size; index += 16) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+
+			const auto upper = InRange(input, 'A', 'Z');
+			const auto lower = InRange(input, 'a', 'z');
+			const auto digit = InRange(input, '0', '9');
+			const auto plus  = _mm_cmpeq_epi8(input, _mm_set1_epi8('+'));
+			const auto slash = _mm_cmpeq_epi8(input, _mm_set1_epi8('/'));
+
+			const auto valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)), slash);
+			if (_mm_movemask_epi8(valid) != 0xFFFF)
+				return -1;
+
+			auto shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+			shift      = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+			shift      = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+			shift      = _mm_or_si128(shift, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+			shift      = _mm_or_si128(shift, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+			const auto values = _mm_add_epi8(input, shift);
+
+			// merge 6 bit values to 12 bits per word, then 24 bits per dword, then drop the top byte of each dword
+			const auto words  = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+			const auto dwords = _mm_madd_epi16(words, _mm_set1_epi32(0x00011000));
+			const auto output = _mm_shuffle_epi8(dwords, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index / 4 * 3), output);
+		}
+		return index;
+	}
+	#endif
+
+	size_t EncodeBase64Scalar(const uint8_t* data, const size_t size, char* destination) {
+		size_t index   = 0;
+		size_t written = 0;
+		for (; index + 3 <= size; index += 3) {
+			const uint32_t value    = data[index] << 16 | data[index + 1] << 8 | data[index + 2];
+			destination[written++] = Base64Alphabet[value >> 18];
+			destination[written++] = Base64Alphabet[value >> 12 & 0x3F];
+			destination[written++] = Base64Alphabet[value >> 6 & 0x3F];
+			destination[written++] = Base64Alphabet[value & 0x3F];
+		}
+
+		if (index < size) {
+			const uint32_t value    = data[index] << 16 | (index + 1 < size ? data[index + 1] << 8 : 0);
+			destination[written++] = Base64Alphabet[value >> 18];
+			destination[written++] = Base64Alphabet[value >> 12 & 0x3F];
+			destination[written++] = index + 1 < size ? Base64Alphabet[value >> 6 & 0x3F] : '=';
+			destination[written++] = '=';
+		}
+		return written;
+	}
+
+	/**
+	 * \brief Decode whole quanta without padding
+	 * \return false if text is invalid
+	 */
+	bool DecodeBase64Scalar(const uint8_t* data, const size_t size, char* destination) {
+		for (size_t index = 0; index < size; index += 4) {
+			const auto a = Base64Table[data[index]];
+			const auto b = Base64Table[data[index + 1]];
+			const auto c = Base64Table[data[index + 2]];
+			const auto d = Base64Table[data[index + 3]];
+			if ((a | b | c | d) == Invalid)
+				return false;
+
+			const uint32_t value = a << 18 | b << 12 | c << 6 | d;
+			auto*          out   = destination + index / 4 * 3;
+			out[0]               = static_cast<char>(value >> 16);
+			out[1]               = static_cast<char>(value >> 8);
+			out[2]               = static_cast<char>(value);
+		}
+		return true;
+	}
+
+	size_t EncodeHexBlock(const uint8_t* data, const size_t size, char* destination, const bool upperCase) {
+		size_t index = 0;
+		#if defined(VIS_CORE_BINARY_TEXT_SSE2)
+		const auto nibble = _mm_set1_epi8(0x0F);
+		const auto zero   = _mm_set1_epi8('0');
+		const auto nine   = _mm_set1_epi8(9);
+		const auto alpha  = _mm_set1_epi8(upperCase ? 'A' - '0' - 10 : 'a' - '0' - 10);
+		for (; index + 16 <= size; index += 16) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+			auto       high  = _mm_and_si128(_mm_srli_epi16(input, 4), nibble);
+			auto       low   = _mm_and_si128(input, nibble);
+			high             = _mm_add_epi8(_mm_add_epi8(high, zero), _mm_and_si128(_mm_cmpgt_epi8(high, nine), alpha));
+			low              = _mm_add_epi8(_mm_add_epi8(low, zero), _mm_and_si128(_mm_cmpgt_epi8(low, nine), alpha));
+
+			auto* out = reinterpret_cast<__m128i*>(destination + index * 2);
+			_mm_storeu_si128(out, _mm_unpacklo_epi8(high, low));
+			_mm_storeu_si128(out + 1, _mm_unpackhi_epi8(high, low));
+		}
+		#endif
+
+		const auto* digits = upperCase ? HexUpper : HexLower;
+		for (; index < size; ++index) {
+			destination[index * 2]     = digits[data[index] >> 4];
+			destination[index * 2 + 1] = digits[data[index] & 0x0F];
+		}
+		return size * 2;
+	}
+
+	bool DecodeHexBlock(const uint8_t* data, const size_t size, char* destination) {
+		size_t index = 0;
+		#if defined(VIS_CORE_BINARY_TEXT_SSE2)
+		const auto toNibbles = [](const __m128i input, bool& valid) {
+			const auto digit  = InRange(input, '0', '9');
+			const auto folded = _mm_or_si128(input, _mm_set1_epi8(0x20));
+			const auto letter = InRange(folded, 'a', 'f');
+			valid             = valid && _mm_movemask_epi8(_mm_or_si128(digit, letter)) == 0xFFFF;
+
+			const auto value = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(input, _mm_set1_epi8('0'))),
+			                                _mm_and_si128(letter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+			// first character of each pair is the high nibble
+			return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(value, 8));
+		};
+
+		for (; index + 32 <= size; index += 32) {
+			bool       valid = true;
+			const auto first = toNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)), valid);
+			const auto last  = toNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index + 16)), valid);
+			if (!valid)
+				return false;
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index / 2), _mm_packus_epi16(first, last));
+		}
+		#endif
+
+		for (; index < size; index += 2) {
+			const auto high = HexTable[data[index]];
+			const auto low  = HexTable[data[index + 1]];
+			if ((high | low) == Invalid)
+				return false;
+
+			destination[index / 2] = static_cast<char>(high << 4 | low);
+		}
+		return true;
+	}
+
+	/**
+	 * \brief Bytes left from current position to end, position is kept
+	 * \return remaining size, -1 if stream can not seek
+	 */
+	size_t GetRemaining(Streaming::IStreaming* source) {
+		const auto position = source->Tell();
+		const auto end      = source->Seek(0, Streaming::SeekMode::SeekEnd);
+		if (end == static_cast<size_t>(-1) || end < position)
+			return -1;
+
+		if (source->Seek(static_cast<int64_t>(position)) == static_cast<size_t>(-1))
+			return -1;
+
+		return end - position;
+	}
+
+	/**
+	 * \brief Output of streamed convert, written in place for plain contiguous types and through Update()
+	 *		  from a staging block for others
+	 */
+	class ChunkOutput {
+	public:
+		explicit ChunkOutput(Buffer::IBuffer& buffer) : Target(buffer), Data(Buffer::GetDirectWriteData(buffer)) {
+		}
+
+		/**
+		 * \brief Get memory for next piece of at most size bytes
+		 */
+		char* Reserve(const size_t size) {
+			if (Data)
+				return Data + Written;
+
+			if (Staging.size() < size)
+				Staging.resize(size);
+			return Staging.data();
+		}
+
+		/**
+		 * \brief Append size bytes of last reserved memory
+		 */
+		bool Commit(const size_t size) {
+			if (!Data && size && !Target.Update(Written, size, Staging.data()))
+				return false;
+
+			Written += size;
+			return true;
+		}
+
+		size_t Written = 0;
+
+	private:
+		Buffer::IBuffer&  Target;
+		char*             Data;
+		std::vector<char> Staging;
+	};
+
+	/**
+	 * \brief Read size bytes of source in chunks, pass them to convert in pieces of whole quanta,
+	 *		  quantum split by chunk boundary is joined first, short tail is passed last
+	 */
+	template<typename Convert>
+	bool ReadQuanta(Streaming::IStreaming* source, const size_t size, size_t chunkSize, const size_t quantum,
+	                Convert&& convert) {
+		chunkSize       = std::max(chunkSize / quantum * quantum, quantum);
+		const auto chunk = Buffer::CreateUninitializedBuffer(Buffer::BufferType::Constraint, std::min(chunkSize, size), {});
+
+		char   carry[4];
+		size_t carrySize = 0;
+		size_t done      = 0;
+		while (done < size) {
+			const auto read = source->Read(chunk.get(), std::min(chunk->GetLength(), size - done));
+			if (read == 0 || read == static_cast<size_t>(-1))
+				return false;
+
+			done += read;
+			const auto* data   = chunk->GetData();
+			auto        length = read;
+			if (carrySize) {
+				const auto take = std::min(quantum - carrySize, length);
+				memcpy(carry + carrySize, data, take);
+				carrySize += take;
+				data += take;
+				length -= take;
+				if (carrySize < quantum)
+					continue;
+
+				if (!convert(carry, quantum))
+					return false;
+				carrySize = 0;
+			}
+
+			const auto whole = length / quantum * quantum;
+			if (whole && !convert(data, whole))
+				return false;
+
+			carrySize = length - whole;
+			memcpy(carry, data + whole, carrySize);
+		}
+
+		return carrySize == 0 || convert(carry, carrySize);
+	}
+}
+
+size_t Text::GetBase64EncodedSize(const size_t size) {
+	return (size + 2) / 3 * 4;
+}
+
+size_t Text::GetBase64DecodedSize(const char* data, const size_t size) {
+	if (size % 4)
+		return -1;
+
+	if (size == 0)
+		return 0;
+
+	return size / 4 * 3 - (data[size - 1] == '=') - (data[size - 2] == '=');
+}
+
+size_t Text::EncodeBase64(const char* data, const size_t size, char* destination) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Text::EncodeBase64", size);
+
+	const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+	size_t      index = 0;
+	#if defined(VIS_CORE_BINARY_TEXT_SSSE3)
+	if (HasSsse3())
+		index = EncodeBase64Ssse3(bytes, size, destination);
+	#endif
+
+	return index / 3 * 4 + EncodeBase64Scalar(bytes + index, size - index, destination + index / 3 * 4);
+}
+
+size_t Text::DecodeBase64(const char* data, const size_t size, char* destination) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Text::DecodeBase64", size);
+
+	if (size % 4)
+		return -1;
+
+	if (size == 0)
+		return 0;
+
+	// last quantum may carry padding, everything before is 4 characters to 3 bytes
+	const auto body  = size - 4;
+	size_t     index = 0;
+	#if defined(VIS_CORE_BINARY_TEXT_SSSE3)
+	// each step stores 16 bytes for 12, keep 8 characters behind so overrun stays inside output
+	if (size >= 24 && HasSsse3()) {
+		index = DecodeBase64Ssse3(data, size - 8, destination);
+		if (index == static_cast<size_t>(-1))
+			return -1;
+	}
+	#endif
+
+	const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+	if (!DecodeBase64Scalar(bytes + index, body - index, destination + index / 4 * 3))
+		return -1;
+
+	const auto* last    = bytes + body;
+	const auto  padding = (last[3] == '=') + (last[2] == '=');
+	if (padding == 1 && last[2] == '=')
+		return -1;
+
+	const auto a = Base64Table[last[0]];
+	const auto b = Base64Table[last[1]];
+	const auto c = padding >= 2 ? 0 : Base64Table[last[2]];
+	const auto d = padding >= 1 ? 0 : Base64Table[last[3]];
+	if ((a | b | c | d) == Invalid)
+		return -1;
+
+	const uint32_t value   = a << 18 | b << 12 | c << 6 | d;
+	auto*          out     = destination + body / 4 * 3;
+	const auto     written = 3 - padding;
+	out[0]                 = static_cast<char>(value >> 16);
+	if (written > 1)
+		out[1] = static_cast<char>(value >> 8);
+	if (written > 2)
+		out[2] = static_cast<char>(value);
+
+	return body / 4 * 3 + written;
+}
+
+Buffer::IBufferPtr Text::EncodeBase64(const Buffer::IBuffer& source, const Buffer::BufferType type) {
+	const auto size   = GetBase64EncodedSize(source.GetLength());
+	auto       buffer = Buffer::CreateUninitializedBuffer(type, size, {});
+	if (buffer && size && !Buffer::FillBuffer(*buffer, [&source](char* output) {
+		EncodeBase64(source.GetData(), source.GetLength(), output);
+		return true;
+	}))
+		return nullptr;
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Text::DecodeBase64(const Buffer::IBuffer& source, const Buffer::BufferType type) {
+	const auto* data = source.GetData();
+	const auto  size = GetBase64DecodedSize(data, source.GetLength());
+	if (size == static_cast<size_t>(-1))
+		return nullptr;
+
+	auto buffer = Buffer::CreateUninitializedBuffer(type, size, {});
+	if (buffer && source.GetLength() && !Buffer::FillBuffer(*buffer, [&](char* output) {
+		return DecodeBase64(data, source.GetLength(), output) != static_cast<size_t>(-1);
+	}))
+		return nullptr;
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Text::EncodeBase64(Streaming::IStreaming* source, const Buffer::BufferType type,
+                                      const size_t chunkSize) {
+	const auto remaining = source ? GetRemaining(source) : static_cast<size_t>(-1);
+	if (remaining == static_cast<size_t>(-1))
+		return nullptr;
+
+	auto buffer = Buffer::CreateUninitializedBuffer(type, GetBase64EncodedSize(remaining), {});
+	if (!buffer || remaining == 0)
+		return buffer;
+
+	ChunkOutput output(*buffer);
+	if (!ReadQuanta(source, remaining, chunkSize, 3, [&output](const char* data, const size_t size) {
+		return output.Commit(EncodeBase64(data, size, output.Reserve(GetBase64EncodedSize(size))));
+	}))
+		return nullptr;
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Text::DecodeBase64(Streaming::IStreaming* source, const Buffer::BufferType type,
+                                      const size_t chunkSize) {
+	const auto remaining = source ? GetRemaining(source) : static_cast<size_t>(-1);
+	if (remaining == static_cast<size_t>(-1) || remaining % 4)
+		return nullptr;
+
+	if (remaining == 0)
+		return Buffer::CreateUninitializedBuffer(type, 0, {});
+
+	// padding decides exact size, peek last 2 characters
+	const auto position = source->Tell();
+	const auto tail     = Buffer::CreateUninitializedBuffer(Buffer::BufferType::Constraint, 2, {});
+	if (source->Seek(static_cast<int64_t>(position + remaining - 2)) == static_cast<size_t>(-1) ||
+	    source->Read(tail.get(), 2) != 2 || source->Seek(static_cast<int64_t>(position)) == static_cast<size_t>(-1))
+		return nullptr;
+
+	const auto* last   = tail->GetData();
+	const auto  size   = remaining / 4 * 3 - (last[1] == '=') - (last[0] == '=');
+	auto        buffer = Buffer::CreateUninitializedBuffer(type, size, {});
+	if (!buffer)
+		return nullptr;
+
+	// only last piece may hold padding, earlier pieces must decode to 3 bytes per quantum
+	ChunkOutput output(*buffer);
+	if (!ReadQuanta(source, remaining, chunkSize, 4, [&](const char* data, const size_t length) {
+		const auto decoded = DecodeBase64(data, length, output.Reserve(length / 4 * 3));
+		if (decoded == static_cast<size_t>(-1) || output.Written + decoded > size || !output.Commit(decoded))
+			return false;
+
+		return decoded == length / 4 * 3 || output.Written == size;
+	}) || output.Written != size)
+		return nullptr;
+
+	return buffer;
+}
+
+size_t Text::GetHexEncodedSize(const size_t size) {
+	return size * 2;
+}
+
+size_t Text::GetHexDecodedSize(const size_t size) {
+	return size % 2 ? -1 : size / 2;
+}
+
+size_t Text::EncodeHex(const char* data, const size_t size, char* destination, const bool upperCase) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Text::EncodeHex", size);
+
+	return EncodeHexBlock(reinterpret_cast<const uint8_t*>(data), size, destination, upperCase);
+}
+
+size_t Text::DecodeHex(const char* data, const size_t size, char* destination) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Text::DecodeHex", size);
+
+	if (size % 2 || !DecodeHexBlock(reinterpret_cast<const uint8_t*>(data), size, destination))
+		return -1;
+
+	return size / 2;
+}
+
+Buffer::IBufferPtr Text::EncodeHex(const Buffer::IBuffer& source, const bool upperCase, const Buffer::BufferType type) {
+	const auto size   = GetHexEncodedSize(source.GetLength());
+	auto       buffer = Buffer::CreateUninitializedBuffer(type, size, {});
+	if (buffer && size && !Buffer::FillBuffer(*buffer, [&source, upperCase](char* output) {
+		EncodeHex(source.GetData(), source.GetLength(), output, upperCase);
+		return true;
+	}))
+		return nullptr;
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Text::DecodeHex(const Buffer::IBuffer& source, const Buffer::BufferType type) {
+	const auto size = GetHexDecodedSize(source.GetLength());
+	if (size == static_cast<size_t>(-1))
+		return nullptr;
+
+	auto buffer = Buffer::CreateUninitializedBuffer(type, size, {});
+	if (buffer && size && !Buffer::FillBuffer(*buffer, [&source](char* output) {
+		return DecodeHex(source.GetData(), source.GetLength(), output) != static_cast<size_t>(-1);
+	}))
+		return nullptr;
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Text::EncodeHex(Streaming::IStreaming* source, const bool upperCase, const Buffer::BufferType type,
+                                   const size_t chunkSize) {
+	const auto remaining = source ? GetRemaining(source) : static_cast<size_t>(-1);
+	if (remaining == static_cast<size_t>(-1))
+		return nullptr;
+
+	auto buffer = Buffer::CreateUninitializedBuffer(type, GetHexEncodedSize(remaining), {});
+	if (!buffer || remaining == 0)
+		return buffer;
+
+	ChunkOutput output(*buffer);
+	if (!ReadQuanta(source, remaining, chunkSize, 1, [&output, upperCase](const char* data, const size_t size) {
+		return output.Commit(EncodeHex(data, size, output.Reserve(GetHexEncodedSize(size)), upperCase));
+	}))
+		return nullptr;
+
+	return buffer;
+}
+
+Buffer::IBufferPtr Text::DecodeHex(Streaming::IStreaming* source, const Buffer::BufferType type,
+                                   const size_t chunkSize) {
+	const auto remaining = source ? GetRemaining(source) : static_cast<size_t>(-1);
+	if (remaining == static_cast<size_t>(-1) || remaining % 2)
+		return nullptr;
+
+	auto buffer = Buffer::CreateUninitializedBuffer(type, remaining / 2, {});
+	if (!buffer || remaining == 0)
+		return buffer;
+
+	ChunkOutput output(*buffer);
+	if (!ReadQuanta(source, remaining, chunkSize, 2, [&output](const char* data, const size_t size) {
+		const auto decoded = DecodeHex(data, size, output.Reserve(size / 2));
+		return decoded != static_cast<size_t>(-1) && output.Commit(decoded);
+	}))
+		return nullptr;
+
+	return buffer;
+}
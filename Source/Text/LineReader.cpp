@@ -0,0 +1,223 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Text/LineReader.h"
+#include "Buffer/BufferFactory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VIS_CORE_LINE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIS_CORE_LINE_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Text;
+
+namespace {
+	constexpr size_t BlockSize = 64;
+
+	/**
+	 * \brief Bit i is set if block[i] == value, block has BlockSize bytes
+	 */
+	uint64_t MatchMask(const char* block, const char value) {
+		#if defined(VIS_CORE_LINE_AVX2)
+		const auto needle = _mm256_set1_epi8(value);
+		const auto low    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+		const auto high   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+		const auto lowMask  = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+		const auto highMask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+		return lowMask | static_cast<uint64_t>(highMask) << 32;
+		#elif defined(VIS_CORE_LINE_SSE2)
+		const auto needle = _mm_set1_epi8(value);
+		uint64_t   mask   = 0;
+		for (size_t lane = 0; lane < 4; ++lane) {
+			const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + lane * 16));
+			const auto bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, needle)));
+			mask |= static_cast<uint64_t>(bits) << (lane * 16);
+		}
+		return mask;
+		#else
+		uint64_t mask = 0;
+		for (size_t index = 0; index < BlockSize; ++index) {
+			mask |= static_cast<uint64_t>(block[index] == value) << index;
+		}
+		return mask;
+		#endif
+	}
+
+	/**
+	 * \brief Index of lowest set bit, mask must not be 0
+	 */
+	size_t LowestBit(const uint64_t mask) {
+		#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, mask);
+		return index;
+		#else
+		return static_cast<size_t>(__builtin_ctzll(mask));
+		#endif
+	}
+}
+
+LineReader::LineReader(Streaming::IStreaming* stream, const LineReaderOptions& options)
+	: Stream(stream), Options(options) {
+	if (Options.Delimiter.empty())
+		Options.Delimiter = "\n";
+
+	// chunk must hold at least one delimiter
+	Options.ChunkSize = std::max(Options.ChunkSize, std::max(Options.Delimiter.size(), BlockSize));
+	Chunk = Buffer::CreateUninitializedBuffer(Buffer::BufferType::Constraint, Options.ChunkSize, {});
+}
+
+bool LineReader::Next(std::string_view& line) {
+	if (CarryReturned) {
+		Carry.clear();
+		CarryReturned = false;
+	}
+
+	const auto& delimiter = Options.Delimiter;
+	const auto  length    = delimiter.size();
+	for (;;) {
+		if (Begin < End) {
+			// delimiter may start in carried head and end in this chunk
+			if (!Carry.empty() && length > 1) {
+				const auto tail  = std::min(length - 1, Carry.size());
+				auto       probe = Carry.substr(Carry.size() - tail);
+				probe.append(Begin, std::min(length - 1, static_cast<size_t>(End - Begin)));
+
+				const auto found = probe.find(delimiter);
+				if (found != std::string::npos && found < tail) {
+					Carry.resize(Carry.size() - tail + found);
+					Begin += found + length - tail;
+					CarryReturned = true;
+					line = Yield(Carry.data(), Carry.size());
+					return true;
+				}
+			}
+
+			const auto* found = FindDelimiter(Begin);
+			if (!found) {
+				// record continues in next chunk
+				Carry.append(Begin, End);
+				Begin = End;
+				continue;
+			}
+
+			const auto* start = Begin;
+			Begin             = found + length;
+			if (Carry.empty()) {
+				line = Yield(start, found - start);
+				return true;
+			}
+
+			Carry.append(start, found);
+			CarryReturned = true;
+			line = Yield(Carry.data(), Carry.size());
+			return true;
+		}
+
+		if (!Fill()) {
+			if (Failed || Carry.empty())
+				return false;
+
+			// last record without delimiter
+			CarryReturned = true;
+			line = Yield(Carry.data(), Carry.size());
+			return true;
+		}
+	}
+}
+
+uint64_t LineReader::GetLineCount() const {
+	return Lines;
+}
+
+bool LineReader::IsFailed() const {
+	return Failed;
+}
+
+const char* LineReader::FindFirstByte(const char* from) {
+	const auto value = Options.Delimiter.front();
+	for (;;) {
+		if (MaskBase && from >= MaskBase && from < MaskBase + BlockSize) {
+			const auto bits = Mask & (~uint64_t(0) << (from - MaskBase));
+			if (bits)
+				return MaskBase + LowestBit(bits);
+
+			from = MaskBase + BlockSize;
+		}
+
+		if (from >= End)
+			return nullptr;
+
+		if (static_cast<size_t>(End - from) < BlockSize)
+			return static_cast<const char*>(memchr(from, value, End - from));
+
+		// keep mask of whole block, following records in same block cost one bit scan each
+		MaskBase = from;
+		Mask     = MatchMask(from, value);
+	}
+}
+
+const char* LineReader::FindDelimiter(const char* from) {
+	const auto& delimiter = Options.Delimiter;
+	const auto  length    = delimiter.size();
+	for (;;) {
+		const auto* found = FindFirstByte(from);
+		if (!found || length == 1)
+			return found;
+
+		// partial delimiter at chunk end is matched by carry probe after next Fill()
+		if (static_cast<size_t>(End - found) < length)
+			return nullptr;
+
+		if (memcmp(found + 1, delimiter.data() + 1, length - 1) == 0)
+			return found;
+
+		from = found + 1;
+	}
+}
+
+bool LineReader::Fill() {
+	if (Eof || !Stream)
+		return false;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Text::LineRead", Options.ChunkSize);
+
+	const auto read = Stream->Read(Chunk.get(), Options.ChunkSize);
+	if (read == static_cast<size_t>(-1)) {
+		Failed = true;
+		Eof    = true;
+		return false;
+	}
+
+	if (read == 0) {
+		Eof = true;
+		return false;
+	}
+
+	Begin    = Chunk->GetData();
+	End      = Begin + std::min(read, Chunk->GetLength());
+	MaskBase = nullptr;
+	return true;
+}
+
+std::string_view LineReader::Yield(const char* data, size_t size) {
+	if (Options.TrimCarriageReturn && size && data[size - 1] == '\r')
+		--size;
+
+	++Lines;
+	return {data, size};
+}
@@ -0,0 +1,766 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Text/Unicode.h"
+#include "Buffer/BufferFactory.h"
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIS_CORE_UNICODE_SSE2 1
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VIS_CORE_UNICODE_AVX2 1
+#define VIS_CORE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Text;
+
+namespace {
+	/**
+	 * \brief Unaligned native order load/store, UTF-16/UTF-32 text may start at any byte
+	 */
+	template<typename T>
+	T LoadUnit(const char* data) {
+		T value;
+		memcpy(&value, data, sizeof(T));
+		return value;
+	}
+
+	template<typename T>
+	void StoreUnit(char* data, const T value) {
+		memcpy(data, &value, sizeof(T));
+	}
+
+	size_t UnitSize(const Encoding encoding) {
+		switch (encoding) {
+			case Encoding::Utf16:
+				return 2;
+			case Encoding::Utf32:
+				return 4;
+			default:
+				return 1;
+		}
+	}
+
+	bool IsContinuation(const uint8_t value) {
+		return (value & 0xC0) == 0x80;
+	}
+
+	/**
+	 * \brief True if 8 bytes at data are ASCII
+	 */
+	bool IsAscii8(const uint8_t* data) {
+		return (LoadUnit<uint64_t>(reinterpret_cast<const char*>(data)) & 0x8080808080808080ull) == 0;
+	}
+
+	bool ValidateUtf8Scalar(const uint8_t* data, const size_t size) {
+		size_t index = 0;
+		while (index < size) {
+			if (index + 8 <= size && IsAscii8(data + index)) {
+				index += 8;
+				continue;
+			}
+
+			const auto lead = data[index];
+			if (lead < 0x80) {
+				++index;
+			} else if ((lead & 0xE0) == 0xC0) {
+				if (lead < 0xC2 || index + 1 >= size || !IsContinuation(data[index + 1]))
+					return false;
+				index += 2;
+			} else if ((lead & 0xF0) == 0xE0) {
+				if (index + 2 >= size || !IsContinuation(data[index + 1]) || !IsContinuation(data[index + 2]))
+					return false;
+				// overlong and surrogate
+				if ((lead == 0xE0 && data[index + 1] < 0xA0) || (lead == 0xED && data[index + 1] >= 0xA0))
+					return false;
+				index += 3;
+			} else if ((lead & 0xF8) == 0xF0) {
+				if (lead > 0xF4 || index + 3 >= size || !IsContinuation(data[index + 1]) ||
+				    !IsContinuation(data[index + 2]) || !IsContinuation(data[index + 3]))
+					return false;
+				// overlong and above U+10FFFF
+				if ((lead == 0xF0 && data[index + 1] < 0x90) || (lead == 0xF4 && data[index + 1] >= 0x90))
+					return false;
+				index += 4;
+			} else {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	#if defined(VIS_CORE_UNICODE_AVX2)
+	/**
+	 * \brief Lookup validation of Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte".
+	 *		  Each byte pair is classified by three nibble table lookups, bits left after AND are errors
+	 */
+	class Utf8CheckerAvx2 {
+	public:
+		VIS_CORE_TARGET_AVX2 Utf8CheckerAvx2()
+			: Error(_mm256_setzero_si256()), Incomplete(_mm256_setzero_si256()), Previous(_mm256_setzero_si256()) {
+		}
+
+		VIS_CORE_TARGET_AVX2 void Check(const __m256i& input) {
+			if (_mm256_movemask_epi8(input) == 0) {
+				// ASCII block is fine unless previous block ended inside a sequence
+				Error      = _mm256_or_si256(Error, Incomplete);
+				Incomplete = _mm256_setzero_si256();
+				Previous   = input;
+				return;
+			}
+
+			constexpr char TooShort  = 1 << 0;
+			constexpr char TooLong   = 1 << 1;
+			constexpr char Overlong3 = 1 << 2;
+			constexpr char TooLarge  = 1 << 3;
+			constexpr char Surrogate = 1 << 4;
+			constexpr char Overlong2 = 1 << 5;
+			constexpr char Large1000 = 1 << 6;
+			constexpr char Overlong4 = 1 << 6;
+			constexpr char TwoConts  = static_cast<char>(1 << 7);
+			constexpr char Carry     = TooShort | TooLong | TwoConts;
+
+			// input shifted right by 1, 2, 3 bytes with tail of previous block shifted in
+			const auto lowNibble = _mm256_set1_epi8(0x0F);
+			const auto shifted   = _mm256_permute2x128_si256(Previous, input, 0x21);
+			const auto prev1     = _mm256_alignr_epi8(input, shifted, 15);
+
+			const auto byte1High = _mm256_shuffle_epi8(_mm256_setr_epi8(
+				TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+				TwoConts, TwoConts, TwoConts, TwoConts,
+				TooShort | Overlong2, TooShort, TooShort | Overlong3 | Surrogate,
+				TooShort | TooLarge | Large1000 | Overlong4,
+				TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+				TwoConts, TwoConts, TwoConts, TwoConts,
+				TooShort | Overlong2, TooShort, TooShort | Overlong3 | Surrogate,
+				TooShort | TooLarge | Large1000 | Overlong4), _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibble));
+
+			const auto byte1Low = _mm256_shuffle_epi8(_mm256_setr_epi8(
+				Carry | Overlong3 | Overlong2 | Overlong4, Carry | Overlong2, Carry, Carry,
+				Carry | TooLarge, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000,
+				Carry | TooLarge | Large1000, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000,
+				Carry | TooLarge | Large1000, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000 | Surrogate,
+				Carry | TooLarge | Large1000, Carry | TooLarge | Large1000,
+				Carry | Overlong3 | Overlong2 | Overlong4, Carry | Overlong2, Carry, Carry,
+				Carry | TooLarge, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000,
+				Carry | TooLarge | Large1000, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000,
+				Carry | TooLarge | Large1000, Carry | TooLarge | Large1000, Carry | TooLarge | Large1000 | Surrogate,
+				Carry | TooLarge | Large1000, Carry | TooLarge | Large1000), _mm256_and_si256(prev1, lowNibble));
+
+			const auto byte2High = _mm256_shuffle_epi8(_mm256_setr_epi8(
+				TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+				TooLong | Overlong2 | TwoConts | Overlong3 | Large1000 | Overlong4,
+				TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+				TooShort, TooShort, TooShort, TooShort,
+				TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+				TooLong | Overlong2 | TwoConts | Overlong3 | Large1000 | Overlong4,
+				TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+				TooShort, TooShort, TooShort, TooShort), _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibble));
+
+			const auto special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+			// third and fourth byte of 3/4 byte sequences must be continuation, other continuations are errors above
+			const auto third  = _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 14), _mm256_set1_epi8(0xE0 - 0x80));
+			const auto fourth = _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 13), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+			const auto must   = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+			Error = _mm256_or_si256(Error, _mm256_xor_si256(must, special));
+
+			// lead byte in last 3 bytes whose sequence does not fit in block
+			Incomplete = _mm256_subs_epu8(input, _mm256_setr_epi8(
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1)));
+			Previous = input;
+		}
+
+		VIS_CORE_TARGET_AVX2 bool IsValid() {
+			const auto error = _mm256_or_si256(Error, Incomplete);
+			return _mm256_testz_si256(error, error) != 0;
+		}
+
+	private:
+		__m256i Error;
+		__m256i Incomplete;
+		__m256i Previous;
+	};
+
+	VIS_CORE_TARGET_AVX2 bool ValidateUtf8Avx2(const uint8_t* data, const size_t size) {
+		Utf8CheckerAvx2 checker;
+		size_t          index = 0;
+		for (; index + 32 <= size; index += 32) {
+			checker.Check(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index)));
+		}
+
+		if (index < size) {
+			// zero padding is ASCII, truncated sequence at end shows up as too short
+			alignas(32) uint8_t tail[32] = {};
+			memcpy(tail, data + index, size - index);
+			checker.Check(_mm256_load_si256(reinterpret_cast<const __m256i*>(tail)));
+		}
+
+		return checker.IsValid();
+	}
+
+	bool HasAvx2() {
+		static const bool supported = __builtin_cpu_supports("avx2");
+		return supported;
+	}
+	#endif
+
+	bool ValidateUtf16(const char* data, const size_t size) {
+		if (size % 2)
+			return false;
+
+		const auto count = size / 2;
+		for (size_t index = 0; index < count; ++index) {
+			const auto unit = LoadUnit<uint16_t>(data + index * 2);
+			if (unit < 0xD800 || unit > 0xDFFF)
+				continue;
+
+			// high surrogate followed by low surrogate
+			if (unit > 0xDBFF || index + 1 >= count)
+				return false;
+
+			const auto next = LoadUnit<uint16_t>(data + (index + 1) * 2);
+			if (next < 0xDC00 || next > 0xDFFF)
+				return false;
+			++index;
+		}
+
+		return true;
+	}
+
+	bool ValidateUtf32(const char* data, const size_t size) {
+		if (size % 4)
+			return false;
+
+		for (size_t offset = 0; offset < size; offset += 4) {
+			const auto value = LoadUnit<uint32_t>(data + offset);
+			if (value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF))
+				return false;
+		}
+
+		return true;
+	}
+
+	//--------------- size of valid text -----------------
+
+	/**
+	 * \brief Count bytes that are not continuation, and 4 byte leads when withLong is set
+	 */
+	size_t CountUtf8(const uint8_t* data, const size_t size, const bool withLong) {
+		size_t count = 0;
+		size_t index = 0;
+		#if defined(VIS_CORE_UNICODE_SSE2)
+		const auto continuation = _mm_set1_epi8(static_cast<char>(0xBF));
+		const auto longLead     = _mm_set1_epi8(static_cast<char>(0xEF));
+		for (; index + 16 <= size; index += 16) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+			// signed compare, continuation bytes are -128..-65
+			const auto lead = _mm_movemask_epi8(_mm_cmpgt_epi8(input, continuation));
+			count += __builtin_popcount(static_cast<unsigned>(lead));
+			if (withLong) {
+				// 0xF0.. as unsigned is above 0xEF, flip sign bit for unsigned compare
+				const auto flip  = _mm_set1_epi8(static_cast<char>(0x80));
+				const auto large = _mm_cmpgt_epi8(_mm_xor_si128(input, flip), _mm_xor_si128(longLead, flip));
+				count += __builtin_popcount(static_cast<unsigned>(_mm_movemask_epi8(large)));
+			}
+		}
+		#endif
+
+		for (; index < size; ++index) {
+			count += !IsContinuation(data[index]);
+			count += withLong && data[index] >= 0xF0;
+		}
+		return count;
+	}
+
+	size_t Utf8SizeOfUtf16(const char* data, const size_t size) {
+		size_t bytes = 0;
+		for (size_t offset = 0; offset < size; offset += 2) {
+			const auto unit = LoadUnit<uint16_t>(data + offset);
+			// each surrogate of a pair counts 2 bytes
+			bytes += unit < 0x80 ? 1 : unit < 0x800 ? 2 : unit >= 0xD800 && unit <= 0xDFFF ? 2 : 3;
+		}
+		return bytes;
+	}
+
+	size_t Utf8SizeOfUtf32(const char* data, const size_t size) {
+		size_t bytes = 0;
+		for (size_t offset = 0; offset < size; offset += 4) {
+			const auto value = LoadUnit<uint32_t>(data + offset);
+			bytes += value < 0x80 ? 1 : value < 0x800 ? 2 : value < 0x10000 ? 3 : 4;
+		}
+		return bytes;
+	}
+
+	size_t CountLowSurrogates(const char* data, const size_t size) {
+		size_t count = 0;
+		for (size_t offset = 0; offset < size; offset += 2) {
+			const auto unit = LoadUnit<uint16_t>(data + offset);
+			count += unit >= 0xDC00 && unit <= 0xDFFF;
+		}
+		return count;
+	}
+
+	size_t CountSupplementary(const char* data, const size_t size) {
+		size_t count = 0;
+		for (size_t offset = 0; offset < size; offset += 4) {
+			count += LoadUnit<uint32_t>(data + offset) > 0xFFFF;
+		}
+		return count;
+	}
+
+	//--------------- convert valid text -----------------
+
+	/**
+	 * \brief Decode one sequence of valid UTF-8
+	 */
+	uint32_t DecodeUtf8(const uint8_t* data, size_t& index) {
+		const uint32_t lead = data[index];
+		if (lead < 0x80) {
+			index += 1;
+			return lead;
+		}
+		if (lead < 0xE0) {
+			const auto value = (lead & 0x1F) << 6 | (data[index + 1] & 0x3F);
+			index += 2;
+			return value;
+		}
+		if (lead < 0xF0) {
+			const auto value = (lead & 0x0F) << 12 | (data[index + 1] & 0x3F) << 6 | (data[index + 2] & 0x3F);
+			index += 3;
+			return value;
+		}
+
+		const auto value = (lead & 0x07) << 18 | (data[index + 1] & 0x3F) << 12 | (data[index + 2] & 0x3F) << 6 |
+		                   (data[index + 3] & 0x3F);
+		index += 4;
+		return value;
+	}
+
+	/**
+	 * \brief Encode one code point as UTF-8
+	 * \return written bytes
+	 */
+	size_t EncodeUtf8(const uint32_t value, char* destination) {
+		if (value < 0x80) {
+			destination[0] = static_cast<char>(value);
+			return 1;
+		}
+		if (value < 0x800) {
+			destination[0] = static_cast<char>(0xC0 | value >> 6);
+			destination[1] = static_cast<char>(0x80 | (value & 0x3F));
+			return 2;
+		}
+		if (value < 0x10000) {
+			destination[0] = static_cast<char>(0xE0 | value >> 12);
+			destination[1] = static_cast<char>(0x80 | (value >> 6 & 0x3F));
+			destination[2] = static_cast<char>(0x80 | (value & 0x3F));
+			return 3;
+		}
+
+		destination[0] = static_cast<char>(0xF0 | value >> 18);
+		destination[1] = static_cast<char>(0x80 | (value >> 12 & 0x3F));
+		destination[2] = static_cast<char>(0x80 | (value >> 6 & 0x3F));
+		destination[3] = static_cast<char>(0x80 | (value & 0x3F));
+		return 4;
+	}
+
+	/**
+	 * \brief Encode one code point as UTF-16
+	 * \return written bytes
+	 */
+	size_t EncodeUtf16(const uint32_t value, char* destination) {
+		if (value < 0x10000) {
+			StoreUnit<uint16_t>(destination, static_cast<uint16_t>(value));
+			return 2;
+		}
+
+		const auto offset = value - 0x10000;
+		StoreUnit<uint16_t>(destination, static_cast<uint16_t>(0xD800 | offset >> 10));
+		StoreUnit<uint16_t>(destination + 2, static_cast<uint16_t>(0xDC00 | (offset & 0x3FF)));
+		return 4;
+	}
+
+	/**
+	 * \brief Decode one code point of valid UTF-16
+	 */
+	uint32_t DecodeUtf16(const char* data, size_t& offset) {
+		const uint32_t unit = LoadUnit<uint16_t>(data + offset);
+		offset += 2;
+		if (unit < 0xD800 || unit > 0xDBFF)
+			return unit;
+
+		const uint32_t low = LoadUnit<uint16_t>(data + offset);
+		offset += 2;
+		return 0x10000 + ((unit - 0xD800) << 10 | (low - 0xDC00));
+	}
+
+	/**
+	 * \brief Widen 16 ASCII bytes at a time, decode others one by one
+	 */
+	size_t Utf8ToUtf16(const uint8_t* data, const size_t size, char* destination) {
+		size_t index   = 0;
+		size_t written = 0;
+		while (index < size) {
+			#if defined(VIS_CORE_UNICODE_SSE2)
+			if (index + 16 <= size) {
+				const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+				if (_mm_movemask_epi8(input) == 0) {
+					const auto zero = _mm_setzero_si128();
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + written), _mm_unpacklo_epi8(input, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + written + 16), _mm_unpackhi_epi8(input, zero));
+					index += 16;
+					written += 32;
+					continue;
+				}
+			}
+			#endif
+
+			// decode until next 16 byte block, CJK text rarely has ASCII runs
+			const auto stop = std::min(size, index + 16);
+			while (index < stop) {
+				written += EncodeUtf16(DecodeUtf8(data, index), destination + written);
+			}
+		}
+		return written;
+	}
+
+	size_t Utf8ToUtf32(const uint8_t* data, const size_t size, char* destination) {
+		size_t index   = 0;
+		size_t written = 0;
+		while (index < size) {
+			#if defined(VIS_CORE_UNICODE_SSE2)
+			if (index + 16 <= size) {
+				const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+				if (_mm_movemask_epi8(input) == 0) {
+					const auto zero = _mm_setzero_si128();
+					const auto low  = _mm_unpacklo_epi8(input, zero);
+					const auto high = _mm_unpackhi_epi8(input, zero);
+					auto*      out  = reinterpret_cast<__m128i*>(destination + written);
+					_mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+					_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+					_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+					_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+					index += 16;
+					written += 64;
+					continue;
+				}
+			}
+			#endif
+
+			const auto stop = std::min(size, index + 16);
+			while (index < stop) {
+				StoreUnit<uint32_t>(destination + written, DecodeUtf8(data, index));
+				written += 4;
+			}
+		}
+		return written;
+	}
+
+	/**
+	 * \brief Narrow 8 ASCII units at a time, encode others one by one
+	 */
+	size_t Utf16ToUtf8(const char* data, const size_t size, char* destination) {
+		size_t offset  = 0;
+		size_t written = 0;
+		while (offset < size) {
+			#if defined(VIS_CORE_UNICODE_SSE2)
+			if (offset + 16 <= size) {
+				const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+				const auto high  = _mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xFF80)));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF) {
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + written), _mm_packus_epi16(input, input));
+					offset += 16;
+					written += 8;
+					continue;
+				}
+			}
+			#endif
+
+			const auto stop = std::min(size, offset + 16);
+			while (offset < stop) {
+				written += EncodeUtf8(DecodeUtf16(data, offset), destination + written);
+			}
+		}
+		return written;
+	}
+
+	size_t Utf16ToUtf32(const char* data, const size_t size, char* destination) {
+		size_t offset  = 0;
+		size_t written = 0;
+		while (offset < size) {
+			StoreUnit<uint32_t>(destination + written, DecodeUtf16(data, offset));
+			written += 4;
+		}
+		return written;
+	}
+
+	size_t Utf32ToUtf8(const char* data, const size_t size, char* destination) {
+		size_t written = 0;
+		for (size_t offset = 0; offset < size; offset += 4) {
+			written += EncodeUtf8(LoadUnit<uint32_t>(data + offset), destination + written);
+		}
+		return written;
+	}
+
+	size_t Utf32ToUtf16(const char* data, const size_t size, char* destination) {
+		size_t written = 0;
+		for (size_t offset = 0; offset < size; offset += 4) {
+			written += EncodeUtf16(LoadUnit<uint32_t>(data + offset), destination + written);
+		}
+		return written;
+	}
+
+	/**
+	 * \brief Output size of valid text
+	 */
+	size_t TranscodedSize(const char* data, const size_t size, const Encoding from, const Encoding to) {
+		const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+		switch (from) {
+			case Encoding::Utf8:
+				if (to == Encoding::Utf16)
+					return CountUtf8(bytes, size, true) * 2;
+				if (to == Encoding::Utf32)
+					return CountUtf8(bytes, size, false) * 4;
+				return size;
+			case Encoding::Utf16:
+				if (to == Encoding::Utf8)
+					return Utf8SizeOfUtf16(data, size);
+				if (to == Encoding::Utf32)
+					return (size / 2 - CountLowSurrogates(data, size)) * 4;
+				return size;
+			case Encoding::Utf32:
+				if (to == Encoding::Utf8)
+					return Utf8SizeOfUtf32(data, size);
+				if (to == Encoding::Utf16)
+					return (size / 4 + CountSupplementary(data, size)) * 2;
+				return size;
+			default:
+				return -1;
+		}
+	}
+
+	/**
+	 * \brief Convert valid text
+	 */
+	size_t Convert(const char* data, const size_t size, const Encoding from, char* destination, const Encoding to) {
+		const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+		if (from == to) {
+			if (size)
+				memcpy(destination, data, size);
+			return size;
+		}
+
+		switch (from) {
+			case Encoding::Utf8:
+				return to == Encoding::Utf16 ? Utf8ToUtf16(bytes, size, destination) : Utf8ToUtf32(bytes, size, destination);
+			case Encoding::Utf16:
+				return to == Encoding::Utf8 ? Utf16ToUtf8(data, size, destination) : Utf16ToUtf32(data, size, destination);
+			case Encoding::Utf32:
+				return to == Encoding::Utf8 ? Utf32ToUtf8(data, size, destination) : Utf32ToUtf16(data, size, destination);
+			default:
+				return -1;
+		}
+	}
+
+	/**
+	 * \brief Length of longest prefix that does not end inside a sequence
+	 */
+	size_t CompletePrefix(const char* data, const size_t size, const Encoding encoding) {
+		switch (encoding) {
+			case Encoding::Utf8: {
+				const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+				// walk back over at most 3 continuation bytes to last lead
+				size_t lead = size;
+				for (size_t back = 1; back <= 4 && back <= size; ++back) {
+					if (!IsContinuation(bytes[size - back])) {
+						lead = size - back;
+						break;
+					}
+				}
+				if (lead == size)
+					return size;
+
+				const auto value  = bytes[lead];
+				const auto length = value >= 0xF0 && value <= 0xF4 ? 4 : value >= 0xE0 && value < 0xF0 ? 3 : value >= 0xC2 && value < 0xE0 ? 2 : 1;
+				return lead + length > size ? lead : size;
+			}
+			case Encoding::Utf16: {
+				const auto even = size & ~static_cast<size_t>(1);
+				if (even >= 2) {
+					const auto unit = LoadUnit<uint16_t>(data + even - 2);
+					if (unit >= 0xD800 && unit <= 0xDBFF)
+						return even - 2;
+				}
+				return even;
+			}
+			case Encoding::Utf32:
+				return size & ~static_cast<size_t>(3);
+			default:
+				return size;
+		}
+	}
+}
+
+bool Text::ValidateUtf8(const char* data, const size_t size) {
+	if (!data)
+		return size == 0;
+
+	VIS_CORE_TRACE_SCOPE_BYTES("Text::ValidateUtf8", size);
+
+	const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+	#if defined(VIS_CORE_UNICODE_AVX2)
+	if (size >= 64 && HasAvx2())
+		return ValidateUtf8Avx2(bytes, size);
+	#endif
+
+	return ValidateUtf8Scalar(bytes, size);
+}
+
+bool Text::ValidateUtf8(const Buffer::IBuffer& buffer) {
+	return ValidateUtf8(buffer.GetData(), buffer.GetLength());
+}
+
+bool Text::Validate(const char* data, const size_t size, const Encoding encoding) {
+	if (!data)
+		return size == 0;
+
+	switch (encoding) {
+		case Encoding::Utf8:
+			return ValidateUtf8(data, size);
+		case Encoding::Utf16:
+			return ValidateUtf16(data, size);
+		case Encoding::Utf32:
+			return ValidateUtf32(data, size);
+		default:
+			return false;
+	}
+}
+
+size_t Text::GetTranscodedSize(const char* data, const size_t size, const Encoding from, const Encoding to) {
+	if (!Validate(data, size, from))
+		return -1;
+
+	return TranscodedSize(data, size, from, to);
+}
+
+size_t Text::Transcode(const char* data, const size_t size, const Encoding from, char* destination, const Encoding to) {
+	VIS_CORE_TRACE_SCOPE_BYTES("Text::Transcode", size);
+
+	if (!Validate(data, size, from) || (size && !destination))
+		return -1;
+
+	return Convert(data, size, from, destination, to);
+}
+
+Buffer::IBufferPtr Text::Transcode(const Buffer::IBuffer& source, const Encoding from, const Encoding to,
+                                   const Buffer::BufferType type) {
+	const auto* data = source.GetData();
+	const auto  size = source.GetLength();
+	if (!Validate(data, size, from))
+		return nullptr;
+
+	const auto bytes  = TranscodedSize(data, size, from, to);
+	auto       buffer = Buffer::CreateUninitializedBuffer(type, bytes, {});
+	if (buffer && bytes && !Buffer::FillBuffer(*buffer, [&](char* output) {
+		Convert(data, size, from, output, to);
+		return true;
+	}))
+		return nullptr;
+
+	return buffer;
+}
+
+Transcoder::Transcoder(const Encoding from, const Encoding to) : From(from), To(to), Pending() {
+}
+
+size_t Transcoder::GetMaxOutputSize(const size_t size) const {
+	const auto total = size + PendingSize;
+	const auto units = total / UnitSize(From);
+	switch (To) {
+		case Encoding::Utf8:
+			// BMP unit of UTF-16 takes up to 3 bytes, pairs and other forms never grow
+			return From == Encoding::Utf16 ? units * 3 : total;
+		case Encoding::Utf16:
+			return From == Encoding::Utf8 ? units * 2 : total;
+		case Encoding::Utf32:
+			return units * 4;
+		default:
+			return 0;
+	}
+}
+
+size_t Transcoder::Convert(const char* data, size_t size, char* destination) {
+	if (!data && size)
+		return -1;
+
+	size_t written = 0;
+	if (PendingSize) {
+		// finish sequence split by previous chunk, one sequence is at most 4 bytes
+		char       head[sizeof(Pending) * 2];
+		const auto take = std::min(size, sizeof(Pending));
+		memcpy(head, Pending, PendingSize);
+		memcpy(head + PendingSize, data, take);
+
+		const auto total    = PendingSize + take;
+		const auto complete = CompletePrefix(head, total, From);
+		if (complete <= PendingSize) {
+			if (take < size || total > sizeof(Pending))
+				return -1;
+
+			memcpy(Pending, head, total);
+			PendingSize = total;
+			return 0;
+		}
+
+		const auto converted = Transcode(head, complete, From, destination, To);
+		if (converted == static_cast<size_t>(-1))
+			return -1;
+
+		const auto consumed = complete - PendingSize;
+		written += converted;
+		data += consumed;
+		size -= consumed;
+		PendingSize = 0;
+	}
+
+	const auto complete = CompletePrefix(data, size, From);
+	if (complete) {
+		const auto converted = Transcode(data, complete, From, destination + written, To);
+		if (converted == static_cast<size_t>(-1))
+			return -1;
+
+		written += converted;
+	}
+
+	PendingSize = size - complete;
+	if (PendingSize)
+		memcpy(Pending, data + complete, PendingSize);
+
+	return written;
+}
+
+bool Transcoder::Finish() const {
+	return PendingSize == 0;
+}
+
+void Transcoder::Reset() {
+	PendingSize = 0;
+}
@@ -0,0 +1,43 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Thread/Parallel.h"
+#include "Thread/ThreadPool.h"
+
+#include <thread>
+
+using namespace std;
+using namespace VisCore;
+
+size_t Thread::GetDefaultThreadCount() {
+	const auto count = std::thread::hardware_concurrency();
+	return count == 0 ? 1 : count;
+}
+
+void Thread::ParallelInvoke(const size_t count, const std::function<void(size_t)>& task) {
+	if (count == 0)
+		return;
+
+	if (count == 1) {
+		task(0);
+		return;
+	}
+
+	TaskGroup group(GetDefaultThreadPool());
+	for (size_t index = 1; index < count; ++index) {
+		group.Run([&task, index] {
+			task(index);
+		});
+	}
+
+	// group tasks reference task, wait them even if task(0) throws
+	try {
+		task(0);
+	} catch (...) {
+		group.Wait();
+		throw;
+	}
+
+	group.Wait();
+}
@@ -0,0 +1,316 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Thread/ThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+using namespace VisCore;
+using namespace VisCore::Thread;
+
+struct ThreadPool::Worker {
+	std::mutex                        Mutex;
+	std::deque<std::function<void()>> Tasks;
+	std::thread                       Thread;
+};
+
+namespace {
+	/**
+	 * \brief Pool and worker index of current thread, nullptr outside workers
+	 */
+	thread_local ThreadPool* CurrentPool  = nullptr;
+	thread_local size_t      CurrentIndex = 0;
+
+	std::mutex               DefaultPoolMutex;
+	ThreadPoolConfig         DefaultPoolConfig;
+	std::atomic<ThreadPool*> DefaultPool{nullptr};
+
+	/**
+	 * \brief Pin current thread to cpu, ignored when not supported
+	 */
+	void SetCurrentAffinity(const size_t cpu) {
+		#if defined(_WIN32)
+		if (cpu < sizeof(DWORD_PTR) * 8)
+			SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu);
+		#elif defined(__linux__)
+		if (cpu >= CPU_SETSIZE)
+			return;
+
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+		#else
+		(void) cpu;
+		#endif
+	}
+}
+
+ThreadPool::ThreadPool(const ThreadPoolConfig& config) {
+	auto count = config.WorkerCount;
+	if (count == 0) {
+		const auto hardware = std::thread::hardware_concurrency();
+		count = hardware > 1 ? hardware - 1 : 1;
+	}
+
+	Workers.reserve(count);
+	for (size_t index = 0; index < count; ++index) {
+		Workers.push_back(std::make_unique<Worker>());
+	}
+
+	// start after every deque exists, workers steal from each other right away
+	for (size_t index = 0; index < count; ++index) {
+		Workers[index]->Thread = std::thread([this, index, config] {
+			if (!config.Affinity.empty())
+				SetCurrentAffinity(config.Affinity[index % config.Affinity.size()]);
+
+			Run(index);
+		});
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(Mutex);
+		Stopping = true;
+	}
+	WorkReady.notify_all();
+
+	for (auto& worker : Workers) {
+		worker->Thread.join();
+	}
+}
+
+size_t ThreadPool::GetWorkerCount() const {
+	return Workers.size();
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+	Push(std::move(task));
+}
+
+void ThreadPool::ParallelFor(const size_t begin, const size_t end, const std::function<void(size_t, size_t)>& body,
+                             size_t grain) {
+	if (begin >= end)
+		return;
+
+	const auto size = end - begin;
+	if (grain == 0)
+		grain = std::max<size_t>(1, size / ((Workers.size() + 1) * 4));
+
+	if (size <= grain) {
+		body(begin, end);
+		return;
+	}
+
+	TaskGroup group(*this);
+	std::function<void(size_t, size_t)> split = [&](size_t first, size_t last) {
+		// hand out upper half, keep lower half, stolen halves split further on thief
+		while (last - first > grain) {
+			const auto middle = first + (last - first) / 2;
+			group.Run([&split, middle, last] {
+				split(middle, last);
+			});
+			last = middle;
+		}
+
+		body(first, last);
+	};
+
+	// tasks still use split, wait them even if body throws on this thread
+	std::exception_ptr error;
+	try {
+		split(begin, end);
+	} catch (...) {
+		error = std::current_exception();
+	}
+
+	group.Wait();
+	if (error)
+		std::rethrow_exception(error);
+}
+
+bool ThreadPool::RunPendingTask() {
+	std::function<void()> task;
+	if (!Pop(task))
+		return false;
+
+	task();
+	return true;
+}
+
+void ThreadPool::Push(std::function<void()>&& task) {
+	// count first, so Pop() never takes a task that was not counted yet
+	Queued.fetch_add(1);
+	if (CurrentPool == this) {
+		auto& worker = *Workers[CurrentIndex];
+		std::lock_guard<std::mutex> lock(worker.Mutex);
+		worker.Tasks.push_back(std::move(task));
+	} else {
+		std::lock_guard<std::mutex> lock(Mutex);
+		Injected.push_back(std::move(task));
+	}
+
+	// pairs with Sleeping/Queued order in Run(), either side observes the other
+	if (Sleeping.load() != 0) {
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+		}
+		WorkReady.notify_one();
+	}
+}
+
+bool ThreadPool::Pop(std::function<void()>& task) {
+	if (Queued.load(std::memory_order_relaxed) == 0)
+		return false;
+
+	const auto self = CurrentPool == this;
+	if (self) {
+		auto& worker = *Workers[CurrentIndex];
+		std::lock_guard<std::mutex> lock(worker.Mutex);
+		if (!worker.Tasks.empty()) {
+			task = std::move(worker.Tasks.back());
+			worker.Tasks.pop_back();
+			Queued.fetch_sub(1);
+			return true;
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(Mutex);
+		if (!Injected.empty()) {
+			task = std::move(Injected.front());
+			Injected.pop_front();
+			Queued.fetch_sub(1);
+			return true;
+		}
+	}
+
+	// steal oldest task, usually the largest piece of a split range
+	const auto count = Workers.size();
+	const auto start = self ? CurrentIndex + 1 : 0;
+	for (size_t offset = 0; offset < count; ++offset) {
+		auto& victim = *Workers[(start + offset) % count];
+		std::lock_guard<std::mutex> lock(victim.Mutex);
+		if (!victim.Tasks.empty()) {
+			task = std::move(victim.Tasks.front());
+			victim.Tasks.pop_front();
+			Queued.fetch_sub(1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::Run(const size_t index) {
+	CurrentPool  = this;
+	CurrentIndex = index;
+
+	std::function<void()> task;
+	for (;;) {
+		if (Pop(task)) {
+			task();
+			task = nullptr;
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(Mutex);
+		Sleeping.fetch_add(1);
+		WorkReady.wait(lock, [this] {
+			return Stopping || Queued.load() != 0;
+		});
+		Sleeping.fetch_sub(1);
+
+		if (Stopping && Queued.load() == 0)
+			return;
+	}
+}
+
+TaskGroup::TaskGroup(ThreadPool& pool) : Pool(pool) {}
+
+TaskGroup::TaskGroup() : Pool(GetDefaultThreadPool()) {}
+
+TaskGroup::~TaskGroup() {
+	try {
+		Wait();
+	} catch (...) {
+	}
+}
+
+void TaskGroup::Run(std::function<void()> task) {
+	Pending.fetch_add(1);
+	Pool.Submit([this, task = std::move(task)] {
+		try {
+			task();
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(Mutex);
+			if (!Error)
+				Error = std::current_exception();
+		}
+
+		Finish();
+	});
+}
+
+void TaskGroup::Wait() {
+	while (Pending.load() != 0) {
+		if (Pool.RunPendingTask())
+			continue;
+
+		// tasks of this group run elsewhere, wake up now and then to help with tasks they spawn
+		std::unique_lock<std::mutex> lock(Mutex);
+		Done.wait_for(lock, std::chrono::milliseconds(1), [this] {
+			return Pending.load() == 0;
+		});
+	}
+
+	// last Finish() may still hold the lock, group must outlive it
+	std::lock_guard<std::mutex> lock(Mutex);
+	if (Error) {
+		auto error = Error;
+		Error      = nullptr;
+		std::rethrow_exception(error);
+	}
+}
+
+void TaskGroup::Finish() {
+	std::lock_guard<std::mutex> lock(Mutex);
+	if (Pending.fetch_sub(1) == 1)
+		Done.notify_all();
+}
+
+ThreadPool& Thread::GetDefaultThreadPool() {
+	if (auto* pool = DefaultPool.load(std::memory_order_acquire))
+		return *pool;
+
+	std::lock_guard<std::mutex> lock(DefaultPoolMutex);
+	// never destroyed, joining workers during static destruction or dll unload can deadlock
+	auto* pool = DefaultPool.load(std::memory_order_relaxed);
+	if (!pool) {
+		pool = new ThreadPool(DefaultPoolConfig);
+		DefaultPool.store(pool, std::memory_order_release);
+	}
+
+	return *pool;
+}
+
+bool Thread::ConfigureDefaultThreadPool(const ThreadPoolConfig& config) {
+	std::lock_guard<std::mutex> lock(DefaultPoolMutex);
+	if (DefaultPool.load(std::memory_order_relaxed))
+		return false;
+
+	DefaultPoolConfig = config;
+	return true;
+}
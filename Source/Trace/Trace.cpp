@@ -0,0 +1,257 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "Trace/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace VisCore;
+
+namespace {
+	/**
+	 * \brief Events kept per thread, must be power of two
+	 */
+	constexpr uint64_t RingCapacity = 1 << 15;
+
+	/**
+	 * \brief One complete event, fields are relaxed atomics so flush can read while owner writes
+	 */
+	struct TraceEvent {
+		std::atomic<const char*> Name{nullptr};
+		std::atomic<uint64_t>    Start{0};
+		std::atomic<uint64_t>    End{0};
+		std::atomic<uint64_t>    Bytes{0};
+	};
+
+	/**
+	 * \brief Single writer ring of one thread, reader never blocks writer.
+	 *		  Head counts all written events, slots older than Head - RingCapacity are overwritten
+	 */
+	struct ThreadRing {
+		explicit ThreadRing(const uint32_t threadId) : ThreadId(threadId), Events(new TraceEvent[RingCapacity]) {
+		}
+
+		uint32_t                      ThreadId;
+		std::atomic<uint64_t>         Head{0};
+		std::atomic<uint64_t>         Tail{0};
+		std::unique_ptr<TraceEvent[]> Events;
+	};
+
+	struct FlushedEvent {
+		const char* Name;
+		uint64_t    Start;
+		uint64_t    End;
+		uint64_t    Bytes;
+		uint32_t    ThreadId;
+	};
+
+	/**
+	 * \brief Ring registry, leaked on purpose so rings outlive thread exit and static destruction.
+	 *		  Ring of exited thread keeps its events until next new thread takes it from free list
+	 */
+	struct Registry {
+		std::mutex                               Mutex;
+		std::vector<std::unique_ptr<ThreadRing>> Rings;
+		std::vector<ThreadRing*>                 Free;
+		uint32_t                                 NextThreadId  = 1;
+		uint64_t                                 BaseTimestamp = Trace::ReadTimestamp();
+		std::chrono::steady_clock::time_point    BaseTime      = std::chrono::steady_clock::now();
+	};
+
+	Registry& GetRegistry() {
+		static auto* registry = new Registry();
+		return *registry;
+	}
+
+	std::atomic<bool> Enabled{true};
+
+	#if defined(__GNUC__) || defined(__clang__)
+	// avoid __tls_get_addr call on every event when built as shared library
+	#define VIS_CORE_TRACE_TLS __attribute__((tls_model("initial-exec")))
+	#else
+	#define VIS_CORE_TRACE_TLS
+	#endif
+
+	thread_local ThreadRing* CurrentRing VIS_CORE_TRACE_TLS = nullptr;
+
+	/**
+	 * \brief Set when thread local destructors ran, later events of thread are dropped
+	 */
+	thread_local bool ThreadExited VIS_CORE_TRACE_TLS = false;
+
+	/**
+	 * \brief Return ring of current thread to free list at thread exit
+	 */
+	struct RingOwner {
+		~RingOwner() {
+			if (!CurrentRing)
+				return;
+
+			auto& registry = GetRegistry();
+
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			registry.Free.push_back(CurrentRing);
+			CurrentRing  = nullptr;
+			ThreadExited = true;
+		}
+	};
+
+	ThreadRing* RegisterThread() {
+		thread_local RingOwner owner;
+
+		auto& registry = GetRegistry();
+
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		if (!registry.Free.empty()) {
+			// events left by exited thread are dropped, they would be reported under new thread id
+			auto* ring = registry.Free.back();
+			registry.Free.pop_back();
+			ring->ThreadId = registry.NextThreadId++;
+			ring->Tail.store(ring->Head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			return ring;
+		}
+
+		registry.Rings.push_back(std::make_unique<ThreadRing>(registry.NextThreadId++));
+		return registry.Rings.back().get();
+	}
+
+	/**
+	 * \brief Get timestamp ticks per microsecond
+	 */
+	double GetTicksPerMicrosecond(Registry& registry) {
+		#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+		// calibrate TSC against steady clock since registry creation, wait a bit if too short
+		auto elapsed = std::chrono::steady_clock::now() - registry.BaseTime;
+		if (elapsed < std::chrono::milliseconds(10)) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(10) - elapsed);
+		}
+
+		const auto ticks = Trace::ReadTimestamp() - registry.BaseTimestamp;
+		elapsed          = std::chrono::steady_clock::now() - registry.BaseTime;
+		const auto us    = std::chrono::duration<double, std::micro>(elapsed).count();
+		return us > 0 ? static_cast<double>(ticks) / us : 1.0;
+		#else
+		return 1000.0;
+		#endif
+	}
+
+	std::vector<FlushedEvent> CollectEvents() {
+		auto& registry = GetRegistry();
+
+		std::vector<FlushedEvent>   events;
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		for (const auto& ring : registry.Rings) {
+			const auto head  = ring->Head.load(std::memory_order_acquire);
+			const auto begin = std::max(ring->Tail.load(std::memory_order_relaxed), head > RingCapacity ? head - RingCapacity : 0);
+
+			const auto first = events.size();
+			for (auto index = begin; index < head; ++index) {
+				const auto& event = ring->Events[index & (RingCapacity - 1)];
+				events.push_back({
+					event.Name.load(std::memory_order_relaxed), event.Start.load(std::memory_order_relaxed),
+					event.End.load(std::memory_order_relaxed), event.Bytes.load(std::memory_order_relaxed), ring->ThreadId
+				});
+			}
+
+			// writer may have lapped us while copying, slot of index after is being written over
+			// index after - RingCapacity, drop it and every older slot
+			const auto after = ring->Head.load(std::memory_order_acquire);
+			if (after >= RingCapacity && after - RingCapacity >= begin) {
+				const auto torn = std::min<uint64_t>(after - RingCapacity + 1 - begin, head - begin);
+				events.erase(events.begin() + static_cast<ptrdiff_t>(first),
+				             events.begin() + static_cast<ptrdiff_t>(first + torn));
+			}
+		}
+
+		return events;
+	}
+
+	void WriteEscaped(std::ostream& stream, const char* text) {
+		for (; text && *text; ++text) {
+			if (*text == '"' || *text == '\\')
+				stream << '\\';
+			stream << *text;
+		}
+	}
+}
+
+void Trace::RecordEvent(const char* name, const uint64_t start, const uint64_t end, const uint64_t bytes) noexcept {
+	if (!Enabled.load(std::memory_order_relaxed))
+		return;
+
+	auto* ring = CurrentRing;
+	if (!ring) {
+		if (ThreadExited)
+			return;
+
+		try {
+			ring = CurrentRing = RegisterThread();
+		} catch (...) {
+			return;
+		}
+	}
+
+	const auto head  = ring->Head.load(std::memory_order_relaxed);
+	auto&      event = ring->Events[head & (RingCapacity - 1)];
+	event.Name.store(name, std::memory_order_relaxed);
+	event.Start.store(start, std::memory_order_relaxed);
+	event.End.store(end, std::memory_order_relaxed);
+	event.Bytes.store(bytes, std::memory_order_relaxed);
+	ring->Head.store(head + 1, std::memory_order_release);
+}
+
+void Trace::SetTraceEnabled(const bool enabled) noexcept {
+	Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Trace::IsTraceEnabled() noexcept {
+	return Enabled.load(std::memory_order_relaxed);
+}
+
+void Trace::ClearTrace() {
+	auto& registry = GetRegistry();
+
+	std::lock_guard<std::mutex> lock(registry.Mutex);
+	for (const auto& ring : registry.Rings) {
+		ring->Tail.store(ring->Head.load(std::memory_order_acquire), std::memory_order_relaxed);
+	}
+}
+
+bool Trace::WriteChromeTrace(std::ostream& stream) {
+	auto&      registry = GetRegistry();
+	const auto events   = CollectEvents();
+	const auto ticks    = GetTicksPerMicrosecond(registry);
+
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	for (size_t index = 0; index < events.size(); ++index) {
+		const auto& event = events[index];
+		const auto  start = event.Start >= registry.BaseTimestamp ? event.Start - registry.BaseTimestamp : 0;
+		const auto  end   = event.End >= event.Start ? event.End - event.Start : 0;
+
+		stream << (index ? ",\n" : "\n") << "{\"name\":\"";
+		WriteEscaped(stream, event.Name);
+		stream << "\",\"cat\":\"VisCore\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.ThreadId
+			<< ",\"ts\":" << static_cast<double>(start) / ticks << ",\"dur\":" << static_cast<double>(end) / ticks
+			<< ",\"args\":{\"bytes\":" << event.Bytes << "}}";
+	}
+	stream << "\n]}" << std::endl;
+
+	return static_cast<bool>(stream);
+}
+
+bool Trace::WriteChromeTrace(const char* path) {
+	std::ofstream stream(path);
+	if (!stream)
+		return false;
+
+	return WriteChromeTrace(stream);
+}
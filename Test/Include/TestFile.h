@@ -0,0 +1,12 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#pragma once
+
+#ifndef VISCORE_TEST_FILE_H
+#define VISCORE_TEST_FILE_H
+
+void TestFile();
+
+#endif //VISCORE_TEST_FILE_H
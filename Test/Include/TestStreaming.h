@@ -0,0 +1,12 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#pragma once
+
+#ifndef VISCORE_TEST_STREAMING_H
+#define VISCORE_TEST_STREAMING_H
+
+void TestStreaming();
+
+#endif //VISCORE_TEST_STREAMING_H
@@ -0,0 +1,12 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#pragma once
+
+#ifndef VISCORE_TEST_THREAD_H
+#define VISCORE_TEST_THREAD_H
+
+void TestThread();
+
+#endif //VISCORE_TEST_THREAD_H
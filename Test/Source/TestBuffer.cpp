@@ -4,9 +4,28 @@
 
 #include "TestBuffer.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
 
+#include "Buffer/BasicBuffer.h"
 #include "Buffer/Buffer.h"
+#include "Buffer/BufferStats.h"
+#include "Buffer/BulkMemory.h"
+#include "Buffer/ByteSwap.h"
+#include "Buffer/Compression.h"
+#include "Buffer/MemoryBudget.h"
+#include "Buffer/NumericConvert.h"
+#include "Buffer/PitchedBuffer.h"
+#include "Buffer/SharedMemory.h"
+#include "Buffer/SpillOptions.h"
+#include "Buffer/TypedView.h"
+#include "Buffer/VertexData.h"
+#include "Trace/Trace.h"
 #include "Streaming/Streaming.h"
 
 #ifdef _WIN32
@@ -68,4 +87,478 @@ void TestBuffer() {
 	} catch (std::out_of_range) {
 		std::cout << "Detect Buffer Access Out of Range Success" << std::endl;
 	}
-}
\ No newline at end of file
+
+	std::cout << "Test Buffer UpdateMany Function......" << std::endl;
+	const auto  bufferBatch = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 16, '.');
+	const char* patch       = "abcdefgh";
+	const VisCore::Buffer::UpdateRegion regions[] = {
+		{4, 2, patch + 2}, {0, 2, patch}, {2, 2, patch + 2}, {6, 2, patch + 4}, {5, 2, "XY"}
+	};
+	std::cout << "Buffer UpdateMany: " << bufferBatch->UpdateMany(regions, 5) << std::endl;
+	std::cout << "Buffer Data: " << bufferBatch->GetData() << std::endl;
+
+	const VisCore::Buffer::UpdateRegion invalidRegions[] = {{0, 2, "zz"}, {15, 2, "zz"}};
+	std::cout << "Buffer UpdateMany Out of Range: " << bufferBatch->UpdateMany(invalidRegions, 2) << std::endl;
+	std::cout << "Buffer Data: " << bufferBatch->GetData() << std::endl;
+
+	std::cout << "Test Basic Buffer......" << std::endl;
+	VisCore::Buffer::BasicDynamicBuffer basicBuffer;
+	basicBuffer.InitBuffer("vis", 3);
+	basicBuffer.Append("core", 4);
+	basicBuffer.Insert(3, "-", 1);
+	std::transform(basicBuffer.begin(), basicBuffer.end(), basicBuffer.begin(), [](const char value) {
+		return static_cast<char>(value >= 'a' && value <= 'z' ? value - 'a' + 'A' : value);
+	});
+	std::cout << "Buffer Data: " << basicBuffer.GetData() << std::endl;
+	std::cout << "Buffer Size: " << basicBuffer.GetSpan().size() << std::endl;
+
+	VisCore::Buffer::BasicConstraintBuffer basicConstraint;
+	basicConstraint.InitBuffer(4, 'x');
+	std::cout << "Basic Constraint Append: " << basicConstraint.Append('y') << std::endl;
+	try {
+		basicConstraint.At(4);
+		std::cout << "Detect Buffer Access Out of Range Failed" << std::endl;
+	} catch (std::out_of_range&) {
+		std::cout << "Detect Buffer Access Out of Range Success" << std::endl;
+	}
+
+	std::cout << "Test Basic Buffer Heap Storage......" << std::endl;
+	VisCore::Buffer::BasicDynamicBuffer heapBuffer;
+	std::string                         heapExpected;
+	for (int index = 0; index < 100000; ++index) {
+		const auto value = static_cast<char>('a' + index % 26);
+		heapBuffer.Append(value);
+		heapExpected.push_back(value);
+	}
+	heapBuffer.Insert(0, "#", 1);
+	heapExpected.insert(0, "#");
+	std::cout << "Heap Append/Insert Keep Data: "
+		<< (std::string(heapBuffer.GetData(), heapBuffer.GetLength()) == heapExpected) << std::endl;
+	std::cout << "Heap Data Terminated: " << (heapBuffer.GetData()[heapBuffer.GetLength()] == '\0') << std::endl;
+
+	const auto heapEnd = heapBuffer.GetLength();
+	heapBuffer.Update(heapEnd + 8, 1, "!");
+	std::cout << "Heap Update Gap Zero: "
+		<< std::all_of(heapBuffer.begin() + heapEnd, heapBuffer.begin() + heapEnd + 8, [](const char value) {
+			return value == 0;
+		}) << std::endl;
+	heapBuffer.Resize(heapBuffer.GetLength() + 16);
+	std::cout << "Heap Resize Zero: " << std::all_of(heapBuffer.end() - 16, heapBuffer.end(), [](const char value) {
+		return value == 0;
+	}) << std::endl;
+
+	auto heapCopy = heapBuffer;
+	heapCopy[1] = 'Z';
+	std::cout << "Heap Copy Is Deep: " << (heapBuffer[1] == 'a' && heapCopy.GetLength() == heapBuffer.GetLength())
+		<< std::endl;
+
+	std::cout << "Test Buffer Span Access......" << std::endl;
+	const auto bufferSpan = CreateBuffer(VisCore::Buffer::BufferType::Dynamic, "span access", strlen("span access"));
+	const auto bufferDest = CreateBuffer(VisCore::Buffer::BufferType::Constraint, bufferSpan->GetLength(), 0);
+	const auto source     = bufferSpan->GetSpan();
+	std::transform(source.begin(), source.end(), bufferDest->begin(), [](const char value) {
+		return static_cast<char>(value == ' ' ? '_' : value);
+	});
+	std::cout << "Buffer Data: " << bufferDest->GetData() << std::endl;
+	std::cout << "Buffer Count: " << std::count(bufferDest->begin(), bufferDest->end(), 'c') << std::endl;
+	std::cout << "Buffer Unchecked: " << bufferDest->Unchecked(4) << std::endl;
+	try {
+		(*bufferDest)[bufferDest->GetLength()];
+		std::cout << "Detect Buffer Access Out of Range Failed" << std::endl;
+	} catch (std::out_of_range&) {
+		std::cout << "Detect Buffer Access Out of Range Success" << std::endl;
+	}
+
+	std::cout << "Test Buffer Stats......" << std::endl;
+	VisCore::Buffer::ResetBufferStats();
+	{
+		const auto bufferStats = CreateBuffer(VisCore::Buffer::BufferType::Streaming, 1024, 0);
+		const auto stats       = VisCore::Buffer::GetBufferStats();
+		std::cout << "Streaming Type: " << ToString(bufferStats->GetType()) << std::endl;
+		std::cout << "Streaming Allocations: " << stats[VisCore::Buffer::BufferType::Streaming].Allocations << std::endl;
+		std::cout << "Streaming Live Bytes >= 1024: " << (stats[VisCore::Buffer::BufferType::Streaming].LiveBytes >= 1024) << std::endl;
+	}
+	const auto stats = VisCore::Buffer::GetBufferStats();
+	std::cout << "Streaming Releases: " << stats[VisCore::Buffer::BufferType::Streaming].Releases << std::endl;
+	std::cout << "Total Live Buffers: " << stats.Total.LiveBuffers << std::endl;
+	VisCore::Buffer::DumpBufferAllocationSites(std::cout, 5);
+
+	std::cout << "Test Trace......" << std::endl;
+	VisCore::Trace::ClearTrace();
+	{
+		VisCore::Trace::TraceScope scope("Test::Trace", 42);
+	}
+	// exited thread hands its ring to next thread
+	for (int index = 0; index < 8; ++index) {
+		std::thread([] {
+			VisCore::Trace::TraceScope scope("Test::Thread", 7);
+		}).join();
+	}
+	VisCore::Trace::SetTraceEnabled(false);
+	VisCore::Trace::RecordEvent("Test::Disabled", 0, 0, 0);
+	VisCore::Trace::SetTraceEnabled(true);
+	std::ostringstream trace;
+	VisCore::Trace::WriteChromeTrace(trace);
+	std::cout << "Trace Has Event: " << (trace.str().find("\"Test::Trace\"") != std::string::npos) << std::endl;
+	std::cout << "Trace Has Bytes: " << (trace.str().find("\"bytes\":42") != std::string::npos) << std::endl;
+	std::cout << "Trace Has Disabled Event: " << (trace.str().find("Test::Disabled") != std::string::npos) << std::endl;
+	std::cout << "Trace Has Thread Event: " << (trace.str().find("\"Test::Thread\"") != std::string::npos) << std::endl;
+
+	std::cout << "Test Buffer Allocation......" << std::endl;
+	VisCore::Buffer::BufferAllocation aligned;
+	aligned.Alignment = 4096;
+	const auto bufferAligned = CreateBuffer(VisCore::Buffer::BufferType::Dynamic, 100, 'a', aligned);
+	std::cout << "Aligned 4096: " << (reinterpret_cast<uintptr_t>(bufferAligned->GetData()) % 4096 == 0) << std::endl;
+	for (int index = 0; index < 100; ++index) {
+		bufferAligned->Append("0123456789", 10);
+	}
+	std::cout << "Aligned After Append: " << (reinterpret_cast<uintptr_t>(bufferAligned->GetData()) % 4096 == 0) << std::endl;
+	const auto bufferAlignedCopy = bufferAligned->CreateBufferCopy(VisCore::Buffer::BufferType::Streaming);
+	std::cout << "Aligned Copy: " << (bufferAlignedCopy->GetAllocation() == aligned) << std::endl;
+	VisCore::Buffer::BufferAllocation hugePages;
+	hugePages.HugePages = true;
+	const auto bufferHuge = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 4 * VisCore::Buffer::HugePageSize, 0, hugePages);
+	std::cout << "Huge Page Aligned: " << (reinterpret_cast<uintptr_t>(bufferHuge->GetData()) % VisCore::Buffer::HugePageSize == 0) << std::endl;
+	try {
+		VisCore::Buffer::BufferAllocation invalid;
+		invalid.Alignment = 96;
+		CreateBuffer(VisCore::Buffer::BufferType::Constraint, 16, 0, invalid);
+		std::cout << "Detect Invalid Alignment Failed" << std::endl;
+	} catch (std::bad_alloc&) {
+		std::cout << "Detect Invalid Alignment Success" << std::endl;
+	}
+	try {
+		VisCore::Buffer::BufferAllocation invalid;
+		invalid.Alignment = 3;
+		CreateBuffer(VisCore::Buffer::BufferType::Dynamic, 16, 0, invalid);
+		std::cout << "Detect Invalid Small Alignment Failed" << std::endl;
+	} catch (std::bad_alloc&) {
+		std::cout << "Detect Invalid Small Alignment Success" << std::endl;
+	}
+
+	std::cout << "Test Bulk Memory......" << std::endl;
+	const auto bulkDefault = VisCore::Buffer::GetBulkMemoryConfig();
+	auto       bulkConfig  = bulkDefault;
+	bulkConfig.ParallelThreshold    = 64 * 1024;
+	bulkConfig.NonTemporalThreshold = 128 * 1024;
+	bulkConfig.MinChunkSize         = 4096;
+	bulkConfig.MaxThreads           = 3;
+	VisCore::Buffer::SetBulkMemoryConfig(bulkConfig);
+	const auto bufferBulk = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 300001, 'b');
+	std::cout << "Bulk Fill: " << (std::count(**bufferBulk, **bufferBulk + 300001, 'b') == 300001) << std::endl;
+	for (size_t index = 0; index < bufferBulk->GetLength(); ++index) {
+		(*bufferBulk)[index] = static_cast<char>(index * 31);
+	}
+	const auto bufferBulkCopy = bufferBulk->CreateBufferCopy(VisCore::Buffer::BufferType::Dynamic);
+	std::cout << "Bulk Copy: " << (memcmp(**bufferBulk, **bufferBulkCopy, 300001) == 0) << std::endl;
+	bufferBulkCopy->Clear(200003);
+	std::cout << "Bulk Clear: " << (std::count(**bufferBulkCopy, **bufferBulkCopy + 200003, 0) == 200003 &&
+	                                memcmp(**bufferBulk + 200003, **bufferBulkCopy + 200003, 99998) == 0) << std::endl;
+	VisCore::Buffer::SetBulkMemoryConfig(bulkDefault);
+
+	std::cout << "Test Concat Buffer......" << std::endl;
+	auto       concatLeft  = CreateBuffer(VisCore::Buffer::BufferType::Constraint, "Vis", 3);
+	auto       concatRight = CreateBuffer(VisCore::Buffer::BufferType::Dynamic, "Core", 4);
+	const auto concat      = VisCore::Buffer::CreateConcatBuffer(concatLeft, concatRight);
+	*concat += concatLeft;
+	std::cout << "Concat Type: " << ToString(concat->GetType()) << std::endl;
+	std::cout << "Concat Length: " << concat->GetLength() << std::endl;
+	const auto concatRead = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 5, 0);
+	concat->GetStreaming()->Seek(2);
+	const auto concatReadSize = concat->GetStreaming()->Read(concatRead.get(), 5);
+	std::cout << "Concat Read: " << std::string(concatRead->GetData(), concatReadSize) << std::endl;
+	const auto concatCopy = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 10, 0);
+	concat->CopyTo(concatCopy);
+	std::cout << "Concat CopyTo: " << std::string(concatCopy->GetData(), concatCopy->GetLength()) << std::endl;
+	std::cout << "Concat Flatten: " << std::string(concat->GetData(), concat->GetLength()) << std::endl;
+	concat->Update(0, 3, "vis");
+	std::cout << "Concat Operand Kept: " << std::string(concatLeft->GetData(), concatLeft->GetLength()) << std::endl;
+	const auto concatNext = *concat + concatRight;
+	std::cout << "Concat Chain: " << std::string(concatNext->GetData(), concatNext->GetLength()) << std::endl;
+
+	std::cout << "Test Byte Swap......" << std::endl;
+	uint32_t swapValues[40];
+	for (uint32_t index = 0; index < 40; ++index) {
+		swapValues[index] = 0x01020304u * (index + 1);
+	}
+	const auto swapBuffer = CreateBuffer(VisCore::Buffer::BufferType::Constraint, reinterpret_cast<const char*>(swapValues),
+	                                     sizeof(swapValues));
+	VisCore::Buffer::ByteSwapRegion(*swapBuffer, 4, 39, sizeof(uint32_t));
+	bool swapMatch = true;
+	for (size_t index = 1; index < 40; ++index) {
+		const auto* bytes = swapBuffer->GetData() + index * 4;
+		swapMatch         = swapMatch && memcmp(bytes, &swapValues[index], 4) != 0 &&
+		                    static_cast<uint8_t>(bytes[0]) == (swapValues[index] >> 24);
+	}
+	std::cout << "Byte Swap Region: " << swapMatch << " " << (memcmp(swapBuffer->GetData(), swapValues, 4) == 0) << std::endl;
+	std::cout << "Byte Swap Out Of Range: " << !VisCore::Buffer::ByteSwapRegion(*swapBuffer, 8, 39, sizeof(uint32_t))
+		<< std::endl;
+	uint16_t shortValues[3] = {0x0102, 0x0304, 0x0506};
+	VisCore::Buffer::ByteSwapArray(shortValues, 3);
+	std::cout << "Byte Swap Array: " << std::hex << shortValues[0] << " " << shortValues[2] << std::dec << std::endl;
+
+	std::cout << "Test Vertex Data......" << std::endl;
+	// 7 records of position xyz and uv
+	float vertexRecords[7 * 5];
+	for (size_t index = 0; index < 7 * 5; ++index) {
+		vertexRecords[index] = static_cast<float>(index) - 10.0f;
+	}
+	const auto vertexBuffer = CreateBuffer(VisCore::Buffer::BufferType::Constraint,
+	                                       reinterpret_cast<const char*>(vertexRecords), sizeof(vertexRecords));
+	const auto positionView = VisCore::Buffer::AsStridedView<float>(*vertexBuffer, 4, 20);
+	std::cout << "Strided View: " << positionView.size() << " " << positionView[1] << " " << positionView[6] << std::endl;
+	const auto floatSpan = VisCore::Buffer::AsSpan<const float>(vertexBuffer->GetData(), vertexBuffer->GetLength());
+	std::cout << "Typed Span: " << floatSpan.size() << " " << floatSpan[34] << " "
+		<< VisCore::Buffer::AsSpan<uint32_t>(*vertexBuffer, 2).empty() << std::endl;
+
+	float positions[7 * 3];
+	float uvs[7 * 2];
+	const VisCore::Buffer::AttributeStream splitStreams[] = {
+		{0, 12, reinterpret_cast<char*>(positions)},
+		{12, 8, reinterpret_cast<char*>(uvs)}
+	};
+	VisCore::Buffer::DeinterleaveRegion(*vertexBuffer, 0, 7, 20, splitStreams, 2);
+	std::cout << "Deinterleave: " << positions[3] << " " << uvs[13] << std::endl;
+	for (auto& value : uvs) {
+		value = -value;
+	}
+	const VisCore::Buffer::ConstAttributeStream mergeStreams[] = {{12, 8, reinterpret_cast<const char*>(uvs)}};
+	VisCore::Buffer::InterleaveRegion(*vertexBuffer, 0, 7, 20, mergeStreams, 1);
+	std::cout << "Interleave: " << positionView[6] << " " << VisCore::Buffer::AsStridedView<float>(*vertexBuffer, 16, 20)[6]
+		<< std::endl;
+	std::cout << "Interleave Out Of Range: " << !VisCore::Buffer::InterleaveRegion(*vertexBuffer, 20, 7, 20, mergeStreams, 1)
+		<< std::endl;
+
+	float boundsMin[3];
+	float boundsMax[3];
+	VisCore::Buffer::ComputeBounds(vertexBuffer->GetData(), 7, 20, 3, boundsMin, boundsMax);
+	std::cout << "Bounds: " << boundsMin[0] << " " << boundsMin[2] << " " << boundsMax[0] << " " << boundsMax[2] << std::endl;
+	float minValue;
+	float maxValue;
+	VisCore::Buffer::ComputeMinMax(positions, 21, minValue, maxValue);
+	std::cout << "Min Max: " << minValue << " " << maxValue << " Sum: " << VisCore::Buffer::ComputeSum(positions, 21)
+		<< std::endl;
+
+	std::cout << "Test Pitched Buffer......" << std::endl;
+	uint16_t gridValues[13 * 11];
+	for (uint16_t index = 0; index < 13 * 11; ++index) {
+		gridValues[index] = index;
+	}
+	VisCore::Buffer::PitchedBuffer linearGrid(13, 11, 2);
+	linearGrid.Update(0, 0, 13, 11, reinterpret_cast<const char*>(gridValues), 13 * 2);
+	std::cout << "Pitched Pitch: " << linearGrid.GetPitch() << " "
+		<< (reinterpret_cast<uintptr_t>(linearGrid.GetRow(3).data()) % 64 == 0) << std::endl;
+	std::cout << "Pitched Row: " << linearGrid.GetRow<uint16_t>(2)[5] << " Column: "
+		<< linearGrid.GetColumn<uint16_t>(4)[10] << std::endl;
+	bool layoutMatch = true;
+	for (const auto layout : {VisCore::Buffer::PitchedLayout::Tiled, VisCore::Buffer::PitchedLayout::Morton}) {
+		VisCore::Buffer::PitchedBuffer grid(13, 11, 2, layout);
+		grid.CopyRect(linearGrid, 0, 0, 13, 11, 0, 0);
+		uint16_t readBack[13 * 11];
+		grid.Read(0, 0, 13, 11, reinterpret_cast<char*>(readBack), 13 * 2);
+		layoutMatch = layoutMatch && memcmp(readBack, gridValues, sizeof(gridValues)) == 0 && grid.GetRow(0).empty();
+	}
+	std::cout << "Pitched Layouts: " << layoutMatch << std::endl;
+	linearGrid.CopyRect(linearGrid, 0, 0, 4, 4, 2, 1);
+	uint16_t movedValue;
+	memcpy(&movedValue, linearGrid.GetElement(5, 4), 2);
+	std::cout << "Pitched Overlap Copy: " << movedValue << " Out Of Range: "
+		<< !linearGrid.CopyRect(linearGrid, 10, 0, 4, 4, 0, 0) << std::endl;
+	VisCore::Buffer::PitchedBuffer transposed(11, 13, 2, VisCore::Buffer::PitchedLayout::Tiled);
+	linearGrid.Transpose(transposed);
+	uint16_t transposedValue;
+	memcpy(&transposedValue, transposed.GetElement(10, 12), 2);
+	std::cout << "Pitched Transpose: " << transposedValue << std::endl;
+
+	std::cout << "Test Numeric Convert......" << std::endl;
+	const float numericValues[20] = {
+		0.0f, 1.0f, -2.5f, 65504.0f, 1e-7f, 0.333f, -1.5f, 0.5f, 2.0f, -0.25f,
+		0.75f, 1.25f, -1.0f, 0.1f, 100000.0f, 3.0f, -0.5f, 0.004f, 0.996f, 0.6f
+	};
+	const auto numericSource = CreateBuffer(VisCore::Buffer::BufferType::Constraint,
+	                                        reinterpret_cast<const char*>(numericValues), sizeof(numericValues));
+	const auto halfBuffer = VisCore::Buffer::ConvertNumeric(*numericSource, VisCore::Buffer::NumericFormat::Float32,
+	                                                        VisCore::Buffer::NumericFormat::Float16);
+	const auto halfBack = VisCore::Buffer::ConvertNumeric(*halfBuffer, VisCore::Buffer::NumericFormat::Float16,
+	                                                      VisCore::Buffer::NumericFormat::Float32);
+	const auto* halfFloats = reinterpret_cast<const float*>(halfBack->GetData());
+	std::cout << "Float16: " << halfBuffer->GetLength() << " " << halfFloats[2] << " " << halfFloats[3] << " "
+		<< halfFloats[14] << " " << std::hex << VisCore::Buffer::FloatToHalf(1.0f) << std::dec << std::endl;
+	std::cout << "BFloat16: " << std::hex << VisCore::Buffer::FloatToBFloat16(1.0f) << std::dec << " "
+		<< VisCore::Buffer::BFloat16ToFloat(VisCore::Buffer::FloatToBFloat16(-2.5f)) << std::endl;
+	const auto unormBuffer = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 20, 0);
+	VisCore::Buffer::ConvertNumericRegion(*numericSource, 0, VisCore::Buffer::NumericFormat::Float32, *unormBuffer, 0,
+	                                      VisCore::Buffer::NumericFormat::Unorm8, 20);
+	std::cout << "Unorm8: " << static_cast<int>(static_cast<uint8_t>((*unormBuffer)[1])) << " "
+		<< static_cast<int>(static_cast<uint8_t>((*unormBuffer)[2])) << " "
+		<< static_cast<int>(static_cast<uint8_t>((*unormBuffer)[19])) << std::endl;
+	const auto snormBuffer = VisCore::Buffer::ConvertNumeric(*unormBuffer, VisCore::Buffer::NumericFormat::Unorm8,
+	                                                         VisCore::Buffer::NumericFormat::Snorm16);
+	int16_t snormValue;
+	memcpy(&snormValue, snormBuffer->GetData() + 2, 2);
+	std::cout << "Snorm16: " << snormValue << " Out Of Range: "
+		<< !VisCore::Buffer::ConvertNumericRegion(*numericSource, 4, VisCore::Buffer::NumericFormat::Float32, *unormBuffer,
+		                                          0, VisCore::Buffer::NumericFormat::Unorm8, 20) << std::endl;
+
+	std::cout << "Test Managed Buffer......" << std::endl;
+	std::string codecText;
+	for (int index = 0; index < 200; ++index) {
+		codecText += "managed buffer " + std::to_string(index % 7) + " ";
+	}
+	std::string codecPacked(VisCore::Buffer::GetCompressBound(codecText.size()), '\0');
+	const auto packedSize = VisCore::Buffer::Compress(codecText.data(), codecText.size(), codecPacked.data(),
+	                                                  codecPacked.size());
+	std::string codecRestored(codecText.size(), '\0');
+	const auto restoredSize = VisCore::Buffer::Decompress(codecPacked.data(), packedSize, codecRestored.data(),
+	                                                      codecRestored.size());
+	std::cout << "Codec: " << (packedSize < codecText.size() / 4) << " " << (codecRestored == codecText) << " "
+		<< (VisCore::Buffer::Decompress(codecPacked.data(), packedSize - 1, codecRestored.data(),
+		                                codecRestored.size()) == static_cast<size_t>(-1)) << std::endl;
+	const auto oldBudget = VisCore::Buffer::GetMemoryBudgetConfig();
+	VisCore::Buffer::MemoryBudgetConfig budget;
+	budget.Budget        = 256 * 1024;
+	budget.MinIdleMs     = 0;
+	budget.MinBufferSize = 1024;
+	VisCore::Buffer::SetMemoryBudgetConfig(budget);
+	auto coldBuffer = CreateBuffer(VisCore::Buffer::BufferType::Managed, 200 * 1024, 'a');
+	(*coldBuffer)[1000] = 'b';
+	auto hotBuffer = CreateBuffer(VisCore::Buffer::BufferType::Managed, 200 * 1024, 'c');
+	std::cout << "Managed Type: " << ToString(coldBuffer->GetType()) << " Second Chance: "
+		<< VisCore::Buffer::IsBufferCompressed(*coldBuffer) << std::endl;
+	hotBuffer->GetData();
+	VisCore::Buffer::TrimMemoryBudget();
+	const auto trimStats = VisCore::Buffer::GetMemoryBudgetStats();
+	std::cout << "Managed Trim: " << VisCore::Buffer::IsBufferCompressed(*coldBuffer) << " "
+		<< VisCore::Buffer::IsBufferCompressed(*hotBuffer) << " "
+		<< (trimStats.CompressedBytes < trimStats.OriginalBytes / 100) << std::endl;
+	std::cout << "Managed Access: " << (*coldBuffer)[1000] << coldBuffer->GetData()[999] << " Budget: "
+		<< !VisCore::Buffer::IsBufferCompressed(*coldBuffer) << " " << VisCore::Buffer::IsBufferCompressed(*hotBuffer)
+		<< std::endl;
+	{
+		VisCore::Buffer::ScopedBufferPin pin(*coldBuffer);
+		VisCore::Buffer::TrimMemoryBudget();
+		VisCore::Buffer::TrimMemoryBudget();
+		std::cout << "Managed Pinned: " << VisCore::Buffer::IsBufferCompressed(*coldBuffer) << std::endl;
+	}
+	VisCore::Buffer::TrimMemoryBudget();
+	VisCore::Buffer::TrimMemoryBudget();
+	const auto readBuffer = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 4, 0);
+	const auto wasCompressed = VisCore::Buffer::IsBufferCompressed(*coldBuffer);
+	coldBuffer->GetStreaming()->Seek(998);
+	coldBuffer->GetStreaming()->Read(readBuffer.get(), 4);
+	std::cout << "Managed Read: " << wasCompressed << " " << std::string(readBuffer->GetData(), 4) << std::endl;
+	auto* coldStreaming = coldBuffer->GetStreaming();
+	const auto managedSeekStart = coldStreaming->Seek(-static_cast<int64_t>(coldStreaming->Tell()),
+	                                                  VisCore::Streaming::SeekMode::SeekCurrent);
+	coldStreaming->Seek(-8, VisCore::Streaming::SeekMode::SeekEnd);
+	std::cout << "Managed Seek Start: " << managedSeekStart << " Read Tail: " << coldStreaming->Read(readBuffer.get(), 100)
+		<< std::endl;
+	VisCore::Buffer::TrimMemoryBudget();
+	VisCore::Buffer::TrimMemoryBudget();
+	const VisCore::Buffer::UpdateRegion managedRegions[] = {{0, 2, "xy"}, {100 * 1024, 2, "zw"}};
+	std::cout << "Managed UpdateMany: " << VisCore::Buffer::IsBufferCompressed(*coldBuffer) << " "
+		<< coldBuffer->UpdateMany(managedRegions, 2) << " " << coldBuffer->GetData()[1]
+		<< coldBuffer->GetData()[100 * 1024] << std::endl;
+	const auto managedStats = VisCore::Buffer::GetMemoryBudgetStats();
+	std::cout << "Managed Stats: " << managedStats.ManagedBuffers << " " << managedStats.Compressions << " "
+		<< managedStats.Decompressions << std::endl;
+	coldBuffer.reset();
+	hotBuffer.reset();
+	VisCore::Buffer::SetMemoryBudgetConfig(oldBudget);
+
+	std::cout << "Test Spill Buffer......" << std::endl;
+	VisCore::Buffer::SpillOptions spillOptions;
+	spillOptions.MemoryLimit = 64 * 1024;
+	spillOptions.SegmentSize = 16 * 1024;
+	auto spillBuffer = VisCore::Buffer::CreateSpillBuffer(spillOptions);
+	std::string spillModel;
+	for (int index = 0; index < 16384; ++index) {
+		const auto line = "spill line " + std::to_string(index) + "\n";
+		spillBuffer->Append(line.data(), static_cast<int>(line.size()));
+		spillModel += line;
+	}
+	std::cout << "Spill Type: " << ToString(spillBuffer->GetType()) << " Spilled: "
+		<< (VisCore::Buffer::GetBufferStats()[VisCore::Buffer::BufferType::Spill].LiveBytes <= spillOptions.MemoryLimit)
+		<< " " << (spillBuffer->GetMemSize() < spillModel.size() / 4) << std::endl;
+	spillBuffer->Insert(100, "<inserted>", 10);
+	spillModel.insert(100, "<inserted>");
+	spillBuffer->Update(50000, 6, "UPDATE");
+	spillModel.replace(50000, 6, "UPDATE");
+	(*spillBuffer)[7] = '#';
+	spillModel[7] = '#';
+	const auto spillRead = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 16, 0);
+	spillBuffer->GetStreaming()->Seek(49996);
+	const auto spillReadSize = spillBuffer->GetStreaming()->Read(spillRead.get(), 16);
+	std::cout << "Spill Read: " << spillReadSize << " " << std::string(spillRead->GetData(), 16) << std::endl;
+	std::cout << "Spill Seek Start: " << spillBuffer->GetStreaming()->Seek(-50012, VisCore::Streaming::SeekMode::SeekCurrent)
+		<< std::endl;
+	const auto spillSource = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 8, '@');
+	spillSource->CopyTo(spillBuffer);
+	spillModel.replace(0, 8, 8, '@');
+	std::cout << "Spill CopyTo Stays Spilled: "
+		<< (VisCore::Buffer::GetBufferStats()[VisCore::Buffer::BufferType::Spill].LiveBytes <= spillOptions.MemoryLimit)
+		<< std::endl;
+	const auto spillCopy = spillBuffer->CreateBufferCopy(VisCore::Buffer::BufferType::Spill);
+	const auto spillFlat = spillBuffer->CreateBufferCopy(VisCore::Buffer::BufferType::Constraint);
+	std::cout << "Spill Copy: " << (spillCopy->GetLength() == spillModel.size()) << " "
+		<< (std::string(spillFlat->GetData(), spillFlat->GetLength()) == spillModel) << std::endl;
+	std::cout << "Spill Data: " << (std::string(spillBuffer->GetData(), spillBuffer->GetLength()) == spillModel) << " "
+		<< (std::string(spillCopy->GetData(), spillCopy->GetLength()) == spillModel) << std::endl;
+	// uninitialized spill result is built segment by segment, nothing past memory limit stays resident
+	const auto oldSpillOptions = VisCore::Buffer::GetDefaultSpillOptions();
+	VisCore::Buffer::SetDefaultSpillOptions(spillOptions);
+	const auto spillLiveBefore = VisCore::Buffer::GetBufferStats()[VisCore::Buffer::BufferType::Spill].LiveBytes;
+	const auto spillConvertSource = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 256 * 1024, 0);
+	const auto spillConverted = VisCore::Buffer::ConvertNumeric(*spillConvertSource, VisCore::Buffer::NumericFormat::Float32,
+	                                                            VisCore::Buffer::NumericFormat::Float32,
+	                                                            VisCore::Buffer::BufferType::Spill);
+	std::cout << "Spill Allocate Stays Spilled: "
+		<< (VisCore::Buffer::GetBufferStats()[VisCore::Buffer::BufferType::Spill].LiveBytes - spillLiveBefore <=
+		    spillOptions.MemoryLimit) << " " << (spillConverted->GetLength() == 256 * 1024) << std::endl;
+	VisCore::Buffer::SetDefaultSpillOptions(oldSpillOptions);
+
+	std::cout << "Test Shared Buffer......" << std::endl;
+	VisCore::Buffer::RemoveSharedBuffer("VisCore.TestShared");
+	auto sharedWriter = VisCore::Buffer::CreateSharedBuffer("VisCore.TestShared", 4096);
+	auto sharedReader = VisCore::Buffer::OpenSharedBuffer("VisCore.TestShared", true);
+	sharedWriter->Update(100, 6, "shared");
+	std::cout << "Shared Type: " << ToString(sharedWriter->GetType()) << " Named: " << sharedReader->GetLength() << " "
+		<< std::string(sharedReader->GetData() + 100, 6) << " " << !sharedReader->Update(0, 1, "x") << " "
+		<< VisCore::Buffer::RemoveSharedBuffer("VisCore.TestShared") << std::endl;
+	// read only mapping has no raw write access, copies fall back to refused Update()
+	CreateBuffer(VisCore::Buffer::BufferType::Constraint, 200, 'q')->CopyTo(sharedReader);
+	const auto sharedSource = CreateBuffer(VisCore::Buffer::BufferType::Streaming, 200, 'r');
+	sharedSource->GetStreaming()->Read(sharedReader.get(), 200);
+	std::cout << "Shared Read Only Copy: " << std::string(sharedReader->GetData() + 100, 6) << " "
+		<< (sharedReader->begin() == nullptr) << " " << sharedReader->GetWritableSpan().empty() << std::endl;
+	const float sharedFloats[4] = {};
+	const VisCore::Buffer::ConstAttributeStream sharedStream = {0, 4, reinterpret_cast<const char*>(sharedFloats)};
+	std::cout << "Shared Read Only Region: " << !VisCore::Buffer::ByteSwapRegion(*sharedReader, 0, 16, 4) << " "
+		<< !VisCore::Buffer::ConvertNumericRegion(*sharedSource, 0, VisCore::Buffer::NumericFormat::Float32, *sharedReader,
+		                                          0, VisCore::Buffer::NumericFormat::Float32, 16) << " "
+		<< !VisCore::Buffer::InterleaveRegion(*sharedReader, 0, 4, 4, &sharedStream, 1) << " "
+		<< VisCore::Buffer::AsSpan<uint32_t>(*sharedReader, 16).empty() << " "
+		<< VisCore::Buffer::AsStridedView<uint32_t>(*sharedReader, 0, 8).empty() << " "
+		<< (sharedReader->begin() == sharedReader->end()) << std::endl;
+	auto sharedMemory = CreateBuffer(VisCore::Buffer::BufferType::Shared, 256, 'a');
+	auto sharedView   = VisCore::Buffer::OpenSharedBuffer(VisCore::Buffer::GetSharedBufferHandle(*sharedMemory));
+	(*sharedMemory)[10] = 'z';
+	const auto sharedRead = CreateBuffer(VisCore::Buffer::BufferType::Constraint, 4, 0);
+	sharedView->GetStreaming()->Seek(8);
+	sharedView->GetStreaming()->Read(sharedRead.get(), 4);
+	std::cout << "Shared Handle: " << std::string(sharedRead->GetData(), 4) << " Seek Start: "
+		<< sharedView->GetStreaming()->Seek(-12, VisCore::Streaming::SeekMode::SeekCurrent) << std::endl;
+	sharedView.reset();
+	const auto sharedSealed = VisCore::Buffer::SealSharedBuffer(*sharedMemory);
+	if (sharedSealed) {
+		auto sealedView = VisCore::Buffer::OpenSharedBuffer(VisCore::Buffer::GetSharedBufferHandle(*sharedMemory));
+		std::cout << "Shared Sealed: " << VisCore::Buffer::IsSharedBufferReadOnly(*sealedView) << " "
+			<< !sharedMemory->Update(0, 1, "x") << " " << sealedView->GetData()[10] << std::endl;
+		CreateBuffer(VisCore::Buffer::BufferType::Constraint, 16, 'q')->CopyTo(sharedMemory);
+		CreateBuffer(VisCore::Buffer::BufferType::Spill, 16, 'q')->CopyTo(sharedMemory);
+		std::cout << "Shared Sealed Copy: " << sharedMemory->GetData()[0] << sealedView->GetData()[10] << std::endl;
+	} else {
+		std::cout << "Shared Sealed: " << !VisCore::Buffer::IsSharedBufferReadOnly(*sharedMemory) << " "
+			<< sharedMemory->Update(0, 1, "x") << " " << sharedMemory->GetData()[10] << std::endl;
+	}
+}
@@ -0,0 +1,148 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "TestFile.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Buffer/Buffer.h"
+#include "File/File.h"
+
+using namespace VisCore;
+
+void TestFile() {
+	const auto path = (std::filesystem::temp_directory_path() / "VisCore.Test.File.bin").string();
+
+	std::cout << "Test Direct File......" << std::endl;
+	std::vector<char> source(3 * 4096 + 100);
+	for (size_t index = 0; index < source.size(); ++index) {
+		source[index] = static_cast<char>('a' + index % 26);
+	}
+
+	File::FileOptions options;
+	options.Direct = true;
+	{
+		const auto file = OpenFile(path.c_str(), File::FileMode::Create, File::FileAccess::Write, File::FileType::Binary, options);
+		std::cout << "File Opened: " << (file != nullptr) << std::endl;
+		std::cout << "File Mode: " << ToString(file->GetMode()) << std::endl;
+		// unaligned offset and size, head and tail go through staging block
+		std::cout << "File Write Head: " << file->Write(source.data(), 100) << std::endl;
+		std::cout << "File Write Rest: " << file->Write(source.data() + 100, source.size() - 100) << std::endl;
+		std::cout << "File Overwrite: " << file->WriteAt(4000, "VisCore", 7) << std::endl;
+		std::cout << "File Size: " << file->GetSize() << std::endl;
+		std::cout << "File Sync: " << file->Sync() << std::endl;
+	}
+	memcpy(source.data() + 4000, "VisCore", 7);
+
+	{
+		const auto file   = OpenFile(path.c_str(), File::FileMode::Open, File::FileAccess::Read, File::FileType::Binary, options);
+		const auto buffer = CreateBuffer(Buffer::BufferType::Constraint, source.size(), 0);
+		std::cout << "File Read: " << file->Read(buffer.get(), buffer->GetLength()) << std::endl;
+		std::cout << "File Read Match: " << (memcmp(buffer->GetData(), source.data(), source.size()) == 0) << std::endl;
+		std::cout << "File Eof: " << file->IsEof() << std::endl;
+
+		char part[8] = {};
+		std::cout << "File ReadAt: " << file->ReadAt(4000, part, 7) << " " << part << std::endl;
+		std::cout << "File ReadAt End: " << file->ReadAt(source.size() - 3, part, 7) << std::endl;
+		std::cout << "File Write Without Access: " << static_cast<int64_t>(file->Write("x", 1)) << std::endl;
+		std::cout << "File Seek End: " << file->Seek(-10, Streaming::SeekMode::SeekEnd) << std::endl;
+	}
+
+	{
+		const auto file = OpenFile(path.c_str(), File::FileMode::Append, File::FileAccess::ReadWrite);
+		std::cout << "File Append Position: " << file->Tell() << std::endl;
+		file->Write("tail", 4);
+		std::cout << "File Append Size: " << file->GetSize() << std::endl;
+	}
+
+	std::cout << "Test Write Behind File......" << std::endl;
+	{
+		File::FileOptions writeBehind;
+		writeBehind.WriteBehind = true;
+		writeBehind.BlockSize   = 4096;
+		writeBehind.BlockCount  = 2;
+
+		const auto file = OpenFile(path.c_str(), File::FileMode::Truncate, File::FileAccess::ReadWrite, File::FileType::Binary, writeBehind);
+		for (int index = 0; index < 100; ++index) {
+			file->Write(source.data(), 1000);
+		}
+		std::cout << "Write Behind Size: " << file->GetSize() << std::endl;
+		std::cout << "Write Behind Flush: " << file->Flush() << std::endl;
+		file->Seek(10);
+		file->Write("VisCore", 7);
+
+		char part[8] = {};
+		std::cout << "Write Behind ReadAt: " << file->ReadAt(10, part, 7) << " " << part << std::endl;
+		std::cout << "Write Behind Sync: " << file->Sync() << std::endl;
+	}
+
+	std::cout << "Test Load File......" << std::endl;
+	{
+		const auto loaded = File::LoadFile(path.c_str(), Buffer::BufferType::Streaming, 4);
+		std::cout << "Load File Type: " << ToString(loaded->GetType()) << std::endl;
+		std::cout << "Load File Size: " << loaded->GetLength() << std::endl;
+		std::cout << "Load File Data: " << std::string(loaded->GetData() + 10, 7) << std::endl;
+
+		const auto direct = File::LoadFile(path.c_str(), Buffer::BufferType::Constraint, 4, options);
+		std::cout << "Load File Direct Match: " << (memcmp(direct->GetData(), loaded->GetData(), loaded->GetLength()) == 0) << std::endl;
+		std::cout << "Load File Missing: " << (File::LoadFile((path + ".missing").c_str(), Buffer::BufferType::Constraint) == nullptr) << std::endl;
+
+		// size not multiple of thread count, last reader must reach file end
+		const auto        largePath = path + ".large";
+		std::vector<char> large(16 * 1024 * 1024 + 1);
+		for (size_t index = 0; index < large.size(); ++index) {
+			large[index] = static_cast<char>('a' + index % 26);
+		}
+		{
+			const auto file = OpenFile(largePath.c_str(), File::FileMode::Create, File::FileAccess::Write);
+			file->Write(large.data(), large.size());
+		}
+		const auto loadedLarge = File::LoadFile(largePath.c_str(), Buffer::BufferType::Constraint, 2);
+		std::cout << "Load File Uneven Split Match: "
+			<< (loadedLarge && loadedLarge->GetLength() == large.size() &&
+			    memcmp(loadedLarge->GetData(), large.data(), large.size()) == 0) << std::endl;
+
+		// managed buffer is not written in place, data goes through Update()
+		const auto managed = File::LoadFile(largePath.c_str(), Buffer::BufferType::Managed, 2, options);
+		const auto copy    = managed ? managed->CreateBufferCopy(Buffer::BufferType::Constraint) : nullptr;
+		std::cout << "Load File Managed Match: "
+			<< (copy && copy->GetLength() == large.size() && memcmp(copy->GetData(), large.data(), large.size()) == 0)
+			<< std::endl;
+		std::remove(largePath.c_str());
+	}
+
+	std::cout << "Test Transfer......" << std::endl;
+	{
+		const auto copyPath = path + ".copy";
+		const auto input    = OpenFile(path.c_str(), File::FileMode::Open, File::FileAccess::Read);
+		const auto output   = OpenFile(copyPath.c_str(), File::FileMode::Create, File::FileAccess::ReadWrite);
+		input->Seek(10);
+		std::cout << "Transfer File: " << File::Transfer(*input, *output, 7) << " "
+			<< File::Transfer(*input, *output, input->GetSize()) << " " << input->IsEof() << " " << output->Tell()
+			<< std::endl;
+
+		const auto memory = CreateBuffer(Buffer::BufferType::Streaming, "[memory]", 8);
+		std::cout << "Transfer Buffer: " << File::Transfer(*memory->GetStreaming(), *output, 100) << " "
+			<< output->GetSize() << std::endl;
+
+		const auto spill = CreateBuffer(Buffer::BufferType::Spill, 3 * 1024 * 1024, 's');
+		output->Seek(0);
+		std::cout << "Transfer Bounce: " << File::Transfer(*spill->GetStreaming(), *output, 2 * 1024 * 1024 + 5) << " "
+			<< output->GetSize() << std::endl;
+
+		char part[8] = {};
+		output->ReadAt(2 * 1024 * 1024 + 4, part, 7);
+		std::cout << "Transfer Data: " << part << std::endl;
+		output->Close();
+		std::remove(copyPath.c_str());
+	}
+
+	std::cout << "File Open Missing: " << (OpenFile((path + ".missing").c_str(), File::FileMode::Open, File::FileAccess::Read) == nullptr) << std::endl;
+	std::remove(path.c_str());
+}
@@ -0,0 +1,103 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "TestStreaming.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Buffer/Buffer.h"
+#include "File/File.h"
+#include "Streaming/BinaryReader.h"
+#include "Streaming/BinaryWriter.h"
+#include "Streaming/Varint.h"
+
+using namespace VisCore;
+
+void TestStreaming() {
+	std::cout << "Test Binary Writer......" << std::endl;
+	const auto buffer = Buffer::CreateBuffer(Buffer::BufferType::Dynamic, static_cast<size_t>(0), 0);
+	{
+		const float values[] = {1.5f, -2.25f, 4.0f};
+
+		Streaming::BinaryWriter writer(*buffer, 0, 16);
+		writer.Write<uint32_t>(0x01020304u);
+		writer.Write<uint32_t, Streaming::ByteOrder::Big>(0x01020304u);
+		writer.Write<double, Streaming::ByteOrder::Big>(3.5);
+		writer.WriteVarint(300);
+		writer.WriteSignedVarint(-129);
+		writer.WriteArray<float, Streaming::ByteOrder::Big>({values, 3});
+		std::cout << "Binary Writer Tell: " << writer.Tell() << std::endl;
+	}
+	std::cout << "Binary Writer Length: " << buffer->GetLength() << std::endl;
+	std::cout << "Binary Writer Big Endian: " << static_cast<int>(buffer->GetData()[4]) << " "
+		<< static_cast<int>(buffer->GetData()[7]) << std::endl;
+
+	std::cout << "Test Binary Reader......" << std::endl;
+	{
+		Streaming::BinaryReader reader(*buffer);
+		const auto little = reader.Read<uint32_t>();
+		const auto big    = reader.Read<uint32_t, Streaming::ByteOrder::Big>();
+		const auto real   = reader.Read<double, Streaming::ByteOrder::Big>();
+		uint64_t   varint = 0;
+		int64_t    signedVarint = 0;
+		reader.ReadVarint(varint);
+		reader.ReadSignedVarint(signedVarint);
+		float values[3] = {};
+		reader.ReadArray<float, Streaming::ByteOrder::Big>({values, 3});
+		std::cout << "Binary Reader Values: " << std::hex << little << " " << big << std::dec << " " << real << " "
+			<< varint << " " << signedVarint << " " << values[0] << " " << values[1] << " " << values[2] << std::endl;
+		std::cout << "Binary Reader End: " << !reader.Read<uint8_t>() << " " << reader.IsFailed() << std::endl;
+	}
+
+	// file round trip, small chunks cross value boundaries
+	const auto path = (std::filesystem::temp_directory_path() / "VisCore.Test.Binary.bin").string();
+	{
+		const auto file = File::OpenFile(path.c_str(), File::FileMode::Create, File::FileAccess::Write);
+		Streaming::BinaryWriter writer(file.get(), 16);
+		for (uint32_t index = 0; index < 1000; ++index) {
+			writer.Write<uint16_t>(static_cast<uint16_t>(index));
+			writer.WriteVarint(static_cast<uint64_t>(index) * 1000003);
+		}
+	}
+	{
+		const auto file = File::OpenFile(path.c_str(), File::FileMode::Open, File::FileAccess::Read);
+		Streaming::BinaryReader reader(file.get(), 16);
+		bool match = true;
+		for (uint32_t index = 0; index < 1000; ++index) {
+			uint64_t varint = 0;
+			match = match && reader.Read<uint16_t>() == index && reader.ReadVarint(varint) &&
+			        varint == static_cast<uint64_t>(index) * 1000003;
+		}
+		std::cout << "Binary File Round Trip: " << match << " " << reader.Tell() << std::endl;
+	}
+	std::remove(path.c_str());
+
+	std::cout << "Test Varint......" << std::endl;
+	std::vector<uint64_t> varints;
+	for (uint64_t index = 0; index < 1000; ++index) {
+		varints.push_back(index % 3 ? index : index << (index % 57));
+	}
+	std::vector<char> encoded(varints.size() * 10);
+	const auto        encodedSize = Streaming::EncodeVarints(varints.data(), varints.size(), encoded.data());
+	std::vector<uint64_t> decodedVarints(varints.size());
+	size_t                consumed = 0;
+	const auto decodedCount = Streaming::DecodeVarints(encoded.data(), encodedSize, decodedVarints.data(),
+	                                                   decodedVarints.size(), consumed);
+	std::cout << "Varint Round Trip: " << (decodedCount == varints.size() && consumed == encodedSize &&
+	                                       decodedVarints == varints) << std::endl;
+	std::cout << "Varint Truncated: " << Streaming::DecodeVarints(encoded.data(), 3, decodedVarints.data(), 10, consumed)
+		<< " " << consumed << std::endl;
+
+	std::vector<uint32_t> groups = {1, 300, 70000, 1u << 30, 5, 6};
+	std::vector<char>     groupEncoded(Streaming::GetGroupVarintMaxSize(groups.size()));
+	const auto groupSize = Streaming::EncodeGroupVarint(groups.data(), groups.size(), groupEncoded.data());
+	std::vector<uint32_t> groupDecoded(groups.size());
+	const auto groupCount = Streaming::DecodeGroupVarint(groupEncoded.data(), groupSize, groupDecoded.data(),
+	                                                     groupDecoded.size(), consumed);
+	std::cout << "Group Varint: " << groupSize << " " << groupCount << " " << (groupDecoded == groups) << std::endl;
+}
@@ -0,0 +1,110 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "TestText.h"
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "Buffer/Buffer.h"
+#include "Text/BinaryText.h"
+#include "Text/LineReader.h"
+#include "Text/Unicode.h"
+
+using namespace VisCore;
+
+void TestText() {
+	std::cout << "Test Line Reader......" << std::endl;
+	// records longer than one chunk and "\r\n" across chunk boundary
+	std::string text;
+	for (int index = 0; index < 40; ++index) {
+		text += std::string(static_cast<size_t>(index * 7), 'v') + (index % 2 ? "\r\n" : "\n");
+	}
+	text += "测试数据";
+
+	const auto source = Buffer::CreateBuffer(Buffer::BufferType::Streaming, text.data(), text.size());
+	Text::LineReaderOptions options;
+	options.ChunkSize = 64;
+	Text::LineReader reader(source->GetStreaming(), options);
+
+	std::string_view line;
+	bool             match = true;
+	for (int index = 0; index < 40; ++index) {
+		match = match && reader.Next(line) && line == std::string(static_cast<size_t>(index * 7), 'v');
+	}
+	std::cout << "Line Reader Lines: " << match << std::endl;
+	std::cout << "Line Reader Last: " << (reader.Next(line) ? std::string(line) : "") << std::endl;
+	std::cout << "Line Reader End: " << !reader.Next(line) << std::endl;
+	std::cout << "Line Reader Count: " << reader.GetLineCount() << std::endl;
+
+	const std::string records = "VisCore||Buffer|||File||";
+	const auto        recordSource = Buffer::CreateBuffer(Buffer::BufferType::Streaming, records.data(), records.size());
+	options.Delimiter = "||";
+	Text::LineReader recordReader(recordSource->GetStreaming(), options);
+	std::cout << "Record Reader:";
+	while (recordReader.Next(line)) {
+		std::cout << " [" << line << "]";
+	}
+	std::cout << std::endl;
+
+	std::cout << "Test Unicode......" << std::endl;
+	const std::string utf8 = "VisCore 测试数据 \xF0\x9F\x98\x80 é";
+	std::cout << "Validate Utf8: " << Text::ValidateUtf8(utf8.data(), utf8.size()) << std::endl;
+	std::cout << "Validate Overlong: " << Text::ValidateUtf8("\xC0\xAF", 2) << std::endl;
+	std::cout << "Validate Surrogate: " << Text::ValidateUtf8("\xED\xA0\x80", 3) << std::endl;
+	std::cout << "Validate Truncated: " << Text::ValidateUtf8("\xE6\xB5", 2) << std::endl;
+
+	const auto utf16Size = Text::GetTranscodedSize(utf8.data(), utf8.size(), Text::Encoding::Utf8, Text::Encoding::Utf16);
+	const auto utf32Size = Text::GetTranscodedSize(utf8.data(), utf8.size(), Text::Encoding::Utf8, Text::Encoding::Utf32);
+	std::cout << "Transcoded Size: " << utf16Size << " " << utf32Size << std::endl;
+
+	const auto utf8Buffer  = Buffer::CreateBuffer(Buffer::BufferType::Constraint, utf8.data(), utf8.size());
+	const auto utf16Buffer = Text::Transcode(*utf8Buffer, Text::Encoding::Utf8, Text::Encoding::Utf16);
+	const auto backBuffer  = Text::Transcode(*utf16Buffer, Text::Encoding::Utf16, Text::Encoding::Utf8);
+	std::cout << "Transcode Round Trip: " << (std::string(backBuffer->GetData(), backBuffer->GetLength()) == utf8)
+		<< std::endl;
+
+	// feed 1 byte at a time, every sequence is split
+	Text::Transcoder transcoder(Text::Encoding::Utf8, Text::Encoding::Utf32);
+	std::string      utf32;
+	for (const auto value : utf8) {
+		char       output[8];
+		const auto written = transcoder.Convert(&value, 1, output);
+		utf32.append(output, written);
+	}
+	std::cout << "Transcoder Chunked: " << (utf32.size() == utf32Size && transcoder.Finish()) << std::endl;
+	transcoder.Reset();
+	std::cout << "Transcoder Invalid: " << (transcoder.Convert("\x80", 1, nullptr) == static_cast<size_t>(-1))
+		<< std::endl;
+
+	std::cout << "Test Binary Text......" << std::endl;
+	const std::string binary = "VisCore binary text \x00\x01\xFE\xFF";
+	const auto        binaryBuffer = Buffer::CreateBuffer(Buffer::BufferType::Constraint, binary.data(), binary.size());
+	const auto        base64       = Text::EncodeBase64(*binaryBuffer);
+	std::cout << "Base64: " << std::string(base64->GetData(), base64->GetLength()) << std::endl;
+	const auto decoded = Text::DecodeBase64(*base64);
+	std::cout << "Base64 Round Trip: " << (std::string(decoded->GetData(), decoded->GetLength()) == binary) << std::endl;
+	std::cout << "Base64 Invalid: " << (Text::DecodeBase64("Vi*=", 4, nullptr) == static_cast<size_t>(-1)) << std::endl;
+
+	const auto hex = Text::EncodeHex(*binaryBuffer, true);
+	std::cout << "Hex: " << std::string(hex->GetData(), hex->GetLength()) << std::endl;
+	const auto hexDecoded = Text::DecodeHex(*hex);
+	std::cout << "Hex Round Trip: " << (std::string(hexDecoded->GetData(), hexDecoded->GetLength()) == binary) << std::endl;
+
+	// 5 byte chunks split Base64 quanta
+	const auto base64Source  = Buffer::CreateBuffer(Buffer::BufferType::Streaming, base64->GetData(), base64->GetLength());
+	const auto streamDecoded = Text::DecodeBase64(base64Source->GetStreaming(), Buffer::BufferType::Constraint, 5);
+	std::cout << "Base64 Streaming: " << (std::string(streamDecoded->GetData(), streamDecoded->GetLength()) == binary)
+		<< std::endl;
+
+	// managed and spill results are written through Update()
+	base64Source->GetStreaming()->Seek(0);
+	const auto managedDecoded = Text::DecodeBase64(base64Source->GetStreaming(), Buffer::BufferType::Managed, 5);
+	const auto spillHex       = Text::EncodeHex(*binaryBuffer, true, Buffer::BufferType::Spill);
+	std::cout << "Base64 Streaming Managed: "
+		<< (managedDecoded && std::string(managedDecoded->GetData(), managedDecoded->GetLength()) == binary) << std::endl;
+	std::cout << "Hex Spill: " << (spillHex && std::string(spillHex->GetData(), spillHex->GetLength()) ==
+		std::string(hex->GetData(), hex->GetLength())) << std::endl;
+}
@@ -0,0 +1,79 @@
+/**
+ * Created by Rayfalling on 2026/10/19.
+ * */
+
+#include "TestThread.h"
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "Thread/ThreadPool.h"
+
+using namespace VisCore;
+
+void TestThread() {
+	std::cout << "Test Thread Pool......" << std::endl;
+	Thread::ThreadPoolConfig config;
+	config.WorkerCount = 3;
+	config.Affinity    = {0};
+	Thread::ThreadPool pool(config);
+	std::cout << "Pool Workers: " << pool.GetWorkerCount() << std::endl;
+
+	std::vector<int> values(100000, 1);
+	std::atomic<long long> sum{0};
+	std::atomic<size_t>    ranges{0};
+	pool.ParallelFor(0, values.size(), [&](const size_t begin, const size_t end) {
+		long long local = 0;
+		for (size_t index = begin; index < end; ++index) {
+			local += values[index];
+		}
+		sum += local;
+		++ranges;
+	});
+	std::cout << "Parallel For Sum: " << sum.load() << std::endl;
+	std::cout << "Parallel For Split: " << (ranges.load() > 1) << std::endl;
+
+	// nested wait inside pool tasks must not block workers
+	std::atomic<int> nested{0};
+	{
+		Thread::TaskGroup group(pool);
+		for (int outer = 0; outer < 8; ++outer) {
+			group.Run([&] {
+				Thread::TaskGroup inner(pool);
+				for (int index = 0; index < 8; ++index) {
+					inner.Run([&] {
+						++nested;
+					});
+				}
+				inner.Wait();
+			});
+		}
+		group.Wait();
+	}
+	std::cout << "Task Group Nested: " << nested.load() << std::endl;
+
+	try {
+		Thread::TaskGroup group(pool);
+		group.Run([] {
+			throw std::runtime_error("VisCore");
+		});
+		group.Wait();
+		std::cout << "Task Group Exception Failed" << std::endl;
+	} catch (std::runtime_error& error) {
+		std::cout << "Task Group Exception: " << error.what() << std::endl;
+	}
+
+	std::atomic<int> submitted{0};
+	{
+		Thread::TaskGroup group;
+		group.Run([&] {
+			Thread::GetDefaultThreadPool().ParallelFor(0, 64, [&](const size_t begin, const size_t end) {
+				submitted += static_cast<int>(end - begin);
+			}, 1);
+		});
+	}
+	std::cout << "Default Pool: " << submitted.load() << std::endl;
+	std::cout << "Configure After Use: " << Thread::ConfigureDefaultThreadPool(config) << std::endl;
+}
@@ -3,7 +3,15 @@
  * */
 
 #include "TestBuffer.h"
+#include "TestFile.h"
+#include "TestStreaming.h"
+#include "TestText.h"
+#include "TestThread.h"
 
 int main() {
 	TestBuffer();
+	TestFile();
+	TestStreaming();
+	TestText();
+	TestThread();
 }
\ No newline at end of file